@@ -0,0 +1,622 @@
+/**
+ * @file bench_cordic.cpp
+ * @brief Suite de rendimiento de CORDIC Softmax con salida JSON
+ *
+ * Benchmarks registrados por nombre (estilo Google Benchmark, sin la
+ * dependencia):
+ * - exp/<ruta>/<n>:            throughput de e^x (elementos/s), incluida la tabla
+ *                              híbrida de 1 KB (CORDICLutExp)
+ * - softmax/<ruta>/<vocab>:    latencia por llamada con percentiles, vocab 32..256K
+ *                              (cordic_f16: logits fp16 convertidos por bloques;
+ *                              cordic_int16: softmax entero Q7.8 → uint16)
+ * - log_softmax/<ruta>/<vocab>: log-softmax con un solo log frente a softmax + logf
+ * - softmax_threads/<h>/<vocab>: escalado de computeSoftmaxParallel por hilos
+ * - sampling/<modo>/<vocab>:   top-k = 40, top-p = 0.95 fusionado frente a
+ *                              softmax completo + filtro
+ *
+ * Referencias: std::exp escalar y un softmax float vectorizable (polinomio
+ * de grado 6 sin saltos que el compilador auto-vectoriza).
+ *
+ * USO:
+ *   bench_cordic [--json=FICHERO|-] [--min-time=S] [--max-threads=N] [--filter=TEXTO]
+ *
+ * Con --json=- el JSON sale por stdout (y la tabla por stderr); el esquema
+ * sigue al de Google Benchmark ("context" + "benchmarks") para poder
+ * reutilizar sus herramientas de comparación entre commits.
+ */
+
+#include "cordic_softmax.h"
+#include "cordic_attention.h"
+#include "cordic_lut.h"
+#include "cordic_integer.h"
+#include "cordic_sampling.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#ifndef CORDIC_GIT_COMMIT
+#define CORDIC_GIT_COMMIT "unknown"
+#endif
+
+#ifndef CORDIC_BUILD_TYPE
+#define CORDIC_BUILD_TYPE "unknown"
+#endif
+
+//==============================================================================
+// CONFIGURACIÓN Y RESULTADOS
+//==============================================================================
+
+struct BenchOptions {
+    std::string json_path;      // Vacío: sin JSON; "-": stdout
+    double min_time = 0.2;      // Segundos mínimos por benchmark
+    size_t min_samples = 10;    // Muestras mínimas para los percentiles
+    size_t max_samples = 100000;
+    size_t max_threads = CORDICThreadPool::defaultThreadCount();
+    std::string filter;
+};
+
+/**
+ * @brief Resultado de un benchmark: una muestra = una llamada completa
+ */
+struct BenchResult {
+    std::string name;
+    size_t items_per_call;
+    std::vector<double> samples_ns;
+
+    double mean_ns;
+    double min_ns;
+    double p50_ns;
+    double p90_ns;
+    double p99_ns;
+    double max_ns;
+    double items_per_second;
+};
+
+static double percentile(const std::vector<double>& sorted, double p) {
+    const size_t index = static_cast<size_t>(p * static_cast<double>(sorted.size() - 1) + 0.5);
+    return sorted[std::min(index, sorted.size() - 1)];
+}
+
+//==============================================================================
+// REGISTRO Y EJECUCIÓN
+//==============================================================================
+
+class BenchRunner {
+private:
+    BenchOptions options;
+    std::vector<BenchResult> results;
+
+public:
+    explicit BenchRunner(const BenchOptions& opts) : options(opts) {}
+
+    const BenchOptions& getOptions() const { return options; }
+    const std::vector<BenchResult>& getResults() const { return results; }
+
+    /**
+     * @brief Mide body() hasta min_time y al menos min_samples llamadas
+     *
+     * @param items_per_call Elementos procesados por llamada (para elementos/s)
+     */
+    void run(const std::string& name, size_t items_per_call, const std::function<void()>& body) {
+        if (!options.filter.empty() && name.find(options.filter) == std::string::npos) {
+            return;
+        }
+
+        // Calentamiento: pools, cachés y frecuencia
+        body();
+
+        BenchResult result;
+        result.name = name;
+        result.items_per_call = items_per_call;
+
+        const auto deadline = std::chrono::steady_clock::now() +
+                              std::chrono::duration<double>(options.min_time);
+        while (result.samples_ns.size() < options.max_samples &&
+               (result.samples_ns.size() < options.min_samples ||
+                std::chrono::steady_clock::now() < deadline)) {
+            auto start = std::chrono::steady_clock::now();
+            body();
+            auto end = std::chrono::steady_clock::now();
+            result.samples_ns.push_back(std::chrono::duration<double, std::nano>(end - start).count());
+        }
+
+        std::vector<double> sorted = result.samples_ns;
+        std::sort(sorted.begin(), sorted.end());
+        double total = 0.0;
+        for (double ns : sorted) {
+            total += ns;
+        }
+        result.mean_ns = total / static_cast<double>(sorted.size());
+        result.min_ns = sorted.front();
+        result.p50_ns = percentile(sorted, 0.50);
+        result.p90_ns = percentile(sorted, 0.90);
+        result.p99_ns = percentile(sorted, 0.99);
+        result.max_ns = sorted.back();
+        result.items_per_second = static_cast<double>(items_per_call) * 1e9 / result.mean_ns;
+
+        printRow(result);
+        results.push_back(result);
+    }
+
+    void printHeader() const {
+        std::ostream& out = tableStream();
+        out << std::left << std::setw(40) << "Benchmark" << std::right
+            << std::setw(10) << "Muestras" << std::setw(12) << "p50 (us)"
+            << std::setw(12) << "p90 (us)" << std::setw(12) << "p99 (us)"
+            << std::setw(14) << "Melem/s" << std::endl;
+        out << std::string(100, '-') << std::endl;
+    }
+
+    void printRow(const BenchResult& r) const {
+        std::ostream& out = tableStream();
+        out << std::left << std::setw(40) << r.name << std::right
+            << std::setw(10) << r.samples_ns.size()
+            << std::fixed << std::setprecision(2)
+            << std::setw(12) << r.p50_ns / 1e3
+            << std::setw(12) << r.p90_ns / 1e3
+            << std::setw(12) << r.p99_ns / 1e3
+            << std::setw(14) << r.items_per_second / 1e6 << std::endl;
+    }
+
+    std::ostream& tableStream() const {
+        return options.json_path == "-" ? std::cerr : std::cout;
+    }
+
+    /**
+     * @brief Vuelca contexto y resultados en JSON (esquema de Google Benchmark)
+     */
+    void writeJson(std::ostream& out, const char* executable) const {
+        char date[32];
+        const std::time_t now = std::time(nullptr);
+        std::strftime(date, sizeof(date), "%Y-%m-%dT%H:%M:%S%z", std::localtime(&now));
+
+        const char* commit_env = std::getenv("CORDIC_BENCH_COMMIT");
+        const std::string commit = commit_env ? commit_env : CORDIC_GIT_COMMIT;
+
+        out << std::setprecision(6) << std::defaultfloat;
+        out << "{\n  \"context\": {\n"
+            << "    \"date\": \"" << date << "\",\n"
+            << "    \"executable\": \"" << escape(executable) << "\",\n"
+            << "    \"num_cpus\": " << std::thread::hardware_concurrency() << ",\n"
+            << "    \"library_build_type\": \"" << CORDIC_BUILD_TYPE << "\",\n"
+            << "    \"git_commit\": \"" << escape(commit) << "\",\n"
+            << "    \"cordic_kernel\": \""
+            << CORDICSIMD::kernelName(CORDICSoftmax::getActiveKernel()) << "\",\n"
+            << "    \"cordic_kernel_forced\": "
+            << (CORDICSIMD::isKernelForced() ? "true" : "false") << ",\n"
+            << "    \"min_time\": " << options.min_time << "\n"
+            << "  },\n  \"benchmarks\": [\n";
+        for (size_t i = 0; i < results.size(); i++) {
+            const BenchResult& r = results[i];
+            out << "    {\n"
+                << "      \"name\": \"" << escape(r.name) << "\",\n"
+                << "      \"run_type\": \"iteration\",\n"
+                << "      \"iterations\": " << r.samples_ns.size() << ",\n"
+                << "      \"real_time\": " << r.mean_ns << ",\n"
+                << "      \"time_unit\": \"ns\",\n"
+                << "      \"items_per_call\": " << r.items_per_call << ",\n"
+                << "      \"items_per_second\": " << r.items_per_second << ",\n"
+                << "      \"min_ns\": " << r.min_ns << ",\n"
+                << "      \"p50_ns\": " << r.p50_ns << ",\n"
+                << "      \"p90_ns\": " << r.p90_ns << ",\n"
+                << "      \"p99_ns\": " << r.p99_ns << ",\n"
+                << "      \"max_ns\": " << r.max_ns << "\n"
+                << "    }" << (i + 1 < results.size() ? "," : "") << "\n";
+        }
+        out << "  ]\n}\n";
+    }
+
+private:
+    static std::string escape(const std::string& text) {
+        std::string escaped;
+        for (char c : text) {
+            if (c == '"' || c == '\\') {
+                escaped += '\\';
+            }
+            escaped += c;
+        }
+        return escaped;
+    }
+};
+
+//==============================================================================
+// REFERENCIAS FLOAT
+//==============================================================================
+
+/**
+ * @brief e^x float sin saltos ni llamadas: 2^n × P(r), |r| ≤ ln(2)/2
+ *
+ * Error relativo ~2e-7 en [-87, 88]; el bucle que la llama se auto-vectoriza
+ * con -O3 (es la referencia "softmax float vectorizado").
+ */
+static inline float expPolynomial(float x) {
+    x = std::min(std::max(x, -87.0f), 88.0f);
+    const float n = std::nearbyint(x * 1.44269504f);
+    const float r = (x - n * 0.693145752f) - n * 1.42860677e-6f;
+
+    float p = 1.0f / 720.0f;
+    p = p * r + 1.0f / 120.0f;
+    p = p * r + 1.0f / 24.0f;
+    p = p * r + 1.0f / 6.0f;
+    p = p * r + 0.5f;
+    p = p * r + 1.0f;
+    p = p * r + 1.0f;
+
+    const int32_t bits = (static_cast<int32_t>(n) + 127) << 23;
+    float scale;
+    std::memcpy(&scale, &bits, sizeof(scale));
+    return p * scale;
+}
+
+static void softmaxStdExp(const float* logits, float* probs, size_t size) {
+    const float max_val = *std::max_element(logits, logits + size);
+    float sum = 0.0f;
+    for (size_t i = 0; i < size; i++) {
+        probs[i] = std::exp(logits[i] - max_val);
+        sum += probs[i];
+    }
+    const float inv_sum = 1.0f / sum;
+    for (size_t i = 0; i < size; i++) {
+        probs[i] *= inv_sum;
+    }
+}
+
+static void softmaxVectorized(const float* logits, float* probs, size_t size) {
+    float max_val = -std::numeric_limits<float>::infinity();
+    for (size_t i = 0; i < size; i++) {
+        max_val = std::max(max_val, logits[i]);
+    }
+    for (size_t i = 0; i < size; i++) {
+        probs[i] = expPolynomial(logits[i] - max_val);
+    }
+    // Suma en 16 acumuladores: independiente del orden, vectorizable sin -ffast-math
+    float partial[16] = {};
+    size_t i = 0;
+    for (; i + 16 <= size; i += 16) {
+        for (size_t lane = 0; lane < 16; lane++) {
+            partial[lane] += probs[i + lane];
+        }
+    }
+    float sum = 0.0f;
+    for (; i < size; i++) {
+        sum += probs[i];
+    }
+    for (float value : partial) {
+        sum += value;
+    }
+    const float inv_sum = 1.0f / sum;
+    for (size_t j = 0; j < size; j++) {
+        probs[j] *= inv_sum;
+    }
+}
+
+//==============================================================================
+// SUITES
+//==============================================================================
+
+static std::vector<float> randomLogits(size_t size, unsigned seed) {
+    std::mt19937 gen(seed);
+    std::normal_distribution<float> dist(0.0f, 3.0f);
+    std::vector<float> logits(size);
+    for (float& v : logits) {
+        v = dist(gen);
+    }
+    return logits;
+}
+
+// Evita que el compilador elimine resultados no usados
+static volatile float g_sink;
+
+static void benchExp(BenchRunner& runner) {
+    const size_t n = 4096;
+    const std::string suffix = "/" + std::to_string(n);
+    std::vector<float> inputs = randomLogits(n, 1);
+    for (float& v : inputs) {
+        v = std::min(std::max(v - 6.0f, -14.0f), 0.0f);  // Rango típico tras restar el máximo
+    }
+    std::vector<float> outputs(n);
+    CORDICSoftmax cordic(false);
+    const CORDICSoftmax& ccordic = cordic;
+
+    runner.run("exp/cordic_fast" + suffix, n, [&] {
+        for (size_t i = 0; i < n; i++) {
+            outputs[i] = ccordic.calculateExpFast(inputs[i]);
+        }
+        g_sink = outputs[n - 1];
+    });
+    runner.run("exp/cordic_folded" + suffix, n, [&] {
+        for (size_t i = 0; i < n; i++) {
+            outputs[i] = ccordic.calculateExpFolded(inputs[i]);
+        }
+        g_sink = outputs[n - 1];
+    });
+    CORDICLutExp lut(CORDICLutExp::residualBitsForBudget(1024));
+    runner.run("exp/cordic_lut" + suffix, n, [&] {
+        lut.calculateExpBatch(inputs.data(), outputs.data(), n);
+        g_sink = outputs[n - 1];
+    });
+    runner.run("exp/cordic_tiled" + suffix, n, [&] {
+        ccordic.calculateExpBatchTiled(inputs.data(), outputs.data(), n);
+        g_sink = outputs[n - 1];
+    });
+    runner.run("exp/cordic_batch" + suffix, n, [&] {
+        ccordic.calculateExpBatchFast(inputs.data(), outputs.data(), n);
+        g_sink = outputs[n - 1];
+    });
+    for (CORDICKernel kernel : {CORDICKernel::SSE41, CORDICKernel::AVX2, CORDICKernel::AVX512,
+                                CORDICKernel::NEON}) {
+        if (!CORDICSIMD::isKernelSupported(kernel)) {
+            continue;
+        }
+        std::string name = std::string("exp/cordic_") + CORDICSIMD::kernelName(kernel) + suffix;
+        std::transform(name.begin(), name.end(), name.begin(),
+                       [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+        runner.run(name, n, [&, kernel] {
+            CORDICSIMD::runKernel(kernel, CORDICKernelTables::shared(), inputs.data(),
+                                  outputs.data(), n);
+            g_sink = outputs[n - 1];
+        });
+    }
+    for (int last_shift : {8, 10, CORDICIterator::MAX_FIXED_LAST_SHIFT}) {
+        CORDICSoftmax fixed(false);
+        fixed.setRotationConfig(CORDICRotationConfig(CORDICRotationMode::FIXED_SCHEDULE, last_shift));
+        runner.run("exp/cordic_fixed_n" + std::to_string(last_shift) + suffix, n, [&] {
+            fixed.calculateExpBatchFast(inputs.data(), outputs.data(), n);
+            g_sink = outputs[n - 1];
+        });
+    }
+    runner.run("exp/std_exp" + suffix, n, [&] {
+        for (size_t i = 0; i < n; i++) {
+            outputs[i] = std::exp(inputs[i]);
+        }
+        g_sink = outputs[n - 1];
+    });
+    runner.run("exp/float_vectorized" + suffix, n, [&] {
+        for (size_t i = 0; i < n; i++) {
+            outputs[i] = expPolynomial(inputs[i]);
+        }
+        g_sink = outputs[n - 1];
+    });
+}
+
+static void benchSoftmax(BenchRunner& runner) {
+    const size_t vocab_sizes[] = {32, 256, 1024, 4096, 32000, 128000, 256000};
+    CORDICSoftmax cordic(false);
+    CORDICSoftmax exact_sum(false);
+    exact_sum.setSumMode(CORDICSumMode::EXACT);
+    CORDICIntegerSoftmax integer_softmax(8);
+
+    for (size_t vocab : vocab_sizes) {
+        const std::string suffix = "/" + std::to_string(vocab);
+        std::vector<float> logits = randomLogits(vocab, static_cast<unsigned>(vocab));
+        std::vector<float> probs(vocab);
+
+        runner.run("softmax/cordic" + suffix, vocab, [&] {
+            cordic.computeSoftmax(logits.data(), probs.data(), vocab);
+            g_sink = probs[0];
+        });
+        runner.run("softmax/cordic_exact_sum" + suffix, vocab, [&] {
+            exact_sum.computeSoftmax(logits.data(), probs.data(), vocab);
+            g_sink = probs[0];
+        });
+        std::vector<CORDICFloat16> half_logits(vocab);
+        CORDICHalf::fromFloat(logits.data(), half_logits.data(), vocab);
+        runner.run("softmax/cordic_f16" + suffix, vocab, [&] {
+            cordic.computeSoftmax(half_logits.data(), probs.data(), vocab);
+            g_sink = probs[0];
+        });
+        std::vector<int16_t> quantized_logits(vocab);
+        std::vector<uint16_t> quantized_probs(vocab);
+        for (size_t i = 0; i < vocab; i++) {
+            quantized_logits[i] = static_cast<int16_t>(std::lround(logits[i] * 256.0f));
+        }
+        runner.run("softmax/cordic_int16" + suffix, vocab, [&] {
+            integer_softmax.computeSoftmax(quantized_logits.data(), quantized_probs.data(), vocab);
+            g_sink = quantized_probs[0];
+        });
+        runner.run("softmax/cordic_online" + suffix, vocab, [&] {
+            cordic.computeSoftmaxOnline(logits.data(), probs.data(), vocab);
+            g_sink = probs[0];
+        });
+        runner.run("log_softmax/cordic" + suffix, vocab, [&] {
+            cordic.computeLogSoftmax(logits.data(), probs.data(), vocab);
+            g_sink = probs[0];
+        });
+        runner.run("log_softmax/cordic_softmax_logf" + suffix, vocab, [&] {
+            cordic.computeSoftmax(logits.data(), probs.data(), vocab);
+            for (size_t i = 0; i < vocab; i++) {
+                probs[i] = std::log(probs[i]);
+            }
+            g_sink = probs[0];
+        });
+        runner.run("softmax/std_exp" + suffix, vocab, [&] {
+            softmaxStdExp(logits.data(), probs.data(), vocab);
+            g_sink = probs[0];
+        });
+        runner.run("softmax/float_vectorized" + suffix, vocab, [&] {
+            softmaxVectorized(logits.data(), probs.data(), vocab);
+            g_sink = probs[0];
+        });
+    }
+}
+
+static void benchAttention(BenchRunner& runner) {
+    // Prefill causal [n_head × n_q, n_kv] con n_q = n_kv: ~la mitad enmascarada
+    const size_t n_head = 8;
+    const size_t context_sizes[] = {512, 1024};
+    const float scale = 0.125f;
+    CORDICSoftmax cordic(false);
+    cordic.setParallelConfig(CORDICParallelConfig(1, 16384));
+
+    for (size_t n_kv : context_sizes) {
+        const size_t rows = n_head * n_kv;
+        const std::string suffix = "/" + std::to_string(n_kv);
+        std::vector<float> kq = randomLogits(rows * n_kv, static_cast<unsigned>(n_kv));
+        std::vector<float> probs(rows * n_kv);
+        std::vector<float> mask(n_kv * n_kv);
+        for (size_t q = 0; q < n_kv; q++) {
+            for (size_t c = 0; c < n_kv; c++) {
+                mask[q * n_kv + c] = c > q ? -std::numeric_limits<float>::infinity() : 0.0f;
+            }
+        }
+        runner.run("attention/rows_mask" + suffix, rows * n_kv, [&] {
+            cordic.computeSoftmaxRows(kq.data(), probs.data(), rows, n_kv, n_kv, scale,
+                                      mask.data(), n_kv, n_kv);
+            g_sink = probs[0];
+        });
+        runner.run("attention/rows_causal" + suffix, rows * n_kv, [&] {
+            cordic.computeSoftmaxRowsCausal(kq.data(), probs.data(), rows, n_kv, n_kv,
+                                            CORDICCausalMask(0, n_kv), scale);
+            g_sink = probs[0];
+        });
+        runner.run("attention/rows_window256" + suffix, rows * n_kv, [&] {
+            cordic.computeSoftmaxRowsCausal(kq.data(), probs.data(), rows, n_kv, n_kv,
+                                            CORDICCausalMask(0, n_kv, 256), scale);
+            g_sink = probs[0];
+        });
+    }
+
+    // Decodificación: una consulta contra n_kv = 32K claves, d = 128
+    const size_t head_dim = 128;
+    const size_t decode_kv = 32768;
+    const float decode_scale = 1.0f / std::sqrt(static_cast<float>(head_dim));
+    std::vector<float> query = randomLogits(head_dim, 1);
+    std::vector<float> keys = randomLogits(decode_kv * head_dim, 2);
+    std::vector<float> values = randomLogits(decode_kv * head_dim, 3);
+    std::vector<float> row(decode_kv);
+    std::vector<float> output(head_dim);
+    const CORDICAttentionShape shape(head_dim, decode_kv);
+    CORDICFlashAttention attention(cordic);
+    runner.run("attention/decode_flash/32768", decode_kv, [&] {
+        attention.computeQuery(query.data(), keys.data(), values.data(), shape, decode_scale,
+                               output.data());
+        g_sink = output[0];
+    });
+    runner.run("attention/decode_materialized/32768", decode_kv, [&] {
+        attention.computeQueryMaterialized(query.data(), keys.data(), values.data(), shape,
+                                           decode_scale, row.data(), output.data());
+        g_sink = output[0];
+    });
+}
+
+static void benchThreads(BenchRunner& runner) {
+    const size_t vocab_sizes[] = {32000, 256000};
+    const size_t max_threads = std::max<size_t>(1, runner.getOptions().max_threads);
+
+    for (size_t vocab : vocab_sizes) {
+        std::vector<float> logits = randomLogits(vocab, static_cast<unsigned>(vocab));
+        std::vector<float> probs(vocab);
+        for (size_t threads = 1; threads <= max_threads; threads++) {
+            CORDICSoftmax cordic(false);
+            cordic.setParallelConfig(CORDICParallelConfig(threads, 16384));
+            runner.run("softmax_threads/" + std::to_string(threads) + "/" + std::to_string(vocab),
+                       vocab, [&] {
+                           cordic.computeSoftmaxParallel(logits.data(), probs.data(), vocab);
+                           g_sink = probs[0];
+                       });
+        }
+    }
+}
+
+static void benchSampling(BenchRunner& runner) {
+    const size_t vocab_sizes[] = {32000, 128000, 256000};
+    const CORDICSamplingParams params(40, 0.95f);
+    CORDICSoftmax cordic(false);
+    CORDICTopKSampler sampler(cordic);
+    CORDICCandidates candidates;
+
+    for (size_t vocab : vocab_sizes) {
+        const std::string suffix = "/" + std::to_string(vocab);
+        std::vector<float> logits = randomLogits(vocab, static_cast<unsigned>(vocab));
+        runner.run("sampling/fused" + suffix, vocab, [&] {
+            sampler.select(logits.data(), vocab, params, candidates);
+            g_sink = candidates.probabilities[0];
+        });
+        runner.run("sampling/exact" + suffix, vocab, [&] {
+            sampler.select(logits.data(), vocab, params, candidates, CORDICSamplingMode::EXACT);
+            g_sink = candidates.probabilities[0];
+        });
+    }
+}
+
+//==============================================================================
+// MAIN
+//==============================================================================
+
+static bool parseOptions(int argc, char** argv, BenchOptions& options) {
+    for (int i = 1; i < argc; i++) {
+        const std::string arg = argv[i];
+        auto value = [&](const char* prefix) -> const char* {
+            const size_t length = std::strlen(prefix);
+            return arg.compare(0, length, prefix) == 0 ? argv[i] + length : nullptr;
+        };
+        if (const char* v = value("--json=")) {
+            options.json_path = v;
+        } else if (const char* v = value("--min-time=")) {
+            options.min_time = std::atof(v);
+        } else if (const char* v = value("--max-threads=")) {
+            options.max_threads = std::strtoul(v, nullptr, 10);
+        } else if (const char* v = value("--filter=")) {
+            options.filter = v;
+        } else {
+            std::cerr << "Opción desconocida: " << arg << "\n"
+                      << "Uso: " << argv[0]
+                      << " [--json=FICHERO|-] [--min-time=S] [--max-threads=N] [--filter=TEXTO]"
+                      << std::endl;
+            return false;
+        }
+    }
+    return true;
+}
+
+int main(int argc, char** argv) {
+    BenchOptions options;
+    if (!parseOptions(argc, argv, options)) {
+        return 1;
+    }
+
+    BenchRunner runner(options);
+    std::ostream& out = runner.tableStream();
+    out << "========================================" << std::endl;
+    out << "BENCH: suite CORDIC Softmax" << std::endl;
+    out << "========================================" << std::endl;
+    out << "Kernel exp: " << CORDICSIMD::kernelName(CORDICSoftmax::getActiveKernel())
+        << (CORDICSIMD::isKernelForced() ? " (CORDIC_BACKEND)" : "")
+        << ", hilos máx: " << options.max_threads
+        << ", tiempo mínimo: " << options.min_time << " s" << std::endl << std::endl;
+
+    runner.printHeader();
+    benchExp(runner);
+    benchSoftmax(runner);
+    benchAttention(runner);
+    benchThreads(runner);
+    benchSampling(runner);
+
+    if (options.json_path == "-") {
+        runner.writeJson(std::cout, argv[0]);
+    } else if (!options.json_path.empty()) {
+        std::ofstream file(options.json_path);
+        if (!file) {
+            std::cerr << "No se puede escribir " << options.json_path << std::endl;
+            return 1;
+        }
+        runner.writeJson(file, argv[0]);
+        out << "\nJSON: " << options.json_path << std::endl;
+    }
+
+    return 0;
+}
@@ -0,0 +1,290 @@
+/**
+ * @file bench_exp.cpp
+ * @brief Microbenchmark de e^x: pipeline de diagnóstico vs ruta rápida
+ * 
+ * Mide ns/elemento y asignaciones dinámicas por elemento de:
+ * - Pipeline completo (performIterations + processResults)
+ * - CORDICSoftmax::calculateExpFast
+ * - Lotes por tiles SoA (CORDICSoftmax::calculateExpBatchTiled)
+ * - Kernels por lotes (AVX2 / AVX-512) vía CORDICSIMD::runKernel
+ * - std::exp (referencia)
+ * 
+ * Además compara en ciclos por elemento (TSC en x86) el postprocesado con
+ * K = √|X²-Y²|, divisiones y 2^n frente al de ganancia plegada.
+ */
+
+#include "cordic_softmax.h"
+#include "cordic_tables.h"
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <new>
+#include <random>
+#include <string>
+#include <vector>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define BENCH_HAS_TSC 1
+#endif
+
+//==============================================================================
+// CONTADOR DE ASIGNACIONES
+//==============================================================================
+
+static size_t g_allocations = 0;
+
+void* operator new(size_t size) {
+    g_allocations++;
+    if (void* ptr = std::malloc(size)) {
+        return ptr;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* ptr) noexcept {
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, size_t) noexcept {
+    std::free(ptr);
+}
+
+//==============================================================================
+// UTILIDADES
+//==============================================================================
+
+struct BenchResult {
+    double ns_per_element;
+    double allocs_per_element;
+    float checksum;
+};
+
+template <typename Func>
+BenchResult runBench(const std::vector<float>& inputs, int repetitions, Func&& func) {
+    BenchResult result{0.0, 0.0, 0.0f};
+    size_t allocs_before = g_allocations;
+    
+    auto start = std::chrono::steady_clock::now();
+    for (int rep = 0; rep < repetitions; rep++) {
+        for (float x : inputs) {
+            result.checksum += func(x);
+        }
+    }
+    auto end = std::chrono::steady_clock::now();
+    
+    double elements = static_cast<double>(inputs.size()) * repetitions;
+    result.ns_per_element = std::chrono::duration<double, std::nano>(end - start).count() / elements;
+    result.allocs_per_element = (g_allocations - allocs_before) / elements;
+    return result;
+}
+
+void printRow(const char* name, const BenchResult& r) {
+    std::cout << std::left << std::setw(28) << name << std::right
+              << std::fixed << std::setprecision(2) << std::setw(12) << r.ns_per_element
+              << std::setw(14) << r.allocs_per_element
+              << std::setw(16) << std::scientific << std::setprecision(4) << r.checksum
+              << std::endl;
+}
+
+/**
+ * @brief Contador de ciclos (TSC) o, sin él, nanosegundos
+ */
+static inline uint64_t readCycles() {
+#if defined(BENCH_HAS_TSC)
+    return __rdtsc();
+#else
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count());
+#endif
+}
+
+template <typename Func>
+double cyclesPerElement(size_t count, int repetitions, float& checksum, Func&& func) {
+    uint64_t start = readCycles();
+    for (int rep = 0; rep < repetitions; rep++) {
+        for (size_t i = 0; i < count; i++) {
+            checksum += func(i);
+        }
+    }
+    return static_cast<double>(readCycles() - start) / (static_cast<double>(count) * repetitions);
+}
+
+//==============================================================================
+// MAIN
+//==============================================================================
+
+int main(int argc, char** argv) {
+    const size_t num_inputs = (argc > 1) ? std::strtoul(argv[1], nullptr, 10) : 65536;
+    const int repetitions = (argc > 2) ? std::atoi(argv[2]) : 10;
+    
+    // Logits estabilizados típicos de softmax: x - max ≤ 0
+    std::mt19937 gen(42);
+    std::normal_distribution<float> dist(0.0f, 3.0f);
+    std::vector<float> inputs(num_inputs);
+    for (float& x : inputs) {
+        x = -std::abs(dist(gen));
+    }
+    
+    CORDICSoftmax cordic(false);
+    CORDICIterator iterator;
+    
+    std::cout << "========================================" << std::endl;
+    std::cout << "BENCH: CORDIC exp por elemento" << std::endl;
+    std::cout << "========================================" << std::endl;
+    std::cout << "Elementos: " << num_inputs << " x " << repetitions << " repeticiones" << std::endl;
+    std::cout << "\n" << std::left << std::setw(28) << "Ruta" << std::right
+              << std::setw(12) << "ns/elem" << std::setw(14) << "allocs/elem"
+              << std::setw(16) << "checksum" << std::endl;
+    std::cout << std::string(70, '-') << std::endl;
+    
+    BenchResult pipeline = runBench(inputs, repetitions, [&](float x) {
+        PreprocessResult prep = CORDICPreprocessor::processInput(x, false);
+        CORDICState initial = CORDICPreprocessor::initializeCORDICState(prep);
+        IterationResult iter_result = iterator.performIterations(initial, false);
+        return CORDICPostprocessor::processResults(iter_result, prep, false).exponential_value;
+    });
+    printRow("pipeline (antes)", pipeline);
+    
+    BenchResult fast = runBench(inputs, repetitions, [&](float x) {
+        return cordic.calculateExpFast(x);
+    });
+    printRow("calculateExpFast (después)", fast);
+    
+    BenchResult fixed = runBench(inputs, repetitions, [](float x) {
+        PreprocessResult prep = CORDICPreprocessor::processInput(x, false);
+        CORDICRawState state(FixedPoint16(1.0f).getRaw(), 0, prep.mapped_input.getRaw());
+        CORDICIterator::performIterationsFixed(state);
+        return CORDICPostprocessor::computeExponential(state, prep);
+    });
+    printRow("secuencia fija desenrollada", fixed);
+    
+    // Kernels por lotes: una llamada por repetición sobre todo el vector
+    std::vector<float> outputs(num_inputs);
+    {
+        BenchResult tiled{0.0, 0.0, 0.0f};
+        size_t allocs_before = g_allocations;
+        auto start = std::chrono::steady_clock::now();
+        for (int rep = 0; rep < repetitions; rep++) {
+            cordic.calculateExpBatchTiled(inputs.data(), outputs.data(), num_inputs);
+            for (float v : outputs) {
+                tiled.checksum += v;
+            }
+        }
+        auto end = std::chrono::steady_clock::now();
+        double elements = static_cast<double>(num_inputs) * repetitions;
+        tiled.ns_per_element = std::chrono::duration<double, std::nano>(end - start).count() / elements;
+        tiled.allocs_per_element = (g_allocations - allocs_before) / elements;
+        printRow("batch tiles SoA", tiled);
+    }
+    CORDICKernelTables tables(iterator.getAngleTable());
+    const CORDICKernel kernels[] = {CORDICKernel::SSE41, CORDICKernel::AVX2, CORDICKernel::AVX512,
+                                    CORDICKernel::NEON};
+    for (CORDICKernel kernel : kernels) {
+        if (!CORDICSIMD::isKernelSupported(kernel)) {
+            continue;
+        }
+        
+        BenchResult batch{0.0, 0.0, 0.0f};
+        size_t allocs_before = g_allocations;
+        auto start = std::chrono::steady_clock::now();
+        for (int rep = 0; rep < repetitions; rep++) {
+            CORDICSIMD::runKernel(kernel, tables, inputs.data(), outputs.data(), num_inputs);
+            for (float v : outputs) {
+                batch.checksum += v;
+            }
+        }
+        auto end = std::chrono::steady_clock::now();
+        double elements = static_cast<double>(num_inputs) * repetitions;
+        batch.ns_per_element = 
+            std::chrono::duration<double, std::nano>(end - start).count() / elements;
+        batch.allocs_per_element = (g_allocations - allocs_before) / elements;
+        
+        std::string name = std::string("batch ") + CORDICSIMD::kernelName(kernel);
+        printRow(name.c_str(), batch);
+    }
+    
+    BenchResult folded = runBench(inputs, repetitions, [&](float x) {
+        return cordic.calculateExpFolded(x);
+    });
+    printRow("ganancia plegada", folded);
+    
+    BenchResult reference = runBench(inputs, repetitions, [](float x) {
+        return std::exp(x);
+    });
+    printRow("std::exp", reference);
+    
+    std::cout << std::string(70, '-') << std::endl;
+    std::cout << "Speedup ruta rápida: " << std::fixed << std::setprecision(2)
+              << pipeline.ns_per_element / fast.ns_per_element << "x" << std::endl;
+    std::cout << "Checksums idénticos: " 
+              << (pipeline.checksum == fast.checksum ? "✓" : "✗") << std::endl;
+    
+    // Solo el postprocesado, sobre estados finales precalculados
+    std::vector<PreprocessResult> preps(num_inputs);
+    std::vector<CORDICRawState> greedy_states(num_inputs);
+    std::vector<CORDICRawState> folded_states(num_inputs);
+    for (size_t i = 0; i < num_inputs; i++) {
+        preps[i] = CORDICPreprocessor::processInput(inputs[i], false);
+        const int16_t z = preps[i].mapped_input.getRaw();
+        greedy_states[i] = CORDICRawState(FixedPoint16(1.0f).getRaw(), 0, z);
+        iterator.performIterationsFast(greedy_states[i]);
+        folded_states[i] = CORDICRawState(CORDICTables::FIXED_SCHEDULE_FOLDED_X0, 0, z);
+        CORDICIterator::performIterationsFixed(folded_states[i]);
+    }
+    
+    float post_checksum = 0.0f;
+    double post_k = cyclesPerElement(num_inputs, repetitions, post_checksum, [&](size_t i) {
+        return CORDICPostprocessor::computeExponential(greedy_states[i], preps[i]);
+    });
+    double post_folded = cyclesPerElement(num_inputs, repetitions, post_checksum, [&](size_t i) {
+        return CORDICPostprocessor::computeExponentialFolded(folded_states[i], preps[i]);
+    });
+    double full_fast = cyclesPerElement(num_inputs, repetitions, post_checksum, [&](size_t i) {
+        return cordic.calculateExpFast(inputs[i]);
+    });
+    double full_folded = cyclesPerElement(num_inputs, repetitions, post_checksum, [&](size_t i) {
+        return cordic.calculateExpFolded(inputs[i]);
+    });
+    
+#if defined(BENCH_HAS_TSC)
+    const char* unit = "ciclos TSC/elem";
+#else
+    const char* unit = "ns/elem";
+#endif
+    std::cout << "\nPostprocesado (" << unit << "):" << std::endl;
+    std::cout << std::fixed << std::setprecision(1);
+    std::cout << "  K = √|X²-Y²|, X/K, Y/K, 2^n:   " << post_k << std::endl;
+    std::cout << "  Ganancia plegada, X+Y, 2^n bits: " << post_folded << std::endl;
+    std::cout << "e^x completo (" << unit << "):" << std::endl;
+    std::cout << "  calculateExpFast:   " << full_fast << std::endl;
+    std::cout << "  calculateExpFolded: " << full_folded << std::endl;
+    std::cout << "  (checksum " << std::scientific << post_checksum << ")" << std::endl;
+
+    // Solo las rotaciones greedy, con cada estrategia de selección
+    std::vector<CORDICRawState> initial_states(num_inputs);
+    for (size_t i = 0; i < num_inputs; i++) {
+        initial_states[i] = CORDICRawState(FixedPoint16(1.0f).getRaw(), 0,
+                                           preps[i].mapped_input.getRaw());
+    }
+    float select_checksum = 0.0f;
+    auto rotateWith = [&](CORDICGreedySelection selection) {
+        return cyclesPerElement(num_inputs, repetitions, select_checksum, [&](size_t i) {
+            CORDICRawState state = initial_states[i];
+            iterator.performIterationsFast(state, selection);
+            return static_cast<float>(state.X + state.Y);
+        });
+    };
+    double rotate_scan = rotateWith(CORDICGreedySelection::LINEAR_SCAN);
+    double rotate_clz = rotateWith(CORDICGreedySelection::LEADING_ZEROS);
+
+    std::cout << "Rotaciones greedy (" << unit << "):" << std::endl;
+    std::cout << std::fixed << std::setprecision(1);
+    std::cout << "  recorrido lineal de umbrales: " << rotate_scan << std::endl;
+    std::cout << "  longitud en bits + 1 cmp:     " << rotate_clz << std::endl;
+    std::cout << "  (checksum " << std::scientific << select_checksum << ")" << std::endl;
+
+    return 0;
+}
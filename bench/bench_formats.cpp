@@ -0,0 +1,92 @@
+/**
+ * @file bench_formats.cpp
+ * @brief Precisión y rendimiento de e^x por formato de punto fijo
+ *
+ * Para cada instanciación de CORDICFormatEngine mide el error relativo
+ * (máximo y medio) frente a std::exp en double sobre [-20, 5] y los
+ * ns/elemento, junto al número de lanes que cabrían en un registro de 512 bits.
+ */
+
+#include "cordic_format.h"
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+struct FormatRow {
+    std::string name;
+    int word_bits;
+    int frac_bits;
+    int iterations;
+    double max_error;
+    double mean_error;
+    double ns_per_element;
+};
+
+template <typename Engine>
+FormatRow measureFormat(const char* name, const std::vector<float>& inputs, int repetitions) {
+    using Fixed = typename Engine::Fixed;
+    FormatRow row{name, Fixed::WORD_BITS, Fixed::FRAC_BITS, Engine::ITERATIONS, 0.0, 0.0, 0.0};
+
+    std::vector<float> outputs(inputs.size());
+    Engine::expBatch(inputs.data(), outputs.data(), inputs.size());
+    for (size_t i = 0; i < inputs.size(); i++) {
+        double reference = std::exp(static_cast<double>(inputs[i]));
+        double error = std::abs(outputs[i] - reference) / reference;
+        row.max_error = std::max(row.max_error, error);
+        row.mean_error += error;
+    }
+    row.mean_error /= inputs.size();
+
+    auto start = std::chrono::steady_clock::now();
+    for (int rep = 0; rep < repetitions; rep++) {
+        Engine::expBatch(inputs.data(), outputs.data(), inputs.size());
+    }
+    auto end = std::chrono::steady_clock::now();
+    row.ns_per_element = std::chrono::duration<double, std::nano>(end - start).count() /
+                         (static_cast<double>(inputs.size()) * repetitions);
+    return row;
+}
+
+int main(int argc, char** argv) {
+    const int repetitions = (argc > 1) ? std::atoi(argv[1]) : 5;
+
+    // Barrido uniforme de logits estabilizados típicos
+    std::vector<float> inputs;
+    for (float x = -20.0f; x <= 5.0f; x += 1e-3f) {
+        inputs.push_back(x);
+    }
+
+    std::cout << "========================================" << std::endl;
+    std::cout << "BENCH: e^x CORDIC por formato" << std::endl;
+    std::cout << "========================================" << std::endl;
+    std::cout << "Entradas: " << inputs.size() << " en [-20, 5], " << repetitions
+              << " repeticiones" << std::endl;
+
+    const FormatRow rows[] = {
+        measureFormat<CORDICFormatQ8_8>("Q8.8", inputs, repetitions),
+        measureFormat<CORDICFormatQ3_12>("Q3.12", inputs, repetitions),
+        measureFormat<CORDICFormatQ2_29>("Q2.29", inputs, repetitions),
+    };
+
+    std::cout << "\n" << std::left << std::setw(8) << "Formato" << std::right
+              << std::setw(6) << "Bits" << std::setw(8) << "Lanes" << std::setw(8) << "Iter"
+              << std::setw(14) << "Error máx" << std::setw(14) << "Error medio"
+              << std::setw(10) << "ns/elem" << std::endl;
+    std::cout << std::string(68, '-') << std::endl;
+    for (const FormatRow& row : rows) {
+        std::cout << std::left << std::setw(8) << row.name << std::right
+                  << std::setw(6) << row.word_bits
+                  << std::setw(8) << 512 / row.word_bits
+                  << std::setw(8) << row.iterations
+                  << std::setw(14) << std::scientific << std::setprecision(3) << row.max_error
+                  << std::setw(14) << row.mean_error
+                  << std::setw(10) << std::fixed << std::setprecision(2) << row.ns_per_element
+                  << std::endl;
+    }
+
+    return 0;
+}
@@ -0,0 +1,101 @@
+/**
+ * @file bench_lut.cpp
+ * @brief Compromiso velocidad / precisión del e^x híbrido tabla + CORDIC
+ *
+ * Para cada número de bits de residuo r mide el tamaño de la tabla, las
+ * iteraciones de la cola, el error relativo (máximo y medio) frente a
+ * std::exp en double sobre [-14, 5] y los ns/elemento; como referencia, la
+ * ruta greedy calculateExpFast y la secuencia fija con ganancia plegada.
+ */
+
+#include "cordic_lut.h"
+#include "cordic_softmax.h"
+#include "cordic_tables.h"
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+struct LutRow {
+    std::string name;
+    size_t table_bytes;
+    int iterations;
+    double max_error;
+    double mean_error;
+    double ns_per_element;
+};
+
+template <typename ExpFunc>
+LutRow measure(const std::string& name, size_t table_bytes, int iterations,
+               const std::vector<float>& inputs, int repetitions, ExpFunc&& exp_func) {
+    LutRow row{name, table_bytes, iterations, 0.0, 0.0, 0.0};
+    std::vector<float> outputs(inputs.size());
+
+    for (size_t i = 0; i < inputs.size(); i++) {
+        outputs[i] = exp_func(inputs[i]);
+        double reference = std::exp(static_cast<double>(inputs[i]));
+        double error = std::abs(outputs[i] - reference) / reference;
+        row.max_error = std::max(row.max_error, error);
+        row.mean_error += error;
+    }
+    row.mean_error /= inputs.size();
+
+    auto start = std::chrono::steady_clock::now();
+    for (int rep = 0; rep < repetitions; rep++) {
+        for (size_t i = 0; i < inputs.size(); i++) {
+            outputs[i] = exp_func(inputs[i]);
+        }
+    }
+    auto end = std::chrono::steady_clock::now();
+    row.ns_per_element = std::chrono::duration<double, std::nano>(end - start).count() /
+                         (static_cast<double>(inputs.size()) * repetitions);
+    return row;
+}
+
+int main(int argc, char** argv) {
+    const int repetitions = (argc > 1) ? std::atoi(argv[1]) : 5;
+
+    std::vector<float> inputs;
+    for (float x = -14.0f; x <= 5.0f; x += 1e-3f) {
+        inputs.push_back(x);
+    }
+
+    std::cout << "========================================" << std::endl;
+    std::cout << "BENCH: e^x híbrido tabla + cola CORDIC" << std::endl;
+    std::cout << "========================================" << std::endl;
+    std::cout << "Entradas: " << inputs.size() << " en [-14, 5], " << repetitions
+              << " repeticiones" << std::endl;
+
+    std::vector<LutRow> rows;
+    CORDICSoftmax cordic(false);
+    rows.push_back(measure("greedy (calculateExpFast)", 0, CORDICConfig::MAX_ITERATIONS, inputs,
+                           repetitions, [&](float x) { return cordic.calculateExpFast(x); }));
+    rows.push_back(measure("fija plegada", 0, CORDICTables::FIXED_SCHEDULE_LENGTH, inputs,
+                           repetitions, [&](float x) { return cordic.calculateExpFolded(x); }));
+    for (int r = CORDICLutExp::MAX_RESIDUAL_BITS; r >= 0; r--) {
+        CORDICLutExp lut(r);
+        rows.push_back(measure("LUT r = " + std::to_string(r), lut.getTableBytes(),
+                               lut.getTailIterations(), inputs, repetitions,
+                               [&](float x) { return lut.calculateExp(x); }));
+    }
+
+    std::cout << "\n" << std::left << std::setw(28) << "Ruta" << std::right
+              << std::setw(10) << "Tabla (B)" << std::setw(8) << "Iter"
+              << std::setw(14) << "Error máx" << std::setw(14) << "Error medio"
+              << std::setw(10) << "ns/elem" << std::endl;
+    std::cout << std::string(84, '-') << std::endl;
+    for (const LutRow& row : rows) {
+        std::cout << std::left << std::setw(28) << row.name << std::right
+                  << std::setw(10) << row.table_bytes
+                  << std::setw(8) << row.iterations
+                  << std::setw(14) << std::scientific << std::setprecision(3) << row.max_error
+                  << std::setw(14) << row.mean_error
+                  << std::setw(10) << std::fixed << std::setprecision(2) << row.ns_per_element
+                  << std::endl;
+    }
+
+    return 0;
+}
@@ -0,0 +1,78 @@
+/**
+ * @file bench_threads.cpp
+ * @brief Escalado de computeSoftmaxParallel de 1 a N hilos
+ *
+ * Para cada tamaño de vocabulario mide la latencia media del softmax
+ * paralelo con 1..N hilos, el speedup frente a 1 hilo y verifica que el
+ * resultado es idéntico bit a bit en todos los casos.
+ */
+
+#include "cordic_softmax.h"
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <vector>
+
+int main(int argc, char** argv) {
+    const size_t max_threads = (argc > 1) ? std::strtoul(argv[1], nullptr, 10)
+                                          : CORDICThreadPool::defaultThreadCount();
+    const size_t chunk_size = (argc > 2) ? std::strtoul(argv[2], nullptr, 10) : 16384;
+    const int repetitions = (argc > 3) ? std::atoi(argv[3]) : 20;
+    const size_t vocab_sizes[] = {32000, 128000, 150000, 256000};
+
+    std::cout << "========================================" << std::endl;
+    std::cout << "BENCH: softmax paralelo (1.." << max_threads << " hilos)" << std::endl;
+    std::cout << "========================================" << std::endl;
+    std::cout << "Chunk: " << chunk_size << " elementos, " << repetitions << " repeticiones"
+              << std::endl;
+    std::cout << "Kernel exp: " << CORDICSIMD::kernelName(CORDICSoftmax::getActiveKernel())
+              << (CORDICSIMD::isKernelForced() ? " (CORDIC_BACKEND)" : "") << std::endl;
+
+    std::mt19937 gen(42);
+    std::normal_distribution<float> dist(0.0f, 3.0f);
+
+    for (size_t vocab_size : vocab_sizes) {
+        std::vector<float> logits(vocab_size);
+        for (float& v : logits) {
+            v = dist(gen);
+        }
+        std::vector<float> baseline(vocab_size);
+        std::vector<float> probs(vocab_size);
+
+        std::cout << "\nVocabulario: " << vocab_size << std::endl;
+        std::cout << "Hilos\t| ms/softmax\t| Speedup\t| Determinista" << std::endl;
+        std::cout << std::string(56, '-') << std::endl;
+
+        double base_ms = 0.0;
+        for (size_t threads = 1; threads <= max_threads; threads++) {
+            CORDICSoftmax cordic(false);
+            cordic.setParallelConfig(CORDICParallelConfig(threads, chunk_size));
+
+            // Calentamiento: crea el pool y llena cachés
+            cordic.computeSoftmaxParallel(logits.data(), probs.data(), vocab_size);
+
+            auto start = std::chrono::steady_clock::now();
+            for (int rep = 0; rep < repetitions; rep++) {
+                cordic.computeSoftmaxParallel(logits.data(), probs.data(), vocab_size);
+            }
+            auto end = std::chrono::steady_clock::now();
+            double ms = std::chrono::duration<double, std::milli>(end - start).count() / repetitions;
+
+            if (threads == 1) {
+                base_ms = ms;
+                baseline = probs;
+            }
+            bool identical = std::memcmp(baseline.data(), probs.data(),
+                                         vocab_size * sizeof(float)) == 0;
+
+            std::cout << threads << "\t| " << std::fixed << std::setprecision(3) << ms
+                      << "\t\t| " << std::setprecision(2) << base_ms / ms << "x"
+                      << "\t\t| " << (identical ? "✓" : "✗") << std::endl;
+        }
+    }
+
+    return 0;
+}
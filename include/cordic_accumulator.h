@@ -0,0 +1,71 @@
+/**
+ * @file cordic_accumulator.h
+ * @brief Acumulador exacto en punto fijo ancho para sumas de exponenciales
+ *
+ * FUNCIÓN: Sumar floats no negativos (e^x del kernel CORDIC, opcionalmente
+ * con su factor 2^n aparte) sin redondeo intermedio, de modo que el
+ * resultado no dependa del orden de suma.
+ *
+ * ESTRATEGIA:
+ * - Entero sin signo de 384 bits (6 limbs de 64) con el bit 0 de peso 2^-192
+ * - Cada término m × 2^e (m de 24 bits) se suma desplazado a su posición:
+ *   dos limbs y propagación de acarreo, sin redondeo
+ * - Fusionar dos acumuladores es una suma entera: cualquier reparto por
+ *   chunks, hilos o carriles SIMD da el mismo entero
+ * - toFloat() redondea una sola vez al float más cercano (empates a par)
+ *
+ * Rango exacto: de 2^-192 (cubre los subnormales) a 2^191; un float finito
+ * cualquiera deja ≥ 2^63 términos de margen. Los bits por debajo de 2^-192
+ * de un término escalado por 2^n se truncan.
+ */
+
+#ifndef CORDIC_ACCUMULATOR_H
+#define CORDIC_ACCUMULATOR_H
+
+#include <cstdint>
+#include <cstddef>
+
+class CORDICExactAccumulator {
+public:
+    static constexpr int LIMBS = 6;
+    static constexpr int LSB_EXPONENT = -192;   // Peso del bit 0: 2^-192
+
+private:
+    uint64_t limbs[LIMBS];
+    float non_finite;   // Σ de los términos inf / NaN (0 si no hubo)
+
+public:
+    CORDICExactAccumulator() { reset(); }
+
+    void reset();
+
+    /**
+     * @brief acc += value × 2^exponent, exacto
+     *
+     * @param value Término ≥ 0 (inf / NaN se propagan a toFloat())
+     * @param exponent Potencia de 2 aplicada sin pasar por float
+     * @throws std::invalid_argument si value < 0
+     * @throws std::overflow_error si value × 2^exponent ≥ 2^128 (fuera del rango float)
+     */
+    void add(float value, int exponent = 0);
+
+    /**
+     * @brief Σ values[i] (mismo entero que add() uno a uno)
+     */
+    void add(const float* values, size_t size);
+
+    /**
+     * @brief acc += other: suma entera, conmutativa y asociativa
+     */
+    void merge(const CORDICExactAccumulator& other);
+
+    /**
+     * @brief Suma redondeada una vez al float más cercano (inf si no cabe)
+     */
+    float toFloat() const;
+
+    bool isZero() const;
+    bool operator==(const CORDICExactAccumulator& other) const;
+};
+
+#endif // CORDIC_ACCUMULATOR_H
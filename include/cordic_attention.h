@@ -0,0 +1,115 @@
+/**
+ * @file cordic_attention.h
+ * @brief Atención softmax(q·Kᵀ)·V por bloques de KV, estilo flash-attention
+ *
+ * FUNCIÓN: Calcular o = Σ_j softmax_j(scale × q·k_j) × v_j sin escribir la
+ * fila de probabilidades en memoria: cada bloque de claves se puntúa,
+ * exponencia y acumula sobre V mientras está en L1.
+ *
+ * ESTRATEGIA (por consulta, bloques de block_size claves):
+ * 1. s_j = scale × q·k_j para el bloque (buffer de block_size floats)
+ * 2. Referencia R = k × ln(2) con k = ⌈max / ln(2)⌉ (máximo acumulado, como
+ *    CORDICOnlineSoftmax); si k crece, acumulador y suma se multiplican
+ *    por 2^(k_ant - k): solo se ajusta el exponente de cada float
+ * 3. p_j = e^(s_j - R) con el kernel CORDIC por lotes; Σ p_j y o += p_j × v_j
+ * 4. Al final o /= Σ
+ *
+ * Es la referencia CPU de decodificación con contexto largo (32K+ claves):
+ * lee K y V una vez y no materializa P. Las claves con s_j = -inf aportan 0.
+ */
+
+#ifndef CORDIC_ATTENTION_H
+#define CORDIC_ATTENTION_H
+
+#include "cordic_softmax.h"
+#include <cstddef>
+#include <vector>
+
+/**
+ * @brief Dimensiones y strides de una cabeza de atención (float, por filas)
+ */
+struct CORDICAttentionShape {
+    size_t head_dim;       // d: elementos de cada fila de Q, K, V y salida
+    size_t kv_len;         // n_kv: claves / valores
+    size_t key_stride;     // Elementos entre filas de K (0 = head_dim)
+    size_t value_stride;   // Elementos entre filas de V (0 = head_dim)
+
+    CORDICAttentionShape(size_t dim, size_t kv, size_t k_stride = 0, size_t v_stride = 0)
+        : head_dim(dim), kv_len(kv), key_stride(k_stride), value_stride(v_stride) {}
+};
+
+class CORDICFlashAttention {
+public:
+    static constexpr size_t DEFAULT_BLOCK_SIZE = 256;
+
+private:
+    const CORDICSoftmax& engine;
+    size_t block_size;
+    std::vector<float> scores;        // Puntuaciones / probabilidades del bloque (L1)
+    std::vector<int> exponents;       // 2^n previo de las puntuaciones < -15
+    std::vector<float> accumulator;   // Σ p_j × v_j relativo a la referencia actual
+
+public:
+    /**
+     * @brief Constructor
+     * @param softmax Motor CORDIC de las exponenciales (no se modifica)
+     * @param block_size Claves por bloque
+     * @throws std::invalid_argument si block_size == 0
+     *
+     * Los buffers internos son de la instancia: una instancia por hilo.
+     */
+    explicit CORDICFlashAttention(const CORDICSoftmax& softmax,
+                                  size_t block_size = DEFAULT_BLOCK_SIZE);
+
+    /**
+     * @brief o = softmax(scale × q·Kᵀ)·V para una consulta, por bloques de KV
+     *
+     * @param query q (head_dim floats)
+     * @param keys Primera fila de K
+     * @param values Primera fila de V
+     * @param shape head_dim, n_kv y strides de K / V
+     * @param scale Factor de escala (p.ej. 1/√d)
+     * @param output o (head_dim floats); ceros si n_kv == 0 o todo es -inf
+     * @throws std::invalid_argument si head_dim == 0 o un stride < head_dim
+     */
+    void computeQuery(const float* query, const float* keys, const float* values,
+                      const CORDICAttentionShape& shape, float scale, float* output);
+
+    /**
+     * @brief Varias consultas [n_q, head_dim] con máscara causal opcional
+     *
+     * La consulta i solo ve las claves de su tramo en CORDICCausalMask (fila
+     * i, posición first_position + i % positions); sin máscara, todas.
+     *
+     * @param query_stride, output_stride Elementos entre filas (0 = head_dim)
+     * @throws std::invalid_argument como computeQuery, o si causal->positions == 0
+     */
+    void computeQueries(const float* queries, size_t num_queries, size_t query_stride,
+                        const float* keys, const float* values, const CORDICAttentionShape& shape,
+                        float scale, float* outputs, size_t output_stride,
+                        const CORDICCausalMask* causal = nullptr);
+
+    /**
+     * @brief Referencia materializada: fila P completa en memoria y luego P·V
+     *
+     * Puntuaciones de las n_kv claves, CORDICSoftmax::computeSoftmaxOnline sobre
+     * la fila y o = Σ p_j × v_j. Mismo resultado que computeQuery salvo redondeo
+     * (otra referencia de estabilización) y en que, como el softmax online,
+     * no reduce s_j - R < -15 (satura); sirve de comparación en tests y
+     * benchmarks.
+     *
+     * @param probabilities Buffer de n_kv floats para la fila P
+     */
+    void computeQueryMaterialized(const float* query, const float* keys, const float* values,
+                                  const CORDICAttentionShape& shape, float scale,
+                                  float* probabilities, float* output) const;
+
+    size_t getBlockSize() const { return block_size; }
+
+private:
+    void attendSpan(const float* query, const float* keys, const float* values, size_t head_dim,
+                    size_t key_stride, size_t value_stride, size_t begin, size_t end, float scale,
+                    float* output);
+};
+
+#endif // CORDIC_ATTENTION_H
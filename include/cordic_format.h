@@ -0,0 +1,167 @@
+/**
+ * @file cordic_format.h
+ * @brief Motor CORDIC e^x parametrizado por formato de punto fijo
+ *
+ * FUNCIÓN: Instanciar preprocesador, tabla de ángulos, iterador y
+ * postprocesador para un formato FixedPoint<Word, Frac> concreto, de modo
+ * que la precisión se pueda intercambiar por ancho de palabra (lanes SIMD o
+ * ancho del datapath en FPGA).
+ *
+ * ETAPAS:
+ * 1. Preprocesado: e^x = 2^n × e^x' con |x'| ≤ ln(2)/2 (misma reducción que
+ *    CORDICPreprocessor), x' cuantizado al formato
+ * 2. Iteración: secuencia fija k = 1..Frac desenrollada (cordic_tables.h)
+ * 3. Postprocesado: e^x' = (X + Y) / √(X² - Y²), escalado por 2^n; o bien
+ *    con la ganancia plegada en X₀ = 1/K, e^x' = X + Y (expFolded)
+ *
+ * Logaritmo (modo vectoring): v = m × 2^e con m ∈ [√½, √2), parte entera
+ * e × ln(2) exacta y ln(m) = 2 × arctanh((m - 1) / (m + 1)) acumulado en Z
+ * partiendo de X = m + 1, Y = m - 1 (|Y / X| ≤ 0.172).
+ *
+ * Formatos predefinidos:
+ * - Q3.12 en int16_t: el del pipeline (resolución 2.4e-4)
+ * - Q2.29 en int32_t: máxima precisión en 32 bits (1.9e-9)
+ * - Q8.8  en int16_t: signo + 7 bits enteros + 8 fraccionales (3.9e-3)
+ */
+
+#ifndef CORDIC_FORMAT_H
+#define CORDIC_FORMAT_H
+
+#include "cordic_types.h"
+#include "cordic_tables.h"
+#include "cordic_postprocessor.h"
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+
+template <typename Word, int Frac>
+class CORDICFormatEngine {
+public:
+    using Fixed = FixedPoint<Word, Frac>;
+    using Rotator = CORDICTables::FixedRotator<Word, Frac>;
+
+    static constexpr int ITERATIONS = Rotator::LENGTH;
+    static constexpr int WORD_BITS = Fixed::WORD_BITS;
+
+    /**
+     * @brief Entrada reducida: x' en el formato y exponente n
+     */
+    struct Reduced {
+        Word mapped_input;
+        int reduction_factor;
+    };
+
+    /**
+     * @brief e^x = 2^n × e^x' con |x'| ≤ ln(2)/2
+     *
+     * Mismo redondeo de n y ajuste fino que CORDICPreprocessor; sin
+     * saturación a ±15: el rango lo limita después ldexp sobre float.
+     */
+    static Reduced preprocess(float input) {
+        // |x| > 200 ya es 0 / inf en float: acota n sin cambiar el resultado
+        const float clamped = std::min(std::max(input, -200.0f), 200.0f);
+        int n = static_cast<int>(std::round(clamped * CORDICConfig::INV_LN2));
+        float mapped = clamped - n * CORDICConfig::LN2;
+
+        const float limit = CORDICConfig::CONVERGENCE_LIMIT;
+        while (mapped > limit) {
+            n++;
+            mapped -= CORDICConfig::LN2;
+        }
+        while (mapped < -limit) {
+            n--;
+            mapped += CORDICConfig::LN2;
+        }
+        return {Fixed(mapped).getRaw(), n};
+    }
+
+    /**
+     * @brief Secuencia fija sobre X = 1, Y = 0, Z = x'
+     */
+    static void iterate(Word& x, Word& y, Word& z) {
+        Rotator::rotate(x, y, z);
+    }
+
+    /**
+     * @brief e^x = 2^n × (X + Y) / √(X² - Y²)
+     */
+    static float postprocess(Word x, Word y, int reduction_factor) {
+        const double x_final = Fixed::resolution() * x;
+        const double y_final = Fixed::resolution() * y;
+        const double gain = std::sqrt(std::abs(x_final * x_final - y_final * y_final));
+        return static_cast<float>(std::ldexp((x_final + y_final) / gain, reduction_factor));
+    }
+
+    /**
+     * @brief e^x = (X + Y) × 2^n tras partir de X₀ = 1/K (ganancia plegada)
+     */
+    static float postprocessFolded(Word x, Word y, int reduction_factor) {
+        const float exp_mapped = static_cast<float>(x + y) * static_cast<float>(Fixed::resolution());
+        return CORDICPostprocessor::scaleByPowerOf2(exp_mapped, reduction_factor);
+    }
+
+    /**
+     * @brief e^x sin sqrt, divisiones ni pow por elemento
+     */
+    static float expFolded(float input) {
+        if (std::isnan(input)) {
+            return input;
+        }
+        Reduced reduced = preprocess(input);
+        Word x = Rotator::FOLDED_X0;
+        Word y = 0;
+        Word z = reduced.mapped_input;
+        iterate(x, y, z);
+        return postprocessFolded(x, y, reduced.reduction_factor);
+    }
+
+    static float exp(float input) {
+        if (std::isnan(input)) {
+            return input;
+        }
+        Reduced reduced = preprocess(input);
+        Word x = Fixed(1.0f).getRaw();
+        Word y = 0;
+        Word z = reduced.mapped_input;
+        iterate(x, y, z);
+        return postprocess(x, y, reduced.reduction_factor);
+    }
+
+    /**
+     * @brief ln(v) por CORDIC hiperbólico en modo vectoring
+     *
+     * ln(0) = -inf, ln(inf) = inf, ln(v < 0) y ln(NaN) = NaN.
+     */
+    static float log(float value) {
+        if (!(value > 0.0f) || std::isinf(value)) {
+            return value == 0.0f ? -INFINITY : (value > 0.0f ? value : NAN);
+        }
+        int exponent = 0;
+        double mantissa = std::frexp(static_cast<double>(value), &exponent);
+        if (mantissa < 0.70710678118654752) {
+            mantissa *= 2.0;
+            exponent--;
+        }
+        Word x = Fixed(mantissa + 1.0).getRaw();
+        Word y = Fixed(mantissa - 1.0).getRaw();
+        Word z = 0;
+        Rotator::vectorize(x, y, z);
+        return static_cast<float>(exponent * CORDICConfig::LN2 + 2.0 * Fixed::resolution() * z);
+    }
+
+    static void expBatch(const float* inputs, float* outputs, size_t size) {
+        for (size_t i = 0; i < size; i++) {
+            outputs[i] = exp(inputs[i]);
+        }
+    }
+};
+
+//==============================================================================
+// FORMATOS PREDEFINIDOS
+//==============================================================================
+
+using CORDICFormatQ3_12 = CORDICFormatEngine<int16_t, 12>;
+using CORDICFormatQ2_29 = CORDICFormatEngine<int32_t, 29>;
+using CORDICFormatQ8_8 = CORDICFormatEngine<int16_t, 8>;
+
+#endif // CORDIC_FORMAT_H
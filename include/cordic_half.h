@@ -0,0 +1,159 @@
+/**
+ * @file cordic_half.h
+ * @brief Logits y probabilidades en fp16 / bf16 (formatos de tensores de ggml)
+ *
+ * FUNCIÓN: Conversión fp16 / bf16 ↔ float por registros, sin buffer
+ * intermedio del tamaño de la fila: los lotes se convierten por bloques que
+ * viven en L1 justo antes de la reducción de rango del preprocesador.
+ *
+ * CONVERSIONES:
+ * - bf16 → float: 16 bits altos del float (un shift)
+ * - fp16 → float: reajuste del exponente (sesgo 15 → 127)
+ * - float → fp16 / bf16: redondeo al par más cercano, inf / NaN preservados
+ *
+ * Tipos envoltorio de uint16_t para distinguir sobrecargas; mismo tamaño y
+ * disposición que ggml_fp16_t / ggml_bf16_t. Solo C++ portable: las
+ * definiciones inline no dependen de los flags de ISA del cliente.
+ */
+
+#ifndef CORDIC_HALF_H
+#define CORDIC_HALF_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+struct CORDICFloat16 {
+    uint16_t bits;
+};
+
+struct CORDICBFloat16 {
+    uint16_t bits;
+};
+
+static_assert(sizeof(CORDICFloat16) == 2 && sizeof(CORDICBFloat16) == 2,
+              "Los tipos half deben ocupar 16 bits");
+
+namespace CORDICHalf {
+
+inline float bitsToFloat(uint32_t bits) {
+    float value;
+    std::memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+inline uint32_t floatToBits(float value) {
+    uint32_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    return bits;
+}
+
+//==============================================================================
+// ESCALARES
+//==============================================================================
+
+inline float toFloat(float value) {
+    return value;
+}
+
+inline float toFloat(CORDICBFloat16 value) {
+    return bitsToFloat(static_cast<uint32_t>(value.bits) << 16);
+}
+
+inline float toFloat(CORDICFloat16 value) {
+    const uint32_t sign = static_cast<uint32_t>(value.bits & 0x8000) << 16;
+    const uint32_t magnitude = value.bits & 0x7FFF;
+
+    if (magnitude >= 0x7C00) {
+        // inf / NaN: exponente a 255, payload desplazado
+        return bitsToFloat(sign | 0x7F800000 | ((magnitude & 0x3FF) << 13));
+    }
+    if (magnitude >= 0x0400) {
+        // Normal: sesgo 15 → 127
+        return bitsToFloat(sign | ((magnitude << 13) + ((127 - 15) << 23)));
+    }
+    // Subnormal (o cero): m × 2^-24 exacto en float
+    return bitsToFloat(sign | floatToBits(static_cast<float>(magnitude) * 0x1p-24f));
+}
+
+inline void store(float value, float& out) {
+    out = value;
+}
+
+inline void store(float value, CORDICBFloat16& out) {
+    const uint32_t bits = floatToBits(value);
+    if ((bits & 0x7FFFFFFF) > 0x7F800000) {
+        out.bits = static_cast<uint16_t>((bits >> 16) | 0x0040);  // NaN silencioso
+        return;
+    }
+    out.bits = static_cast<uint16_t>((bits + 0x7FFF + ((bits >> 16) & 1)) >> 16);
+}
+
+inline void store(float value, CORDICFloat16& out) {
+    uint32_t bits = floatToBits(value);
+    const uint32_t sign = bits & 0x80000000;
+    bits ^= sign;
+
+    uint32_t result;
+    if (bits >= (127 + 16) << 23) {
+        // ≥ 65520 redondea a inf; NaN → NaN silencioso
+        result = (bits > 0x7F800000) ? 0x7E00 : 0x7C00;
+    } else if (bits < (127 - 14) << 23) {
+        // Subnormal fp16: la suma alinea la mantisa y redondea al par
+        const uint32_t magic = ((127 - 15) + (23 - 10) + 1) << 23;
+        result = floatToBits(bitsToFloat(bits) + bitsToFloat(magic)) - magic;
+    } else {
+        // Normal: rebase del exponente y redondeo al par de los 13 bits bajos
+        const uint32_t mantissa_odd = (bits >> 13) & 1;
+        bits += (static_cast<uint32_t>(15 - 127) << 23) + 0xFFF + mantissa_odd;
+        result = bits >> 13;
+    }
+    out.bits = static_cast<uint16_t>(result | (sign >> 16));
+}
+
+template <typename Half>
+inline Half fromFloat(float value) {
+    Half out;
+    store(value, out);
+    return out;
+}
+
+//==============================================================================
+// BLOQUES
+//==============================================================================
+
+inline void toFloat(const float* input, float* output, size_t size) {
+    std::memcpy(output, input, size * sizeof(float));
+}
+
+inline void toFloat(const CORDICBFloat16* input, float* output, size_t size) {
+    for (size_t i = 0; i < size; i++) {
+        output[i] = toFloat(input[i]);
+    }
+}
+
+inline void toFloat(const CORDICFloat16* input, float* output, size_t size) {
+    for (size_t i = 0; i < size; i++) {
+        output[i] = toFloat(input[i]);
+    }
+}
+
+inline void fromFloat(const float* input, float* output, size_t size) {
+    std::memcpy(output, input, size * sizeof(float));
+}
+
+inline void fromFloat(const float* input, CORDICBFloat16* output, size_t size) {
+    for (size_t i = 0; i < size; i++) {
+        store(input[i], output[i]);
+    }
+}
+
+inline void fromFloat(const float* input, CORDICFloat16* output, size_t size) {
+    for (size_t i = 0; i < size; i++) {
+        store(input[i], output[i]);
+    }
+}
+
+}  // namespace CORDICHalf
+
+#endif // CORDIC_HALF_H
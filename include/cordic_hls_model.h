@@ -0,0 +1,459 @@
+/**
+ * @file cordic_hls_model.h
+ * @brief Modelo dorado entero, bit a bit, del datapath e^x para HLS / RTL
+ *
+ * FUNCIÓN: Referencia sintetizable de preprocesado → rotaciones →
+ * postprocesado con profundidad de pipeline fija, idéntica bit a bit a la
+ * ruta CPU de secuencia fija (CORDICSoftmax::calculateExpFolded). Es el
+ * único modelo contra el que se comprueba el RTL en co-simulación (ver
+ * tools/cordic_hls_vectors.cpp).
+ *
+ * ALCANCE: e^x con entrada float32 y Z en Q3.12. CORDICIntegerSoftmax
+ * (cordic_integer.h) es otro diseño, el softmax solo entero con rotaciones
+ * Q1.14 y reducción de rango entera: sus bits de e^x no coinciden con los
+ * de este modelo y no genera vectores para el RTL.
+ *
+ * DATAPATH (solo enteros, sin float, sqrt, divisiones ni tablas dinámicas):
+ * - PRE: bits float32 de x → n y Z₀ en Q3.12. Reproduce la aritmética
+ *   IEEE del preprocesador (x × 1/ln2 y x - n × ln2 en double, redondeo a
+ *   float) con enteros de 64 / 128 bits: mismo n y mismo Z₀
+ * - ROT k: FixedRotator<int16_t, 12, LastShift>::step, un paso por etapa
+ *   (15 etapas con N = 12), X₀ = 1/K plegado
+ * - POST: X + Y y empaquetado float32 con exponente n - 12 (redondeo al
+ *   par más cercano solo si el resultado es subnormal)
+ *
+ * PIPELINE: PIPELINE_DEPTH = LENGTH + 2 etapas con registro, II = 1.
+ * CORDICHLSPipeline simula los registros ciclo a ciclo.
+ *
+ * El ajuste fino de CORDICPreprocessor (bucle while) nunca actúa para
+ * |x| ≤ 15 y no forma parte del datapath: `cordic_hls_vectors --exhaustive`
+ * compara PRE con el preprocesador en los ~92M float que pasan por el mapeo.
+ */
+
+#ifndef CORDIC_HLS_MODEL_H
+#define CORDIC_HLS_MODEL_H
+
+#include "cordic_tables.h"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <utility>
+
+//==============================================================================
+// ARITMÉTICA ENTERA AUXILIAR
+//==============================================================================
+
+namespace CORDICHLSArith {
+
+/**
+ * @brief Entero sin signo de 128 bits (ap_uint<128> en HLS)
+ */
+struct Wide {
+    uint64_t hi;
+    uint64_t lo;
+};
+
+constexpr int bitLength(uint64_t v) {
+    int bits = 0;
+    while (v != 0) {
+        v >>= 1;
+        bits++;
+    }
+    return bits;
+}
+
+constexpr int bitLength(Wide v) {
+    return v.hi != 0 ? 64 + bitLength(v.hi) : bitLength(v.lo);
+}
+
+/**
+ * @brief a × b con a < 2^32 (producto 32 × 64 en dos mitades)
+ */
+constexpr Wide multiply(uint64_t a, uint64_t b) {
+    const uint64_t low = a * (b & 0xFFFFFFFFu);
+    const uint64_t high = a * (b >> 32);
+    const uint64_t lo = low + (high << 32);
+    return Wide{(high >> 32) + (lo < low ? 1u : 0u), lo};
+}
+
+constexpr bool testBit(Wide v, int i) {
+    return i >= 64 ? ((v.hi >> (i - 64)) & 1u) != 0 : ((v.lo >> i) & 1u) != 0;
+}
+
+/**
+ * @brief ¿Algún bit de [0, i) a 1?
+ */
+constexpr bool anyBelow(Wide v, int i) {
+    if (i >= 64) {
+        return v.lo != 0 || (i > 64 && (v.hi & ((uint64_t(1) << (i - 64)) - 1)) != 0);
+    }
+    return i > 0 && (v.lo & ((uint64_t(1) << i) - 1)) != 0;
+}
+
+constexpr Wide shiftRight(Wide v, int s) {
+    if (s == 0) {
+        return v;
+    }
+    if (s >= 64) {
+        return Wide{0, v.hi >> (s - 64)};
+    }
+    return Wide{v.hi >> s, (v.lo >> s) | (v.hi << (64 - s))};
+}
+
+constexpr Wide addPow2(Wide v, int i) {
+    const Wide addend = i >= 64 ? Wide{uint64_t(1) << (i - 64), 0} : Wide{0, uint64_t(1) << i};
+    const uint64_t lo = v.lo + addend.lo;
+    return Wide{v.hi + addend.hi + (lo < v.lo ? 1u : 0u), lo};
+}
+
+/**
+ * @brief Redondeo al par más cercano a `bits` bits significativos
+ *
+ * Devuelve el valor escalado: v ≈ resultado × 2^shift (shift ≥ 0).
+ */
+constexpr Wide roundToBits(Wide v, int bits, int& shift) {
+    shift = bitLength(v) > bits ? bitLength(v) - bits : 0;
+    if (shift == 0) {
+        return v;
+    }
+    Wide kept = shiftRight(v, shift);
+    const bool half = testBit(v, shift - 1);
+    const bool sticky = anyBelow(v, shift - 1);
+    if (half && (sticky || (kept.lo & 1u) != 0)) {
+        kept = addPow2(kept, 0);
+    }
+    return kept;
+}
+
+/**
+ * @brief |v| redondeado a `bits` bits significativos (al par), sin escalar
+ *
+ * v < 2^63: es la magnitud de un double / float de ese valor entero.
+ */
+constexpr uint64_t roundSignificant(uint64_t v, int bits) {
+    int shift = 0;
+    const Wide kept = roundToBits(Wide{0, v}, bits, shift);
+    return kept.lo << shift;
+}
+
+}  // namespace CORDICHLSArith
+
+//==============================================================================
+// ESTRUCTURAS
+//==============================================================================
+
+/**
+ * @brief Registro entre etapas: estado CORDIC de un elemento en vuelo
+ */
+struct CORDICHLSStage {
+    bool valid = false;
+    uint32_t input_bits = 0;    // Etiqueta: bits float32 de la entrada
+    int16_t x = 0;
+    int16_t y = 0;
+    int16_t z = 0;
+    int8_t reduction = 0;       // n de e^x = 2^n × e^x'
+    uint32_t output_bits = 0;   // Solo en la etapa POST
+};
+
+/**
+ * @brief X / Y / Z a la salida de PRE y de cada rotación, más el resultado
+ */
+template <int Length>
+struct CORDICHLSTrace {
+    uint32_t input_bits;
+    int8_t reduction;
+    std::array<int16_t, Length + 1> x;   // [0] = PRE, [i] = tras la rotación i
+    std::array<int16_t, Length + 1> y;
+    std::array<int16_t, Length + 1> z;
+    int32_t sum;                         // X + Y (Q3.12, 17 bits)
+    uint32_t output_bits;
+};
+
+//==============================================================================
+// MODELO COMBINACIONAL POR ETAPAS
+//==============================================================================
+
+/**
+ * @brief Etapas del datapath con la secuencia fija k = 1..LastShift
+ */
+template <int LastShift = CORDICConfig::FRAC_WIDTH>
+class CORDICHLSModel {
+public:
+    using Rotator = CORDICTables::FixedRotator<int16_t, CORDICConfig::FRAC_WIDTH, LastShift>;
+    using Trace = CORDICHLSTrace<Rotator::LENGTH>;
+
+    static constexpr int LENGTH = Rotator::LENGTH;
+    static constexpr int PIPELINE_DEPTH = LENGTH + 2;   // PRE + rotaciones + POST
+    static constexpr int16_t FOLDED_X0 = Rotator::FOLDED_X0;
+
+    // Constantes double del preprocesador como mantisas enteras exactas
+    static constexpr uint64_t LN2_MANTISSA =
+        static_cast<uint64_t>(CORDICConfig::LN2 * 9007199254740992.0);       // ln2 × 2^53
+    static constexpr uint64_t INV_LN2_MANTISSA =
+        static_cast<uint64_t>(CORDICConfig::INV_LN2 * 4503599627370496.0);   // 1/ln2 × 2^52
+
+    static_assert(LN2_MANTISSA >> 52 == 1 && INV_LN2_MANTISSA >> 52 == 1,
+                  "ln2 en [0.5, 1) y 1/ln2 en [1, 2): mantisas de 53 bits");
+
+    // |x| con bits ≤ DIRECT_MAX_ABS_BITS cumple |x| ≤ ln2/2 (sin mapeo):
+    // x = m × 2^-25 en [0.25, 0.5), m ≤ ln2 × 2^53 / 2^29
+    static constexpr uint32_t DIRECT_MAX_ABS_BITS =
+        (125u << 23) | static_cast<uint32_t>((LN2_MANTISSA >> 29) - (uint64_t(1) << 23));
+    static constexpr uint32_t SATURATION_ABS_BITS = 0x41700000u;   // 15.0f (validateInput)
+
+private:
+    /**
+     * @brief Z saturado como FixedPoint16(±SOFTMAX_MAX_LOGIT): ±8 fuera de Q3.12
+     */
+    static constexpr int16_t SATURATED_LOW = INT16_MIN;
+    static constexpr int16_t SATURATED_HIGH = INT16_MAX;
+
+public:
+    //--------------------------------------------------------------------------
+    // PRE
+    //--------------------------------------------------------------------------
+
+    /**
+     * @brief Bits float32 → n y Z₀ (X₀ = 1/K, Y₀ = 0)
+     *
+     * Igual que CORDICPreprocessor::processInput:
+     * - NaN, ±inf o |x| > 15: Z₀ = -8 si x < -8, +8 (saturado) si no; n = 0
+     * - |x| ≤ ln2/2: Z₀ = trunc(x × 2^12), n = 0
+     * - si no: n = round(x × 1/ln2) y Z₀ = trunc(float(x - n × ln2) × 2^12)
+     */
+    static CORDICHLSStage preprocess(uint32_t bits) {
+        using namespace CORDICHLSArith;
+
+        CORDICHLSStage stage;
+        stage.valid = true;
+        stage.input_bits = bits;
+        stage.x = FOLDED_X0;
+        stage.y = 0;
+
+        const bool negative = (bits >> 31) != 0;
+        const uint32_t abs_bits = bits & 0x7FFFFFFFu;
+        const int exponent = static_cast<int>(abs_bits >> 23);
+        const uint64_t mantissa = (abs_bits & 0x7FFFFFu) | (exponent != 0 ? 0x800000u : 0u);
+
+        if (abs_bits > SATURATION_ABS_BITS) {
+            // NaN no es < -8: satura arriba como en el preprocesador
+            const bool is_nan = abs_bits > 0x7F800000u;
+            stage.z = negative && !is_nan ? SATURATED_LOW : SATURATED_HIGH;
+            stage.reduction = 0;
+            return stage;
+        }
+
+        if (abs_bits <= DIRECT_MAX_ABS_BITS) {
+            // x × 2^12 truncado hacia 0: m × 2^(e - 150 + 12)
+            const int shift = 138 - exponent;
+            const int16_t magnitude = exponent == 0 || shift >= 24
+                ? int16_t(0) : static_cast<int16_t>(mantissa >> shift);
+            stage.z = negative ? static_cast<int16_t>(-magnitude) : magnitude;
+            stage.reduction = 0;
+            return stage;
+        }
+
+        // n = round(double(x × 1/ln2)): producto exacto de 77 bits → 53 bits
+        // → redondeo a entero alejándose de 0 (std::round)
+        int product_shift = 0;
+        const Wide product =
+            roundToBits(multiply(mantissa, INV_LN2_MANTISSA), 53, product_shift);
+        const int scale = 202 - exponent - product_shift;   // x / ln2 = product × 2^-scale
+        const uint64_t n_magnitude = shiftRight(addPow2(product, scale - 1), scale).lo;
+
+        // x' = float(double(x) - double(n × ln2)) en unidades de 2^-53
+        const uint64_t x_units = mantissa << (exponent - 97);
+        const uint64_t n_ln2 = roundSignificant(n_magnitude * LN2_MANTISSA, 53);
+        const bool below = x_units < n_ln2;
+        const uint64_t difference = below ? n_ln2 - x_units : x_units - n_ln2;
+        const uint64_t mapped = roundSignificant(roundSignificant(difference, 53), 24);
+
+        // FixedPoint16(x'): trunc(x' × 2^12) = |x'| en 2^-53 >> 41
+        const int16_t magnitude = static_cast<int16_t>(mapped >> 41);
+        stage.z = negative != below ? static_cast<int16_t>(-magnitude) : magnitude;
+        stage.reduction = static_cast<int8_t>(negative ? -static_cast<int>(n_magnitude)
+                                                       : static_cast<int>(n_magnitude));
+        return stage;
+    }
+
+    //--------------------------------------------------------------------------
+    // ROT
+    //--------------------------------------------------------------------------
+
+    /**
+     * @brief Etapa de rotación I (0 .. LENGTH - 1): shift y ángulo constantes
+     */
+    template <size_t I>
+    static CORDICHLSStage rotate(CORDICHLSStage stage) {
+        Rotator::template step<I>(stage.x, stage.y, stage.z);
+        return stage;
+    }
+
+    //--------------------------------------------------------------------------
+    // POST
+    //--------------------------------------------------------------------------
+
+    /**
+     * @brief sum × 2^exponent como bits float32
+     *
+     * Exacto para |sum| < 2^24 en rango normal; subnormales al par más
+     * cercano y desbordamiento a ±inf, como std::ldexp.
+     */
+    static uint32_t packFloat(int32_t sum, int exponent) {
+        using namespace CORDICHLSArith;
+
+        if (sum == 0) {
+            return 0;
+        }
+        const uint32_t sign = sum < 0 ? 0x80000000u : 0u;
+        const uint64_t magnitude = sum < 0 ? uint64_t(-static_cast<int64_t>(sum))
+                                           : static_cast<uint64_t>(sum);
+        const int top = bitLength(magnitude) - 1;
+        const int biased = 127 + top + exponent;
+        if (biased >= 255) {
+            return sign | 0x7F800000u;
+        }
+        if (biased > 0) {
+            return sign | (static_cast<uint32_t>(biased) << 23) |
+                   (static_cast<uint32_t>(magnitude << (23 - top)) & 0x7FFFFFu);
+        }
+
+        // Subnormal: unidades de 2^-149, al par más cercano
+        const int shift = exponent + 149;
+        if (shift >= 0) {
+            return sign | static_cast<uint32_t>(magnitude << shift);
+        }
+        if (-shift > bitLength(magnitude)) {
+            return sign;   // Por debajo de medio ulp subnormal
+        }
+        const int dropped = -shift;
+        uint64_t kept = magnitude >> dropped;
+        const uint64_t remainder = magnitude & ((uint64_t(1) << dropped) - 1);
+        const uint64_t half = uint64_t(1) << (dropped - 1);
+        if (remainder > half || (remainder == half && (kept & 1u) != 0)) {
+            kept++;   // Puede llegar a 2^23: el menor normal
+        }
+        return sign | static_cast<uint32_t>(kept);
+    }
+
+    /**
+     * @brief X + Y (e^x' en Q3.12) × 2^n → bits float32 de e^x
+     */
+    static CORDICHLSStage postprocess(CORDICHLSStage stage) {
+        stage.output_bits = packFloat(static_cast<int32_t>(stage.x) + stage.y,
+                                      stage.reduction - CORDICConfig::FRAC_WIDTH);
+        return stage;
+    }
+
+    //--------------------------------------------------------------------------
+    // DATAPATH COMPLETO
+    //--------------------------------------------------------------------------
+
+    /**
+     * @brief e^x: bits float32 de entrada → bits float32 de salida
+     */
+    static uint32_t evaluate(uint32_t input_bits) {
+        return postprocess(rotateAll(preprocess(input_bits),
+                                     std::make_index_sequence<LENGTH>{})).output_bits;
+    }
+
+    static float evaluate(float x) {
+        uint32_t bits;
+        std::memcpy(&bits, &x, sizeof(bits));
+        const uint32_t result = evaluate(bits);
+        float value;
+        std::memcpy(&value, &result, sizeof(value));
+        return value;
+    }
+
+    /**
+     * @brief Evaluación con X / Y / Z de cada etapa (vectores de co-simulación)
+     */
+    static Trace trace(uint32_t input_bits) {
+        Trace result{};
+        CORDICHLSStage stage = preprocess(input_bits);
+        result.input_bits = input_bits;
+        result.reduction = stage.reduction;
+        record(result, 0, stage);
+        stage = traceRotations(result, stage, std::make_index_sequence<LENGTH>{});
+        stage = postprocess(stage);
+        result.sum = static_cast<int32_t>(stage.x) + stage.y;
+        result.output_bits = stage.output_bits;
+        return result;
+    }
+
+private:
+    template <size_t... I>
+    static CORDICHLSStage rotateAll(CORDICHLSStage stage, std::index_sequence<I...>) {
+        ((stage = rotate<I>(stage)), ...);
+        return stage;
+    }
+
+    static void record(Trace& result, size_t index, const CORDICHLSStage& stage) {
+        result.x[index] = stage.x;
+        result.y[index] = stage.y;
+        result.z[index] = stage.z;
+    }
+
+    template <size_t... I>
+    static CORDICHLSStage traceRotations(Trace& result, CORDICHLSStage stage,
+                                         std::index_sequence<I...>) {
+        ((stage = rotate<I>(stage), record(result, I + 1, stage)), ...);
+        return stage;
+    }
+};
+
+//==============================================================================
+// PIPELINE CICLO A CICLO
+//==============================================================================
+
+/**
+ * @brief Registros de las PIPELINE_DEPTH etapas, un flanco por llamada a clock
+ *
+ * Un elemento que entra en el ciclo t sale en la llamada t + PIPELINE_DEPTH
+ * (latencia fija, II = 1); los huecos (valid = false) avanzan igual.
+ */
+template <int LastShift = CORDICConfig::FRAC_WIDTH>
+class CORDICHLSPipeline {
+public:
+    using Model = CORDICHLSModel<LastShift>;
+    static constexpr int DEPTH = Model::PIPELINE_DEPTH;
+
+private:
+    std::array<CORDICHLSStage, DEPTH> registers{};   // [0] = PRE ... [DEPTH - 1] = POST
+
+public:
+    /**
+     * @brief Flanco de reloj: carga una entrada y devuelve la etapa POST previa
+     *
+     * @param valid Hay entrada en este ciclo
+     * @param input_bits Bits float32 de x (ignorados si !valid)
+     * @return Registro POST antes del flanco (resultado de hace DEPTH ciclos)
+     */
+    CORDICHLSStage clock(bool valid, uint32_t input_bits) {
+        const CORDICHLSStage output = registers[DEPTH - 1];
+        std::array<CORDICHLSStage, DEPTH> next{};
+
+        next[0] = valid ? Model::preprocess(input_bits) : CORDICHLSStage();
+        advance(next, std::make_index_sequence<Model::LENGTH>{});
+        next[DEPTH - 1] = registers[DEPTH - 2].valid ? Model::postprocess(registers[DEPTH - 2])
+                                                     : CORDICHLSStage();
+        registers = next;
+        return output;
+    }
+
+    /**
+     * @brief Registros actuales (para volcar el estado en co-simulación)
+     */
+    const std::array<CORDICHLSStage, DEPTH>& state() const { return registers; }
+
+private:
+    template <size_t... I>
+    void advance(std::array<CORDICHLSStage, DEPTH>& next, std::index_sequence<I...>) const {
+        ((next[I + 1] = registers[I].valid ? Model::template rotate<I>(registers[I])
+                                           : CORDICHLSStage()), ...);
+    }
+};
+
+#endif // CORDIC_HLS_MODEL_H
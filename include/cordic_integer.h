@@ -0,0 +1,101 @@
+/**
+ * @file cordic_integer.h
+ * @brief Softmax solo con enteros: referencia de un datapath FPGA sin float
+ *
+ * FUNCIÓN: Logits cuantizados (int16, F bits fraccionales) → probabilidades
+ * cuantizadas (uint16, 1.0 = 2^15) sin ningún float en el bucle:
+ *
+ * 1. Máximo entero y d = (x - max) × 2^(14 - F) en Q1.14 (d ≤ 0, int32)
+ * 2. Reducción de rango entera: n = round(d × log2(e)) con 1/ln(2) en Q.8,
+ *    r = d - n × ln(2) con 4 bits de guarda, redondeado a Q1.14 (|r| ≤ 0.37)
+ * 3. e^r con la secuencia fija Q1.14 y X₀ = 1/K plegado: e^r = X + Y
+ * 4. e^d = (X + Y) × 2^16 >> -n en Q2.30 (uint32; -n ≥ 31 da 0 exacto)
+ * 5. Σ en uint64 (sin desbordamiento hasta 2^33 elementos)
+ * 6. Recíproco en punto fijo R = ⌊2^61 / Σ⌋ (una división por fila) y
+ *    p = (e × R + 2^45) >> 46: multiplicación 32 × 32 → 64 por elemento
+ *
+ * Toda la aritmética es entera y de ancho fijo, así que el resultado es el
+ * mismo en cualquier ISA (test_integer fija un vector de oro de esta ruta).
+ * Los pasos 2-4 se procesan por bloques SoA de int16 / int32 con shifts
+ * constantes: el compilador los vectoriza en las unidades enteras SIMD.
+ * expRaw() es la misma cuenta elemento a elemento (forma del pipeline HLS).
+ *
+ * La rotación usa Q1.14 en lugar del Q3.12 del pipeline float: |r| ≤ 0.37
+ * mantiene X, Y < 1.3, y los dos bits extra bajan el error de truncado
+ * acumulado en los ~19 pasos de 2.8e-3 a 7.3e-4 sin salir de int16.
+ *
+ * NO es el modelo dorado del RTL actual: el datapath e^x que se sintetiza
+ * (entrada float32, Z en Q3.12) se comprueba contra cordic_hls_model.h, y
+ * sus bits de e^x difieren de expRaw(). Esta clase fija el comportamiento
+ * de un softmax completo con entrada y salida enteras, para un pipeline
+ * que aún no tiene vectores de co-simulación.
+ */
+
+#ifndef CORDIC_INTEGER_H
+#define CORDIC_INTEGER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+class CORDICIntegerSoftmax {
+public:
+    // Formato interno de d, r y de la rotación (Q1.14 en int16)
+    static constexpr int INTERNAL_FRAC_BITS = 14;
+
+    // e^d en uint32 Q2.30 (1.0 = 2^30)
+    static constexpr int EXP_FRAC_BITS = 30;
+
+    // Probabilidades en uint16 (1.0 = 2^15)
+    static constexpr int PROB_FRAC_BITS = 15;
+    static constexpr uint16_t PROB_ONE = uint16_t(1) << PROB_FRAC_BITS;
+
+    // Exponente mínimo: 2^-31 × e^r < 2^-30, e^d se anula en Q2.30
+    static constexpr int32_t MIN_EXPONENT = -31;
+
+    // Elementos por bloque SoA (int16 x / y / z en L1)
+    static constexpr size_t BLOCK_SIZE = 256;
+
+private:
+    int input_frac_bits;
+    std::vector<uint32_t> exps;   // e^d de la fila (Q2.30), reutilizado
+
+    void expBlock(const int16_t* logits, int16_t max_logit, uint32_t* out, size_t size) const;
+
+public:
+    /**
+     * @brief Constructor
+     * @param input_frac_bits Bits fraccionales F de los logits, en [0, 14]
+     *                        (Q7.8 por defecto: ±128 con resolución 3.9e-3)
+     * @throws std::invalid_argument si F está fuera de rango
+     */
+    explicit CORDICIntegerSoftmax(int input_frac_bits = 8);
+
+    /**
+     * @brief e^d en Q2.30 para d ≤ 0 en Q1.14 (int32), elemento a elemento
+     *
+     * Referencia escalar de los pasos 2-4; la ruta por bloques produce los
+     * mismos bits.
+     */
+    static uint32_t expRaw(int32_t d_raw);
+
+    /**
+     * @brief Softmax entero de una fila
+     *
+     * @param logits Logits cuantizados con input_frac_bits bits fraccionales
+     * @param probabilities Salida en uint16 (1.0 = PROB_ONE)
+     * @param size Elementos
+     * @return Σ e^d en Q2.30 (denominador usado por el recíproco)
+     * @throws std::invalid_argument si size == 0
+     */
+    uint64_t computeSoftmax(const int16_t* logits, uint16_t* probabilities, size_t size);
+
+    /**
+     * @brief e^(x_i - max) en Q2.30 por bloques (pasos 1-4)
+     */
+    void computeExps(const int16_t* logits, uint32_t* outputs, size_t size) const;
+
+    int getInputFracBits() const { return input_frac_bits; }
+};
+
+#endif // CORDIC_INTEGER_H
@@ -13,27 +13,50 @@
 #ifndef CORDIC_ITERATOR_H
 #define CORDIC_ITERATOR_H
 
+#include "cordic_tables.h"
 #include "cordic_types.h"
+#include <cstddef>
 #include <vector>
 
+/**
+ * @brief Estrategia de selección greedy del ángulo en la ruta rápida
+ */
+enum class CORDICGreedySelection {
+    LEADING_ZEROS,  // Longitud en bits de |Z| + una comparación (por defecto)
+    LINEAR_SCAN     // Recorrido de los umbrales k = 1..15 (referencia)
+};
+
 /**
  * @class AngleTable
  * @brief Tabla de ángulos elementales para CORDIC hiperbólico
  * 
- * Contiene ángulos α_k = arctanh(2^-k) precomputados
+ * Los ángulos crudos y los umbrales greedy de la ruta rápida son los arrays
+ * constexpr de CORDICTables; las entradas double (AngleTableEntry) solo se
+ * conservan para la traza de debug e impresión. Inmutable tras la
+ * construcción: una misma instancia se puede leer desde varios hilos.
  */
 class AngleTable {
+public:
+    /**
+     * @brief Longitud en bits máxima de |Z| crudo (|INT16_MIN| = 2^15)
+     */
+    static constexpr int MAX_BIT_LENGTH = CORDICTables::GREEDY_MAX_BIT_LENGTH;
+    
 private:
+    // Entradas double: solo para debug (getEntry / printTable)
     std::vector<AngleTableEntry> table;
-    static constexpr int TABLE_SIZE = 15;
+    static constexpr int TABLE_SIZE = CORDICTables::TABLE_SIZE;
     
 public:
     AngleTable();
     
     /**
-     * @brief Construye la tabla de ángulos α_k = arctanh(2^-k)
+     * @brief Tabla compartida por todos los iteradores del proceso
+     * 
+     * Se construye una sola vez (inicialización estática segura entre hilos)
+     * y solo se lee después.
      */
-    void buildTable();
+    static const AngleTable& shared();
     
     /**
      * @brief Obtiene entrada de la tabla
@@ -44,6 +67,60 @@ public:
     int size() const { return static_cast<int>(table.size()); }
     bool hasIndex(int index) const;
     void printTable() const;
+    
+    /**
+     * @brief Ángulo α_k en Q3.12 crudo (sin bounds-check)
+     * @param index Índice (base 1), debe estar en [1, size()]
+     */
+    int16_t getRawAngle(int index) const { return CORDICTables::RAW_ANGLES[index]; }
+    
+    /**
+     * @brief Menor |Z| crudo que selecciona α_k en la búsqueda greedy
+     * @param index Índice (base 1), debe estar en [1, size()]
+     */
+    int32_t getGreedyThreshold(int index) const { return CORDICTables::GREEDY_THRESHOLDS[index]; }
+    
+    /**
+     * @brief Candidato k para |Z| de b bits: el resultado es k o k + 1
+     * @param bit_length b en [1, MAX_BIT_LENGTH]
+     */
+    int16_t getGreedyCandidate(int bit_length) const {
+        return CORDICTables::GREEDY_CANDIDATES[bit_length];
+    }
+    
+    /**
+     * @brief Umbral del candidato: |Z| ≥ umbral selecciona k, si no k + 1
+     * @param bit_length b en [1, MAX_BIT_LENGTH]
+     */
+    int32_t getGreedySplit(int bit_length) const { return CORDICTables::GREEDY_SPLITS[bit_length]; }
+    
+    /**
+     * @brief Selección greedy sobre |Z| crudo sin bucle
+     * 
+     * α_k ≈ 2^-k, así que la longitud en bits de |Z| fija k salvo una
+     * unidad: k = candidato(b) + (|Z| < umbral(b)). Equivalente bit a bit a
+     * selectGreedyIndexScan.
+     * 
+     * @param abs_z_raw |Z| en Q3.12 crudo, en [1, 32768]
+     * @return Índice del ángulo seleccionado (base 1)
+     */
+    int selectGreedyIndex(int32_t abs_z_raw) const;
+    
+    /**
+     * @brief Selección greedy por recorrido lineal de los umbrales (referencia)
+     * 
+     * Devuelve el menor k con |Z| ≥ umbral(k), es decir, α_k ≤ |Z| en Q3.12.
+     * 
+     * @param abs_z_raw |Z| en Q3.12 crudo (> 0)
+     * @return Índice del ángulo seleccionado (base 1)
+     */
+    int selectGreedyIndexScan(int32_t abs_z_raw) const;
+
+private:
+    /**
+     * @brief Construye las entradas double α_k = arctanh(2^-k) para debug
+     */
+    void buildTable();
 };
 
 /**
@@ -52,9 +129,14 @@ public:
  */
 class CORDICIterator {
 private:
-    AngleTable angle_table;
+    const AngleTable& angle_table;   // AngleTable::shared(): solo lectura
     
 public:
+    /**
+     * @brief Mayor N de la secuencia fija: α_k > FRAC_WIDTH es 0 en Q3.12
+     */
+    static constexpr int MAX_FIXED_LAST_SHIFT = CORDICConfig::FRAC_WIDTH;
+    
     CORDICIterator();
     
     /**
@@ -71,7 +153,85 @@ public:
      * @return Resultado completo de las iteraciones
      */
     IterationResult performIterations(const CORDICState& initial_state, 
-                                     bool enable_debug = false);
+                                     bool enable_debug = false) const;
+    
+    /**
+     * @brief Ruta rápida de producción sobre estado entero plano
+     * 
+     * Mismo algoritmo que performIterations (selección greedy, repeticiones
+     * k = 4, 7, 10, 13 y salida por convergencia) con resultados idénticos
+     * bit a bit, pero sin registrar ángulos, sin debug y sin asignaciones.
+     * 
+     * @param state [in/out] Estado X, Y, Z en Q3.12 crudo
+     * @param selection Selección del ángulo (mismo resultado con ambas)
+     */
+    void performIterationsFast(CORDICRawState& state,
+                               CORDICGreedySelection selection =
+                                   CORDICGreedySelection::LEADING_ZEROS) const;
+    
+    /**
+     * @brief performIterationsFast sobre un tile SoA, paso a paso
+     * 
+     * Cada rotación se aplica a los tile.count elementos antes de pasar a la
+     * siguiente, con máscaras por elemento para la dirección, la convergencia
+     * y la repetición de k = 4, 7, 10, 13: el cuerpo del bucle no tiene saltos
+     * dependientes de datos. El tile termina cuando todos sus elementos han
+     * convergido (o tras el máximo de iteraciones). X, Y, Z, iteration_count
+     * y converged quedan idénticos a performIterationsFast elemento a elemento.
+     * 
+     * @param tile [in/out] X, Y, Z iniciales y count; pending_repeat es interno
+     */
+    void performIterationsTile(CORDICTileState& tile) const;
+    
+    /**
+     * @brief Secuencia fija desenrollada (cordic_tables.h), sin saltos
+     * 
+     * FIXED_SCHEDULE_LENGTH rotaciones con k = 1..FRAC_WIDTH y repeticiones
+     * k = 4, 7, 10: sin selección greedy ni salida anticipada. El resultado
+     * difiere de performIterationsFast (otra secuencia de ángulos) y la
+     * ganancia es la constante CORDICTables::FIXED_SCHEDULE_GAIN.
+     * 
+     * @param state [in/out] Estado X, Y, Z en Q3.12 crudo
+     */
+    static void performIterationsFixed(CORDICRawState& state);
+    
+    /**
+     * @brief Secuencia fija acortada k = 1..N (repeticiones k = 4, 7, 10)
+     * 
+     * Igual que performIterationsFixed con N = MAX_FIXED_LAST_SHIFT. Coste
+     * constante de fixedScheduleLength(N) pasos por elemento, sin saltos;
+     * partiendo de X₀ = fixedFoldedInitialX(N), Y₀ = 0 queda e^z ≈ X + Y.
+     * 
+     * @param state [in/out] Estado X, Y, Z en Q3.12 crudo
+     * @param last_shift N en [1, MAX_FIXED_LAST_SHIFT]
+     * @throws std::invalid_argument si N está fuera de rango
+     */
+    static void performIterationsFixed(CORDICRawState& state, int last_shift);
+    
+    /**
+     * @brief Secuencia fija k = 1..N sobre arrays SoA (vectorizable)
+     * 
+     * Mismo resultado que performIterationsFixed(state, N) elemento a
+     * elemento; el bucle sobre elementos no tiene saltos dependientes de
+     * datos y el compilador lo vectoriza en las unidades enteras SIMD.
+     * 
+     * @param x, y, z [in/out] Estados en Q3.12 crudo
+     * @param size Elementos
+     * @param last_shift N en [1, MAX_FIXED_LAST_SHIFT]
+     * @throws std::invalid_argument si N está fuera de rango
+     */
+    static void performIterationsFixedBlock(int16_t* x, int16_t* y, int16_t* z, size_t size,
+                                            int last_shift);
+    
+    /**
+     * @brief X₀ = 1/K_N en Q3.12: ganancia de la secuencia k = 1..N plegada
+     */
+    static int16_t fixedFoldedInitialX(int last_shift);
+    
+    /**
+     * @brief Rotaciones por elemento de la secuencia k = 1..N
+     */
+    static int fixedScheduleLength(int last_shift);
     
     /**
      * @brief Obtiene referencia a la tabla de ángulos (para debugging)
@@ -88,7 +248,7 @@ private:
      * @param z_residual Valor Z actual
      * @return Índice del ángulo seleccionado (0 si convergió)
      */
-    int selectGreedyAngle(const FixedPoint16& z_residual);
+    int selectGreedyAngle(const FixedPoint16& z_residual) const;
     
     /**
      * @brief Ejecuta un paso de rotación CORDIC
@@ -105,7 +265,7 @@ private:
      * @return Nuevo estado después de la rotación
      */
     CORDICState executeRotationStep(const CORDICState& current_state, 
-                                   int angle_idx);
+                                   int angle_idx) const;
 };
 
 #endif // CORDIC_ITERATOR_H
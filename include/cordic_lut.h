@@ -0,0 +1,84 @@
+/**
+ * @file cordic_lut.h
+ * @brief e^x híbrido: tabla para los bits altos de x', CORDIC para el residuo
+ *
+ * FUNCIÓN: Tras la reducción e^x = 2^n × e^x' del preprocesador, x' es un
+ * código Q3.12 en [-1420, 1420] (~2.8K valores). Se parte en
+ *   x' = h × 2^r + l,  |l| ≤ 2^(r-1)   (h redondeado al más cercano)
+ * y se calcula e^x' = T[h] × e^l:
+ * - T[h] = e^(h × 2^r × 2^-12) precalculada en float (2841 / 2^r entradas)
+ * - e^l con una cola CORDIC corta: solo los shifts k ≥ 13 - r son necesarios
+ *   para |l| ≤ 2^(r-13), con la ganancia plegada en X₀ y corrección lineal
+ *   del ángulo residual (1 + z)
+ *
+ * residual_bits = r controla el compromiso:
+ * - r = 0: tabla completa (2841 entradas, 11 KB), sin iteraciones
+ * - r = 4: 179 entradas (716 B), 5 iteraciones
+ * - r = 12: 1 entrada, secuencia completa de 15 iteraciones
+ *
+ * La precisión queda limitada por la cuantización Q3.12 de x' (≤ 2.4e-4), no
+ * por la tabla ni por la cola.
+ */
+
+#ifndef CORDIC_LUT_H
+#define CORDIC_LUT_H
+
+#include "cordic_types.h"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+class CORDICLutExp {
+public:
+    static constexpr int MAX_RESIDUAL_BITS = CORDICConfig::FRAC_WIDTH;
+
+    // Mayor |x'| crudo tras la reducción: ⌈ln(2)/2 × 2^12⌉
+    static constexpr int32_t MAX_MAPPED_RAW = 1420;
+
+    // Precisión interna de la cola (Q2.29 en int32)
+    static constexpr int TAIL_FRAC_BITS = 29;
+
+private:
+    int residual_bits;
+    int32_t index_offset;           // h mínimo: T[h - index_offset]
+    std::vector<float> table;       // e^(h × 2^(r-12))
+
+    std::vector<int> tail_shifts;   // k de cada paso de la cola (con repeticiones)
+    std::vector<int32_t> tail_angles;  // α_k en Q2.29, uno por paso
+    int32_t tail_x0;                // 1/K de la cola en Q2.29
+
+public:
+    /**
+     * @brief Construye tabla y cola para r bits de residuo
+     * @param residual_bits r en [0, MAX_RESIDUAL_BITS]
+     * @throws std::invalid_argument si r está fuera de rango
+     */
+    explicit CORDICLutExp(int residual_bits = 4);
+
+    /**
+     * @brief Mayor r cuya tabla cabe en table_bytes (0 si cabe la completa)
+     */
+    static int residualBitsForBudget(size_t table_bytes);
+
+    /**
+     * @brief e^x (misma reducción de rango que CORDICPreprocessor)
+     *
+     * |x| > 15 se reduce antes por 2^n en vez de saturar: e^x hasta el
+     * underflow / overflow de float, ±inf → 0 / inf y NaN → NaN.
+     */
+    float calculateExp(float x) const;
+
+    void calculateExpBatch(const float* inputs, float* outputs, size_t size) const;
+
+    /**
+     * @brief e^x' para un x' Q3.12 crudo ya reducido
+     */
+    float expMapped(int16_t mapped_raw) const;
+
+    int getResidualBits() const { return residual_bits; }
+    size_t getTableEntries() const { return table.size(); }
+    size_t getTableBytes() const { return table.size() * sizeof(float); }
+    int getTailIterations() const { return static_cast<int>(tail_shifts.size()); }
+};
+
+#endif // CORDIC_LUT_H
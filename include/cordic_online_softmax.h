@@ -0,0 +1,92 @@
+/**
+ * @file cordic_online_softmax.h
+ * @brief Softmax online de una sola pasada sobre los logits
+ *
+ * FUNCIÓN: Leer cada logit una única vez (máximo y exponenciales en la misma
+ * pasada), admitiendo entrada por chunks a medida que se producen.
+ *
+ * ESTRATEGIA:
+ * - Referencia R = k × ln(2) con k = ⌈max / ln(2)⌉ (máximo acumulado)
+ * - Cada elemento se guarda como e^(x_i - R_actual) en la salida
+ * - Si el máximo crece (k → k'), la suma acumulada se reescala por 2^(k - k'):
+ *   con la reducción 2^n del preprocesador es un simple ajuste de exponente
+ * - finalize(): cada tramo escrito con su k se escala por 2^(k - k_final) / suma
+ *
+ * Los logits se leen una vez; la salida se escribe y se normaliza en sitio.
+ */
+
+#ifndef CORDIC_ONLINE_SOFTMAX_H
+#define CORDIC_ONLINE_SOFTMAX_H
+
+#include "cordic_softmax.h"
+#include <vector>
+
+class CORDICOnlineSoftmax {
+private:
+    /**
+     * @brief Tramo de salida exponenciado con la misma referencia k × ln(2)
+     */
+    struct Segment {
+        size_t begin;
+        int exponent;
+    };
+
+    const CORDICSoftmax& engine;
+    float* probabilities;
+    size_t capacity;
+    size_t count;
+
+    int reference_exponent;   // k actual: R = k × ln(2) ≥ máximo visto
+    float sum;                // Σ e^(x_i - R) relativo a la referencia actual
+    bool finalized;
+    std::vector<Segment> segments;
+
+public:
+    /**
+     * @brief Constructor
+     * @param softmax Motor CORDIC usado para las exponenciales (no se modifica)
+     * @param output Buffer de salida de probabilidades
+     * @param output_capacity Número máximo de elementos que se consumirán
+     */
+    CORDICOnlineSoftmax(const CORDICSoftmax& softmax, float* output, size_t output_capacity);
+
+    /**
+     * @brief Reinicia el estado para una nueva fila
+     */
+    void reset(float* output, size_t output_capacity);
+
+    /**
+     * @brief Consume el siguiente chunk de logits (una sola lectura)
+     *
+     * Escribe e^(x_i - R) en la salida a continuación del chunk anterior.
+     *
+     * @param logits Chunk de logits
+     * @param chunk_size Número de elementos del chunk
+     * @throws std::out_of_range si se supera la capacidad de salida
+     * @throws std::logic_error si ya se llamó a finalize()
+     */
+    void consume(const float* logits, size_t chunk_size);
+
+    /**
+     * @brief Normaliza la salida: p_i = e^(x_i - R_final) / suma
+     */
+    void finalize();
+
+    size_t size() const { return count; }
+    bool isFinalized() const { return finalized; }
+
+    /**
+     * @brief Exponente k de la referencia actual R = k × ln(2)
+     */
+    int getReferenceExponent() const { return reference_exponent; }
+
+    /**
+     * @brief Suma acumulada Σ e^(x_i - R) respecto a la referencia actual
+     */
+    float getSum() const { return sum; }
+
+private:
+    void consumeBlock(const float* logits, size_t block_size);
+};
+
+#endif // CORDIC_ONLINE_SOFTMAX_H
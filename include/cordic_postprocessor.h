@@ -33,6 +33,47 @@ public:
         bool enable_debug = false
     );
     
+    /**
+     * @brief Ruta rápida: solo e^x, sin campos de diagnóstico
+     * 
+     * Mismas operaciones que processResults (K = √|X²-Y²|, cosh + sinh, 2^n)
+     * con resultado idéntico bit a bit, pero sin calcular std::exp de
+     * referencia para relative_error.
+     * 
+     * @param final_state Estado final entero de performIterationsFast
+     * @param preprocess_result Resultado del preprocesamiento
+     * @return e^x
+     */
+    static float computeExponential(
+        const CORDICRawState& final_state,
+        const PreprocessResult& preprocess_result
+    );
+    
+    /**
+     * @brief Postprocesado con ganancia plegada: sin sqrt, divisiones ni pow
+     * 
+     * Solo válido tras la secuencia fija (ganancia K constante) partiendo de
+     * X₀ = 1/K (CORDICTables::FIXED_SCHEDULE_FOLDED_X0), Y₀ = 0:
+     *   X = cosh(x'), Y = sinh(x')  →  e^x' = X + Y
+     *   e^x = e^x' × 2^n sumando n al exponente del float
+     * 
+     * @param final_state Estado final de CORDICIterator::performIterationsFixed
+     * @param preprocess_result Resultado del preprocesamiento
+     * @return e^x
+     */
+    static float computeExponentialFolded(
+        const CORDICRawState& final_state,
+        const PreprocessResult& preprocess_result
+    );
+    
+    /**
+     * @brief value × 2^n sumando n a los bits de exponente
+     * 
+     * Exacto e idéntico a value × 2^n mientras el resultado sea normal; en
+     * otro caso (cero, subnormal, inf/NaN o desbordamiento) recurre a ldexp.
+     */
+    static float scaleByPowerOf2(float value, int n);
+    
     /**
      * @brief Muestra información detallada del postprocesamiento
      */
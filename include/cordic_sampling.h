@@ -0,0 +1,130 @@
+/**
+ * @file cordic_sampling.h
+ * @brief Softmax fusionado con filtros top-k / top-p para el muestreo
+ *
+ * FUNCIÓN: Obtener los candidatos del muestreo (índices y probabilidades
+ * normalizadas) sin exponenciar todo el vocabulario.
+ *
+ * MODO FUSIONADO:
+ * 1. Una pasada: selección parcial con un min-heap de tamaño k (el umbral es
+ *    la raíz: la mayoría de logits se descartan con una comparación); el
+ *    máximo es el mejor candidato
+ * 2. e^(x_i - max) solo para los k candidatos (calculateExpBatchFast)
+ * 3. Cota de la masa fuera de los candidatos: cada logit descartado es ≤ x_k,
+ *    así que Σ_resto ≤ (N - k) × e^(x_k - max)
+ * 4. Orden por probabilidad (empates por logit e índice) y top-p sobre las
+ *    probabilidades renormalizadas de los k candidatos
+ *
+ * MODO EXACTO (validación): computeSoftmax completo, el mismo orden y los
+ * mismos filtros; las exponenciales de los candidatos son idénticas bit a bit
+ * a las del modo fusionado.
+ *
+ * La exp CORDIC no es monótona en x (logits a pocos códigos Q3.12 pueden
+ * invertirse), así que los dos modos solo difieren en la frontera: el
+ * fusionado elige los k por logit y el exacto por probabilidad, y el corte
+ * top-p puede moverse un candidato por el redondeo de la normalización.
+ * Ambos modos exponencian con calculateExpStabilizedBatch: -inf no es
+ * candidato y los logits a más de 15 del máximo no saturan.
+ *
+ * Semántica de la cadena (como top-k → top-p en llama.cpp):
+ *   softmax → top-k → renormalizar → top-p (prefijo mínimo con Σ ≥ p,
+ *   al menos min_keep) → renormalizar
+ */
+
+#ifndef CORDIC_SAMPLING_H
+#define CORDIC_SAMPLING_H
+
+#include "cordic_softmax.h"
+#include <cstdint>
+#include <vector>
+
+/**
+ * @brief Parámetros de filtrado
+ */
+struct CORDICSamplingParams {
+    size_t top_k;     // Candidatos (0 = vocabulario completo)
+    float top_p;      // Masa del nucleus (≥ 1 = sin filtro)
+    size_t min_keep;  // Mínimo de candidatos tras top-p
+
+    CORDICSamplingParams() : top_k(40), top_p(1.0f), min_keep(1) {}
+    CORDICSamplingParams(size_t k, float p, size_t keep = 1)
+        : top_k(k), top_p(p), min_keep(keep) {}
+};
+
+enum class CORDICSamplingMode {
+    FUSED,  // Solo exponencia los candidatos
+    EXACT   // Softmax completo seguido de los filtros
+};
+
+/**
+ * @brief Candidatos resultantes, en orden descendente de probabilidad
+ *
+ * Empates de probabilidad por logit descendente y luego índice ascendente.
+ */
+struct CORDICCandidates {
+    std::vector<int32_t> indices;
+    std::vector<float> probabilities;   // Normalizadas sobre los candidatos
+
+    // Masa de la distribución completa fuera de los k candidatos: cota
+    // superior en modo FUSED, valor exacto en modo EXACT
+    float tail_mass;
+
+    CORDICCandidates() : tail_mass(0.0f) {}
+    size_t size() const { return indices.size(); }
+};
+
+class CORDICTopKSampler {
+private:
+    /**
+     * @brief Logit candidato con su índice en el vocabulario
+     */
+    struct Entry {
+        float logit;
+        int32_t index;
+    };
+
+    CORDICSoftmax& engine;
+
+    // Buffers reutilizados entre tokens
+    std::vector<Entry> heap;
+    std::vector<float> stabilized;
+    std::vector<float> weights;
+    std::vector<float> full_probabilities;
+    std::vector<int32_t> order;
+
+    void selectFused(const float* logits, size_t size, size_t k, CORDICCandidates& out);
+    void selectExact(const float* logits, size_t size, size_t k, CORDICCandidates& out);
+
+    /**
+     * @brief top-p y normalización final sobre weights (pesos sin normalizar)
+     */
+    void applyTopP(const CORDICSamplingParams& params, CORDICCandidates& out);
+
+public:
+    /**
+     * @brief Constructor
+     * @param softmax Motor CORDIC (computeSoftmax en modo exacto)
+     */
+    explicit CORDICTopKSampler(CORDICSoftmax& softmax);
+
+    /**
+     * @brief Candidatos top-k / top-p de un vector de logits
+     *
+     * Requiere al menos un logit finito. Los logits -inf (enmascarados; en
+     * modo FUSED también los NaN) no son candidatos, así que puede devolver
+     * menos de top_k. Candidatos a más de 15 del máximo se exponencian sin
+     * saturar (calculateExpStabilizedBatch).
+     *
+     * @param logits Logits del vocabulario
+     * @param size Tamaño del vocabulario
+     * @param params top_k, top_p y min_keep
+     * @param out Índices y probabilidades (se redimensiona)
+     * @param mode FUSED (rápido) o EXACT (softmax completo, validación)
+     * @return Número de candidatos
+     * @throws std::invalid_argument si size == 0
+     */
+    size_t select(const float* logits, size_t size, const CORDICSamplingParams& params,
+                  CORDICCandidates& out, CORDICSamplingMode mode = CORDICSamplingMode::FUSED);
+};
+
+#endif // CORDIC_SAMPLING_H
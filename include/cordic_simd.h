@@ -0,0 +1,139 @@
+/**
+ * @file cordic_simd.h
+ * @brief Kernels SIMD para e^x por lotes (SSE4.1 / AVX2 / AVX-512 / NEON)
+ *        con dispatch en tiempo de ejecución
+ *
+ * FUNCIÓN: Ejecutar preprocesado, rotaciones greedy y postprocesado de
+ * 8-32 elementos Q3.12 (int16) a la vez, con resultados idénticos bit a bit
+ * a CORDICSoftmax::calculateExpFast.
+ *
+ * DISPATCH: cada ISA se compila en su propia unidad de traducción; la
+ * librería no depende de -march=native. El kernel se elige una sola vez
+ * (CPUID en x86, NEON en AArch64 si se compiló con CORDIC_ENABLE_NEON, que
+ * está OFF hasta validarlo en hardware) y puede forzarse con la variable
+ * de entorno CORDIC_BACKEND=scalar|sse4|avx2|avx512|neon.
+ *
+ * ESTRATEGIA:
+ * - Selección greedy por lane: longitud en bits de |Z| (tabla de nibbles
+ *   con pshufb) → candidato k y una comparación con su umbral
+ * - Dirección de rotación: máscara por lane a partir del signo de Z
+ * - Convergencia / repeticiones: máscara de lanes activas por paso
+ * - Escalado 2^n: suma directa al exponente float
+ */
+
+#ifndef CORDIC_SIMD_H
+#define CORDIC_SIMD_H
+
+#include <cstddef>
+#include <cstdint>
+
+class AngleTable;
+
+/**
+ * @brief Implementaciones disponibles del kernel por lotes
+ */
+enum class CORDICKernel {
+    SCALAR,
+    SSE41,
+    AVX2,
+    AVX512,
+    NEON
+};
+
+/**
+ * @brief Tablas enteras que consumen los kernels (índice base 1)
+ *
+ * POD sin dependencias: los kernels se compilan en unidades de traducción
+ * con flags de ISA propios y no deben instanciar código inline compartido.
+ */
+struct CORDICKernelTables {
+    static constexpr int TABLE_SIZE = 15;
+
+    int16_t raw_angles[TABLE_SIZE + 1];
+    int16_t greedy_thresholds[TABLE_SIZE + 1];
+    
+    // Selección por longitud en bits b de |Z|, índice b - 1 (b = 1..16): una
+    // fila de 16 lanes int16 para pshufb / vpermw
+    int16_t greedy_candidates[16];
+    int16_t greedy_splits[16];
+    int16_t max_iterations;
+    
+    // Umbrales del preprocesador en float (comparaciones idénticas al escalar)
+    float small_input_limit;  // Mayor float ≤ CONVERGENCE_LIMIT (comparación double)
+    float adjustment_limit;   // static_cast<float>(CONVERGENCE_LIMIT) de applyFineAdjustment
+
+    explicit CORDICKernelTables(const AngleTable& table);
+
+    /**
+     * @brief Tablas construidas una vez a partir de AngleTable::shared()
+     */
+    static const CORDICKernelTables& shared();
+};
+
+class CORDICSIMD {
+public:
+    /**
+     * @brief Número de elementos procesados por bloque SIMD
+     */
+    static constexpr size_t LANES = 16;
+
+    /**
+     * @brief Kernel elegido una vez por proceso
+     *
+     * CORDIC_BACKEND si está definida y el kernel está soportado; si no, el
+     * mejor kernel soportado.
+     */
+    static CORDICKernel activeKernel();
+
+    /**
+     * @brief Indica si activeKernel() viene forzado por CORDIC_BACKEND
+     */
+    static bool isKernelForced();
+
+    /**
+     * @brief Kernel para un valor de CORDIC_BACKEND
+     *
+     * @param name Nombre del backend (kernelName), nullptr o vacío = automático
+     * @return Kernel pedido, o el mejor soportado si name es nullptr / vacío
+     * @throws std::invalid_argument si el nombre no existe o el kernel no
+     *         está compilado / soportado por la CPU
+     */
+    static CORDICKernel selectKernel(const char* name);
+
+    /**
+     * @brief Indica si el kernel está compilado y soportado por la CPU
+     */
+    static bool isKernelSupported(CORDICKernel kernel);
+
+    static const char* kernelName(CORDICKernel kernel);
+
+    /**
+     * @brief Ejecuta e^x por lotes con un kernel vectorial
+     *
+     * @return false si el kernel es SCALAR o no está soportado; en ese caso no
+     *         se escribe nada y el llamador debe usar la ruta escalar
+     *         (CORDICSoftmax::calculateExpFast)
+     */
+    static bool runKernel(CORDICKernel kernel, const CORDICKernelTables& tables,
+                          const float* inputs, float* outputs, size_t size);
+};
+
+//==============================================================================
+// KERNELS POR ISA (definidos en src/cordic_simd_<isa>.cpp)
+//==============================================================================
+
+#if defined(CORDIC_ENABLE_X86_KERNELS)
+void cordicExpBatchSSE41(const CORDICKernelTables& tables,
+                         const float* inputs, float* outputs, size_t size);
+void cordicExpBatchAVX2(const CORDICKernelTables& tables,
+                        const float* inputs, float* outputs, size_t size);
+void cordicExpBatchAVX512(const CORDICKernelTables& tables,
+                          const float* inputs, float* outputs, size_t size);
+#endif
+
+#if defined(CORDIC_ENABLE_NEON_KERNELS)
+void cordicExpBatchNEON(const CORDICKernelTables& tables,
+                        const float* inputs, float* outputs, size_t size);
+#endif
+
+#endif // CORDIC_SIMD_H
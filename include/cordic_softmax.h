@@ -16,8 +16,86 @@
 #include "cordic_preprocessor.h"
 #include "cordic_iterator.h"
 #include "cordic_postprocessor.h"
+#include "cordic_simd.h"
+#include "cordic_thread_pool.h"
+#include "cordic_half.h"
+#include "cordic_accumulator.h"
 #include <vector>
 #include <algorithm>
+#include <memory>
+#include <cstdint>
+
+/**
+ * @brief Configuración del modo paralelo de softmax
+ * 
+ * El resultado solo depende de chunk_size (orden fijo de reducción por
+ * chunk), nunca del número de hilos.
+ */
+struct CORDICParallelConfig {
+    size_t num_threads;  // Hilos totales (0 = hardware_concurrency)
+    size_t chunk_size;   // Elementos por chunk del vocabulario
+    
+    CORDICParallelConfig() : num_threads(0), chunk_size(16384) {}
+    CORDICParallelConfig(size_t threads, size_t chunk) 
+        : num_threads(threads), chunk_size(chunk) {}
+};
+
+/**
+ * @brief Máscara causal / de ventana deslizante implícita (sin tensor de máscara)
+ * 
+ * La fila r de la matriz de atención es la consulta en la posición absoluta
+ *   q = first_position + r % positions
+ * y solo ve las claves c ∈ [q + 1 - window, q] (window = 0: todas las
+ * anteriores), recortadas a [0, cols). El resto de la fila vale 0 exacto.
+ */
+struct CORDICCausalMask {
+    size_t first_position;   // Posición de la primera consulta (n_past con caché KV)
+    size_t positions;        // Consultas distintas antes de repetir (n_q; filas = n_head × n_q)
+    size_t window;           // Claves visibles por consulta (0 = causal sin ventana)
+    
+    CORDICCausalMask() : first_position(0), positions(1), window(0) {}
+    CORDICCausalMask(size_t first, size_t count, size_t window_length = 0)
+        : first_position(first), positions(count), window(window_length) {}
+};
+
+/**
+ * @brief Algoritmo de rotación de las rutas sin debug
+ */
+enum class CORDICRotationMode {
+    GREEDY,          // Selección greedy con salida por convergencia (por defecto)
+    FIXED_SCHEDULE   // Secuencia fija k = 1..N con ganancia plegada, sin saltos
+};
+
+/**
+ * @brief Configuración del modo de rotación
+ * 
+ * En FIXED_SCHEDULE todas las exponenciales (calculateExp sin debug, lotes
+ * y softmax) usan la secuencia k = 1..fixed_last_shift: coste constante por
+ * elemento y error ~2^-N (ver CORDICIterator::performIterationsFixedBlock).
+ */
+struct CORDICRotationConfig {
+    CORDICRotationMode mode;
+    int fixed_last_shift;    // N en [1, CORDICIterator::MAX_FIXED_LAST_SHIFT]
+    
+    CORDICRotationConfig()
+        : mode(CORDICRotationMode::GREEDY),
+          fixed_last_shift(CORDICIterator::MAX_FIXED_LAST_SHIFT) {}
+    CORDICRotationConfig(CORDICRotationMode rotation_mode, int last_shift)
+        : mode(rotation_mode), fixed_last_shift(last_shift) {}
+};
+
+/**
+ * @brief Acumulación de Σ e^x en los softmax sin debug
+ * 
+ * FLOAT suma en un float en orden secuencial (por chunk en el modo
+ * paralelo). EXACT suma en CORDICExactAccumulator y redondea una vez: el
+ * resultado no depende del orden, así que computeSoftmax y
+ * computeSoftmaxParallel coinciden bit a bit con cualquier chunk_size.
+ */
+enum class CORDICSumMode {
+    FLOAT,   // Suma float secuencial (por defecto)
+    EXACT    // Acumulador entero de 384 bits, un solo redondeo
+};
 
 /**
  * @class CORDICSoftmax
@@ -32,7 +110,16 @@
 class CORDICSoftmax {
 private:
     CORDICIterator iterator;
+    const CORDICKernelTables& kernel_tables;   // Compartidas e inmutables
     bool debug_mode;
+    CORDICRotationConfig rotation_config;
+    CORDICSumMode sum_mode;
+    
+    // Modo paralelo: pool persistente (creado bajo demanda) y parciales por chunk
+    CORDICParallelConfig parallel_config;
+    std::unique_ptr<CORDICThreadPool> thread_pool;
+    std::vector<float> chunk_partials;
+    std::vector<CORDICExactAccumulator> chunk_accumulators;
     
 public:
     /**
@@ -49,28 +136,262 @@ public:
      * 2. Iterar: rotaciones CORDIC con selección greedy
      * 3. Postprocesar: extraer e^x y restaurar valor original
      * 
+     * Sin debug usa calculateExpFast; con debug recorre el pipeline
+     * completo de diagnóstico (mismo resultado).
+     * 
      * @param x Exponente de entrada
      * @return e^x con error < 0.1%
      */
     float calculateExp(float x);
     
+    /**
+     * @brief Ruta de producción de e^x: cero asignaciones, sin diagnóstico
+     * 
+     * Idéntica bit a bit a performIterations/processResults, pero opera
+     * sobre estado entero plano (CORDICRawState).
+     * 
+     * @param x Exponente de entrada
+     * @return e^x
+     */
+    float calculateExpFast(float x) const;
+    
+    /**
+     * @brief e^x por la secuencia fija con ganancia plegada
+     * 
+     * X₀ = 1/K, rotaciones desenrolladas sin saltos y e^x = (X + Y) × 2^n
+     * con n sumado al exponente: sin sqrt, divisiones ni pow por elemento.
+     * No es idéntica bit a bit a calculateExpFast (otra secuencia de ángulos).
+     * 
+     * @param x Exponente de entrada
+     * @return e^x
+     */
+    float calculateExpFolded(float x) const;
+    
+    /**
+     * @brief e^x por la secuencia fija acortada k = 1..N con ganancia plegada
+     * 
+     * Con N = CORDICIterator::MAX_FIXED_LAST_SHIFT es idéntica bit a bit a
+     * calculateExpFolded(x).
+     * 
+     * @param x Exponente de entrada
+     * @param last_shift N en [1, CORDICIterator::MAX_FIXED_LAST_SHIFT]
+     * @throws std::invalid_argument si N está fuera de rango
+     */
+    float calculateExpFolded(float x, int last_shift) const;
+    
     /**
      * @brief Softmax completo con estabilización automática
      * 
      * ALGORITMO:
      * softmax(x_i) = exp(x_i - max_x) / Σ(exp(x_j - max_x))
      * 
+     * Sin debug, las exponenciales van por calculateExpStabilizedBatch:
+     * -inf da 0 exacto y x_i - max_x < -15 no satura.
+     * 
      * @param logits Array de entrada (logits del modelo)
      * @param probabilities Array de salida (probabilidades [0,1])
      * @param size Tamaño del vocabulario
      */
     void computeSoftmax(const float* logits, float* probabilities, size_t size);
     
+    /**
+     * @brief Softmax online: lee cada logit una sola vez
+     * 
+     * Máximo acumulado y suma reescalada por potencias de 2 en la misma
+     * pasada (ver CORDICOnlineSoftmax); la normalización es en sitio sobre
+     * la salida. Para entrada por chunks usar CORDICOnlineSoftmax directamente.
+     * 
+     * @param logits Array de entrada (logits del modelo)
+     * @param probabilities Array de salida (probabilidades [0,1])
+     * @param size Tamaño del vocabulario
+     */
+    void computeSoftmaxOnline(const float* logits, float* probabilities, size_t size) const;
+    
+    /**
+     * @brief Softmax paralelo para vocabularios grandes (150K+ tokens)
+     * 
+     * ALGORITMO (3 pasadas paralelas sobre chunks de chunk_size):
+     * 1. Máximo por chunk → máximo global
+     * 2. exp(x_i - max) y suma parcial por chunk → suma global en orden de chunk
+     * 3. Normalización por chunk
+     * 
+     * Determinista: mismo resultado bit a bit con cualquier número de hilos.
+     * 
+     * @param logits Array de entrada (logits del modelo)
+     * @param probabilities Array de salida (probabilidades [0,1])
+     * @param size Tamaño del vocabulario
+     */
+    void computeSoftmaxParallel(const float* logits, float* probabilities, size_t size);
+    
+    /**
+     * @brief Softmax por filas para matrices de atención [n_head × n_q, n_kv]
+     * 
+     * Fusiona el factor de escala previo y una máscara aditiva opcional
+     * (ALiBi o causal con -inf) en la lectura de cada fila:
+     *   p[r][c] = softmax_c(logits[r][c] × scale + mask[r % mask_rows][c])
+     * 
+     * Los elementos que quedan en -inf producen exactamente 0; una fila
+     * completamente enmascarada produce ceros. Las filas se reparten entre
+     * los hilos del pool en grupos de ~chunk_size elementos. Admite
+     * logits == probabilities (en sitio).
+     * 
+     * @param logits Primera fila de entrada
+     * @param probabilities Primera fila de salida
+     * @param rows Número de filas
+     * @param cols Elementos por fila (n_kv)
+     * @param row_stride Elementos entre filas consecutivas (≥ cols) en entrada y salida
+     * @param scale Factor de escala previo al softmax (p.ej. 1/√d_head)
+     * @param mask Máscara aditiva opcional (nullptr = sin máscara)
+     * @param mask_stride Elementos entre filas de la máscara (≥ cols)
+     * @param mask_rows Filas distintas de la máscara; se repite cada mask_rows filas
+     * @throws std::invalid_argument si row_stride o mask_stride < cols, o mask_rows == 0
+     */
+    void computeSoftmaxRows(const float* logits, float* probabilities, size_t rows, size_t cols,
+                            size_t row_stride, float scale = 1.0f, const float* mask = nullptr,
+                            size_t mask_stride = 0, size_t mask_rows = 1);
+    
+    /**
+     * @brief Softmax por filas con máscara causal o de ventana implícita
+     * 
+     * Igual que computeSoftmaxRows, pero cada fila solo procesa su tramo
+     * visible (ver CORDICCausalMask): las claves enmascaradas no pasan por el
+     * máximo, las exponenciales ni la suma, y su salida es 0 exacto. Con
+     * caché KV y una consulta por fila el trabajo baja de n_kv a
+     * min(q + 1, window) elementos por fila. La máscara aditiva opcional
+     * (ALiBi) se aplica dentro del tramo visible.
+     * 
+     * @param causal Posición de la primera consulta, consultas distintas y ventana
+     * @throws std::invalid_argument si row_stride o mask_stride < cols,
+     *         mask_rows == 0 o causal.positions == 0
+     */
+    void computeSoftmaxRowsCausal(const float* logits, float* probabilities, size_t rows,
+                                  size_t cols, size_t row_stride, const CORDICCausalMask& causal,
+                                  float scale = 1.0f, const float* mask = nullptr,
+                                  size_t mask_stride = 0, size_t mask_rows = 1);
+    
+    /**
+     * @brief Softmax con logits fp16 / bf16 y salida float o del mismo tipo
+     * 
+     * Conversión por bloques de 256 en L1 (sin buffer float del tamaño de
+     * la fila): lee la mitad de bytes que la versión float. Con salida
+     * float el resultado es idéntico bit a bit a computeSoftmax sobre los
+     * logits convertidos; con salida half las exponenciales se guardan en
+     * half y se normalizan en sitio (≤ 1 ulp half de diferencia).
+     */
+    void computeSoftmax(const CORDICFloat16* logits, float* probabilities, size_t size) const;
+    void computeSoftmax(const CORDICFloat16* logits, CORDICFloat16* probabilities,
+                        size_t size) const;
+    void computeSoftmax(const CORDICBFloat16* logits, float* probabilities, size_t size) const;
+    void computeSoftmax(const CORDICBFloat16* logits, CORDICBFloat16* probabilities,
+                        size_t size) const;
+    
+    /**
+     * @brief log Σ exp(x_i) estabilizado: max + ln Σ e^(x_i - max)
+     * 
+     * Exponenciales con el kernel por lotes y un único logaritmo por CORDIC
+     * en modo vectoring (Q2.29): la parte entera sale del exponente de la
+     * suma, sin std::log. Los -inf no aportan; todo -inf (o size 0) da -inf.
+     * Los términos con x_i - max < -15 se reducen antes por 2^n en lugar de
+     * saturarse, así que filas muy anchas no contaminan la suma.
+     */
+    float computeLogSumExp(const float* logits, size_t size) const;
+    
+    /**
+     * @brief log_softmax: x_i - max - ln Σ e^(x_j - max)
+     * 
+     * Sin log por elemento: probabilidades diminutas conservan su precisión
+     * (no pasan por un float cercano a 0). Admite logits == log_probs.
+     * 
+     * @param logits Array de entrada
+     * @param log_probs Array de salida (log-probabilidades ≤ 0)
+     * @param size Tamaño del vocabulario
+     */
+    void computeLogSoftmax(const float* logits, float* log_probs, size_t size) const;
+    
+    /**
+     * @brief Configura hilos y tamaño de chunk del modo paralelo
+     * 
+     * Recrea el pool si cambia el número de hilos.
+     */
+    void setParallelConfig(const CORDICParallelConfig& config);
+    const CORDICParallelConfig& getParallelConfig() const { return parallel_config; }
+    
+    /**
+     * @brief Selecciona rotación greedy o secuencia fija de N pasos
+     * 
+     * No afecta a calculateExpFast / calculateExpFolded (algoritmo fijo) ni
+     * al pipeline de debug.
+     * 
+     * @throws std::invalid_argument si mode es FIXED_SCHEDULE y N está fuera
+     *         de [1, CORDICIterator::MAX_FIXED_LAST_SHIFT]
+     */
+    void setRotationConfig(const CORDICRotationConfig& config);
+    const CORDICRotationConfig& getRotationConfig() const { return rotation_config; }
+    
+    /**
+     * @brief Selecciona suma float o exacta de las exponenciales
+     * 
+     * Afecta a computeSoftmax (float y fp16 / bf16), computeSoftmaxParallel,
+     * computeSoftmaxRows(Causal), computeLogSumExp y computeLogSoftmax. Las
+     * exponenciales son las mismas en ambos modos; solo cambia Σ. No afecta
+     * al pipeline de debug ni al softmax online (suma reescalada por bloque).
+     */
+    void setSumMode(CORDICSumMode mode) { sum_mode = mode; }
+    CORDICSumMode getSumMode() const { return sum_mode; }
+    
     /**
      * @brief Versión vectorizada para múltiples exponenciales
+     * 
+     * Usa el kernel SIMD elegido por CPUID (AVX-512 / AVX2) en bloques de
+     * 16 elementos; sin soporte SIMD, tiles SoA (calculateExpBatchTiled);
+     * con debug recurre a calculateExp.
+     * Resultados idénticos bit a bit a calculateExpFast (en modo
+     * FIXED_SCHEDULE, a calculateExpFolded(x, N)).
      */
     void calculateExpBatch(const float* inputs, float* outputs, size_t size);
     
+    /**
+     * @brief e^x por lotes sin debug (kernel SIMD o tiles SoA)
+     * 
+     * Seguro para llamar desde varios hilos sobre la misma instancia.
+     */
+    void calculateExpBatchFast(const float* inputs, float* outputs, size_t size) const;
+    
+    /**
+     * @brief e^x por lotes portable: tiles SoA de CORDICTileState::SIZE
+     * 
+     * Preprocesado por elemento, CORDICIterator::performIterationsTile y
+     * postprocesado por elemento; idéntica bit a bit a calculateExpFast. Es
+     * la ruta de calculateExpBatchFast sin kernel SIMD. Admite inputs == outputs.
+     */
+    void calculateExpBatchTiled(const float* inputs, float* outputs, size_t size) const;
+    
+    /**
+     * @brief e^x por lotes para logits estabilizados (x = logit - max ≤ 0)
+     * 
+     * Como calculateExpBatchFast, pero sin la saturación del preprocesador:
+     * -inf (enmascarado) → 0 exacto y x < -15 se reduce antes por 2^n
+     * (e^x = 2^n × e^(x - n ln2)). Para x ≥ -15 es idéntica bit a bit.
+     * Admite inputs == outputs.
+     */
+    void calculateExpStabilizedBatch(const float* inputs, float* outputs, size_t size) const;
+    
+    /**
+     * @brief e^x por lotes con entrada fp16 / bf16 (mismo resultado que la
+     *        versión float sobre la entrada convertida, redondeado a la salida)
+     */
+    void calculateExpBatchFast(const CORDICFloat16* inputs, float* outputs, size_t size) const;
+    void calculateExpBatchFast(const CORDICFloat16* inputs, CORDICFloat16* outputs,
+                               size_t size) const;
+    void calculateExpBatchFast(const CORDICBFloat16* inputs, float* outputs, size_t size) const;
+    void calculateExpBatchFast(const CORDICBFloat16* inputs, CORDICBFloat16* outputs,
+                               size_t size) const;
+    
+    /**
+     * @brief Kernel que usará calculateExpBatch en esta CPU
+     */
+    static CORDICKernel getActiveKernel() { return CORDICSIMD::activeKernel(); }
+    
     /**
      * @brief Configuración
      */
@@ -81,6 +402,52 @@ public:
      * @brief Información de configuración
      */
     static void printConfiguration();
+
+private:
+    /**
+     * @brief exp(logits[i] - max_logit) por bloques en caché, sin debug
+     * 
+     * Seguro para llamar desde varios hilos a la vez.
+     * 
+     * @param exact Si no es nullptr, las exponenciales se suman ahí (exacto)
+     * @return Suma de las exponenciales en orden secuencial (0 con exact)
+     */
+    float exponentiateStabilized(const float* logits, float* outputs, size_t size,
+                                 float max_logit, CORDICExactAccumulator* exact = nullptr) const;
+    
+    /**
+     * @brief e^x por lotes con la secuencia fija de rotation_config (SoA)
+     */
+    void expBatchFixedSchedule(const float* inputs, float* outputs, size_t size) const;
+    
+    /**
+     * @brief Softmax / exp por lotes para cualquier par de tipos de E/S
+     */
+    template <typename In, typename Out>
+    void softmaxConverted(const In* logits, Out* probabilities, size_t size) const;
+    
+    template <typename In, typename Out>
+    void expBatchConverted(const In* inputs, Out* outputs, size_t size) const;
+    
+    /**
+     * @brief Σ exp(logits[i] - max_logit) sin escribir salida (-inf → 0)
+     */
+    float sumExpStabilized(const float* logits, size_t size, float max_logit) const;
+    
+    /**
+     * @brief Softmax de una fila con escala y máscara fusionadas (sin debug)
+     */
+    void softmaxRow(const float* logits, float* probabilities, size_t cols, float scale,
+                    const float* mask) const;
+    
+    /**
+     * @brief Reparto de filas entre hilos; causal = nullptr para filas completas
+     */
+    void softmaxRowsImpl(const float* logits, float* probabilities, size_t rows, size_t cols,
+                         size_t row_stride, float scale, const float* mask, size_t mask_stride,
+                         size_t mask_rows, const CORDICCausalMask* causal);
+    
+    CORDICThreadPool& getThreadPool();
 };
 
 //==============================================================================
@@ -117,6 +484,145 @@ float llama_cordic_exp(float x);
  */
 void llama_cordic_softmax(const float* logits, float* probs, size_t vocab_size);
 
+/**
+ * @brief log_softmax sin logf por elemento (perplejidad, beam search)
+ * 
+ * USO EN LLAMA.CPP:
+ * ```c
+ * // En lugar de llama_cordic_softmax + logf(probs[i])
+ * llama_cordic_log_softmax(logits, log_probs, vocab_size);
+ * nll -= log_probs[token];
+ * ```
+ */
+void llama_cordic_log_softmax(const float* logits, float* log_probs, size_t vocab_size);
+
+/**
+ * @brief Softmax por filas para atención, con escala y máscara fusionadas
+ * 
+ * USO EN LLAMA.CPP (soft_max de KQ, sin copia previa enmascarada):
+ * ```c
+ * // kq: [n_head × n_q, n_kv] con nb1 / sizeof(float) elementos por fila
+ * // mask: [n_q, n_kv] (causal -inf / ALiBi) o NULL
+ * llama_cordic_softmax_rows(kq, kq, n_head * n_q, n_kv, nb1 / sizeof(float),
+ *                           1.0f / sqrtf(d_head), mask, mask_stride, n_q);
+ * ```
+ * 
+ * Las funciones sin contexto usan una instancia por hilo llamador y no
+ * reparten trabajo en un pool propio.
+ * 
+ * @return 0 si correcto, -1 si los strides o mask_rows son inválidos
+ */
+int llama_cordic_softmax_rows(const float* logits, float* probs, size_t rows, size_t cols,
+                              size_t row_stride, float scale, const float* mask,
+                              size_t mask_stride, size_t mask_rows);
+
+
+//------------------------------------------------------------------------------
+// API con contexto explícito (reentrante)
+//
+// Cada contexto es independiente; las tablas de ángulos son compartidas e
+// inmutables. Garantías sin locks en la ruta caliente:
+// - Contextos distintos se pueden usar a la vez desde hilos distintos
+// - llama_cordic_ctx_exp / _exp_batch son seguras sobre un mismo contexto
+//   compartido entre hilos
+// - softmax / softmax_rows usan estado propio del contexto: un contexto por
+//   hilo (p.ej. uno por hilo de cómputo de ggml)
+//------------------------------------------------------------------------------
+
+typedef struct llama_cordic_context llama_cordic_context;
+
+/**
+ * @brief Crea un contexto CORDIC
+ * 
+ * @param n_threads Hilos para softmax_rows (0 = todos los núcleos,
+ *                  1 = solo el hilo llamador, recomendado dentro de ggml)
+ * @return Contexto nuevo o NULL si falla la creación
+ */
+llama_cordic_context* llama_cordic_context_create(size_t n_threads);
+
+/**
+ * @brief Libera un contexto (admite NULL)
+ */
+void llama_cordic_context_free(llama_cordic_context* ctx);
+
+float llama_cordic_ctx_exp(const llama_cordic_context* ctx, float x);
+
+void llama_cordic_ctx_exp_batch(const llama_cordic_context* ctx, const float* inputs,
+                                float* outputs, size_t size);
+
+void llama_cordic_ctx_softmax(llama_cordic_context* ctx, const float* logits, float* probs,
+                              size_t vocab_size);
+
+/**
+ * @brief Igual que llama_cordic_softmax_rows sobre un contexto
+ * @return 0 si correcto, -1 si los strides o mask_rows son inválidos
+ */
+int llama_cordic_ctx_softmax_rows(llama_cordic_context* ctx, const float* logits, float* probs,
+                                  size_t rows, size_t cols, size_t row_stride, float scale,
+                                  const float* mask, size_t mask_stride, size_t mask_rows);
+
+/**
+ * @brief Softmax por filas con máscara causal implícita (y ventana opcional)
+ * 
+ * USO EN LLAMA.CPP (soft_max de KQ causal sin tensor de máscara; las claves
+ * futuras no se calculan y quedan a 0):
+ * ```c
+ * llama_cordic_ctx_softmax_rows_causal(ctx, kq, kq, n_head * n_q, n_kv, nb1 / sizeof(float),
+ *                                      1.0f / sqrtf(d_head), n_past, n_q, n_swa);
+ * ```
+ * 
+ * @param first_position Posición de la primera consulta (n_past)
+ * @param positions Consultas distintas (n_q)
+ * @param window Claves visibles por consulta (0 = sin ventana)
+ * @return 0 si correcto, -1 si row_stride < cols o positions == 0
+ */
+int llama_cordic_ctx_softmax_rows_causal(llama_cordic_context* ctx, const float* logits,
+                                         float* probs, size_t rows, size_t cols,
+                                         size_t row_stride, float scale, size_t first_position,
+                                         size_t positions, size_t window);
+
+/**
+ * @brief Softmax con logits F16 / BF16 (bits crudos, como ggml_fp16_t / ggml_bf16_t)
+ * 
+ * USO EN LLAMA.CPP (sin pasada previa de conversión a F32):
+ * ```c
+ * llama_cordic_ctx_softmax_f16(ctx, (const uint16_t *) src->data, dst_f32, ne0);
+ * llama_cordic_ctx_softmax_f16_f16(ctx, src_f16, dst_f16, ne0);
+ * ```
+ */
+void llama_cordic_ctx_softmax_f16(llama_cordic_context* ctx, const uint16_t* logits,
+                                  float* probs, size_t vocab_size);
+void llama_cordic_ctx_softmax_f16_f16(llama_cordic_context* ctx, const uint16_t* logits,
+                                      uint16_t* probs, size_t vocab_size);
+void llama_cordic_ctx_softmax_bf16(llama_cordic_context* ctx, const uint16_t* logits,
+                                   float* probs, size_t vocab_size);
+void llama_cordic_ctx_softmax_bf16_bf16(llama_cordic_context* ctx, const uint16_t* logits,
+                                        uint16_t* probs, size_t vocab_size);
+
+float llama_cordic_ctx_log_sum_exp(const llama_cordic_context* ctx, const float* logits,
+                                   size_t size);
+
+void llama_cordic_ctx_log_softmax(const llama_cordic_context* ctx, const float* logits,
+                                  float* log_probs, size_t vocab_size);
+
+/**
+ * @brief Candidatos top-k / top-p sin softmax completo (modo fusionado)
+ * 
+ * USO EN LLAMA.CPP (en lugar de softmax + top_k + top_p sobre todo el vocabulario):
+ * ```c
+ * int32_t ids[40];
+ * float p[40];
+ * size_t n = llama_cordic_ctx_top_k_top_p(ctx, logits, n_vocab, 40, 0.95f, ids, p);
+ * ```
+ * 
+ * @param top_k Candidatos (0 = vocabulario completo)
+ * @param out_indices, out_probs Capacidad ≥ top_k (o vocab_size si top_k = 0)
+ * @return Número de candidatos escritos (0 si vocab_size = 0)
+ */
+size_t llama_cordic_ctx_top_k_top_p(llama_cordic_context* ctx, const float* logits,
+                                    size_t vocab_size, size_t top_k, float top_p,
+                                    int32_t* out_indices, float* out_probs);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,168 @@
+/**
+ * @file cordic_stats.h
+ * @brief Contadores de instrumentación de la ruta caliente (por hilo)
+ *
+ * FUNCIÓN: Visibilidad en producción sin debug_mode: histograma de
+ * iteraciones greedy, elementos no convergidos, entradas saturadas por el
+ * preprocesador, distribución del factor de reducción n y latencia de cada
+ * llamada softmax.
+ *
+ * COSTE: Solo se compilan con CORDIC_ENABLE_STATS (opción CMake del mismo
+ * nombre); sin ella los puntos de registro son funciones inline vacías. Con
+ * ella cada hilo incrementa sus propios contadores (sin locks ni RMW
+ * atómicos); los kernels SIMD registran una vez por bloque.
+ *
+ * EXPORTACIÓN: API C de snapshot / reset (llama_cordic_stats_*). Este
+ * header se puede incluir desde C.
+ */
+
+#ifndef CORDIC_STATS_H
+#define CORDIC_STATS_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+//==============================================================================
+// API C
+//==============================================================================
+
+/** Iteraciones greedy por elemento: 0 .. 2 × MAX_ITERATIONS */
+#define LLAMA_CORDIC_STATS_ITERATION_BUCKETS 13
+
+/** Factor de reducción n en [MIN, MIN + BUCKETS - 1]; fuera de rango se acumula en los extremos */
+#define LLAMA_CORDIC_STATS_REDUCTION_MIN (-24)
+#define LLAMA_CORDIC_STATS_REDUCTION_BUCKETS 49
+
+/** Latencia de softmax: cubeta b = [2^b, 2^(b+1)) ns (la cubeta 0 incluye 0 ns) */
+#define LLAMA_CORDIC_STATS_LATENCY_BUCKETS 40
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Snapshot de los contadores de todos los hilos desde el último reset
+ *
+ * Todos los campos son uint64_t monotónicos entre resets.
+ */
+typedef struct llama_cordic_stats {
+    uint64_t elements;    /**< Entradas preprocesadas (e^x evaluadas) */
+    uint64_t saturated;   /**< Entradas fuera de ±15, NaN o inf (validateInput) */
+
+    /** n por entrada no saturada: índice n - LLAMA_CORDIC_STATS_REDUCTION_MIN */
+    uint64_t reduction_histogram[LLAMA_CORDIC_STATS_REDUCTION_BUCKETS];
+
+    /** Rotaciones por elemento de las rutas greedy (escalar, tiles, SIMD) */
+    uint64_t iteration_histogram[LLAMA_CORDIC_STATS_ITERATION_BUCKETS];
+    uint64_t not_converged;   /**< Z ≠ 0 al agotar las iteraciones */
+
+    uint64_t softmax_calls;   /**< Llamadas softmax / log_softmax / filas */
+    uint64_t softmax_ns;      /**< Tiempo total de esas llamadas */
+    uint64_t softmax_latency_histogram[LLAMA_CORDIC_STATS_LATENCY_BUCKETS];
+} llama_cordic_stats;
+
+/**
+ * @brief 1 si la librería se compiló con CORDIC_ENABLE_STATS, 0 si no
+ *
+ * Sin contadores, snapshot devuelve siempre ceros.
+ */
+int llama_cordic_stats_enabled(void);
+
+/**
+ * @brief Suma de los contadores de todos los hilos (vivos y terminados)
+ *
+ * Seguro desde cualquier hilo mientras otros registran: cada contador se lee
+ * de forma atómica, aunque el snapshot no es una instantánea global
+ * consistente entre campos. stats = NULL no hace nada.
+ */
+void llama_cordic_stats_snapshot(llama_cordic_stats* stats);
+
+/**
+ * @brief Pone a cero los contadores (los snapshots posteriores parten de aquí)
+ */
+void llama_cordic_stats_reset(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+//==============================================================================
+// PUNTOS DE REGISTRO (C++)
+//==============================================================================
+
+#ifdef __cplusplus
+
+#if defined(CORDIC_ENABLE_STATS)
+#include <chrono>
+#endif
+
+class CORDICStats {
+public:
+#if defined(CORDIC_ENABLE_STATS)
+    static constexpr bool ENABLED = true;
+
+    /**
+     * @brief Entrada preprocesada: saturada o con factor de reducción n
+     */
+    static void recordPreprocess(bool saturated, int reduction_factor);
+
+    /**
+     * @brief Elemento rotado con el bucle greedy
+     */
+    static void recordIterations(int iterations, bool converged);
+
+    static void recordSoftmax(uint64_t nanoseconds);
+#else
+    static constexpr bool ENABLED = false;
+
+    static void recordPreprocess(bool, int) {}
+    static void recordIterations(int, bool) {}
+    static void recordSoftmax(uint64_t) {}
+#endif
+};
+
+/**
+ * @brief Mide una llamada softmax desde su construcción hasta su destrucción
+ */
+class CORDICStatsTimer {
+public:
+#if defined(CORDIC_ENABLE_STATS)
+    CORDICStatsTimer() : start(std::chrono::steady_clock::now()) {}
+    ~CORDICStatsTimer() {
+        const auto elapsed = std::chrono::steady_clock::now() - start;
+        CORDICStats::recordSoftmax(static_cast<uint64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count()));
+    }
+
+private:
+    std::chrono::steady_clock::time_point start;
+#else
+    CORDICStatsTimer() {}
+    ~CORDICStatsTimer() {}
+#endif
+
+    CORDICStatsTimer(const CORDICStatsTimer&) = delete;
+    CORDICStatsTimer& operator=(const CORDICStatsTimer&) = delete;
+};
+
+#if defined(CORDIC_ENABLE_STATS)
+/**
+ * @brief Registro de un bloque de lanes desde los kernels SIMD
+ *
+ * Función no inline: los kernels se compilan con flags de ISA propios y no
+ * deben instanciar código compartido. Se llama antes de escribir la salida
+ * (inputs puede ser el mismo buffer que outputs).
+ *
+ * @param inputs Entradas del bloque (saturación con el criterio de validateInput)
+ * @param iterations Rotaciones por lane
+ * @param residuals Z final por lane (converge si Z = 0 antes del límite)
+ * @param reduction Factor n por lane (ignorado en lanes saturadas)
+ * @param lanes Lanes válidas (< ancho del bloque en la cola)
+ */
+void cordicStatsRecordBlock(const float* inputs, const int16_t* iterations,
+                            const int16_t* residuals, const int32_t* reduction, size_t lanes);
+#endif
+
+#endif  // __cplusplus
+
+#endif // CORDIC_STATS_H
@@ -0,0 +1,199 @@
+/**
+ * @file cordic_stream.h
+ * @brief Softmax por filas sobre volcados de logits mapeados en memoria
+ *
+ * FUNCIÓN: Evaluación offline de volcados tokens × vocab en float32 crudo
+ * (cientos de GB): probabilidades de cada fila o log-probabilidad del token
+ * objetivo de cada fila (NLL = -log p).
+ *
+ * ESTRATEGIA:
+ * - Entrada y salida mapeadas con mmap: las filas se leen del page cache y
+ *   la salida se escribe directamente en el fichero, sin copias completas
+ * - Lotes de filas (~4 MB) repartidos entre los hilos de un CORDICThreadPool;
+ *   cada hilo tiene su CORDICSoftmax y toma lotes de un contador atómico
+ * - Cada lote pide al kernel el lote (hilos + prefetch_batches) posiciones por
+ *   delante (MADV_WILLNEED) y al terminar suelta sus páginas de entrada ya
+ *   leídas (MADV_DONTNEED), así la memoria residente no crece con el fichero
+ *
+ * Las probabilidades son idénticas bit a bit a computeSoftmax fila a fila, y
+ * la log-probabilidad es x_t - computeLogSumExp(fila) para cualquier número
+ * de hilos. Solo POSIX (mmap / madvise).
+ */
+
+#ifndef CORDIC_STREAM_H
+#define CORDIC_STREAM_H
+
+#include "cordic_softmax.h"
+#include "cordic_thread_pool.h"
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Fichero mapeado en memoria (RAII, solo movible)
+ */
+class CORDICMappedFile {
+private:
+    void* address;
+    size_t length;
+    bool writable;
+
+    CORDICMappedFile(void* address, size_t length, bool writable);
+
+public:
+    CORDICMappedFile() : address(nullptr), length(0), writable(false) {}
+    ~CORDICMappedFile();
+
+    CORDICMappedFile(CORDICMappedFile&& other) noexcept;
+    CORDICMappedFile& operator=(CORDICMappedFile&& other) noexcept;
+    CORDICMappedFile(const CORDICMappedFile&) = delete;
+    CORDICMappedFile& operator=(const CORDICMappedFile&) = delete;
+
+    /**
+     * @brief Mapea un fichero existente en solo lectura (acceso secuencial)
+     * @throws std::runtime_error si no se puede abrir o mapear
+     */
+    static CORDICMappedFile openRead(const std::string& path);
+
+    /**
+     * @brief Crea (o trunca) un fichero de size bytes y lo mapea en lectura / escritura
+     * @throws std::runtime_error si no se puede crear, redimensionar o mapear
+     */
+    static CORDICMappedFile create(const std::string& path, size_t size);
+
+    const void* data() const { return address; }
+    void* data() { return address; }
+    size_t size() const { return length; }
+
+    /**
+     * @brief Pide al kernel que lea [offset, offset + bytes) por adelantado
+     */
+    void prefetch(size_t offset, size_t bytes) const;
+
+    /**
+     * @brief Suelta las páginas completas de [offset, offset + bytes) ya consumidas
+     *
+     * Solo en mapeos de lectura: los datos siguen en el fichero y una lectura
+     * posterior vuelve a cargarlos.
+     */
+    void release(size_t offset, size_t bytes) const;
+};
+
+/**
+ * @brief Qué se escribe por fila
+ */
+enum class CORDICStreamOutput {
+    PROBABILITIES,     // vocab floats por fila (softmax)
+    TARGET_LOG_PROB    // 1 float por fila: log p(objetivo)
+};
+
+/**
+ * @brief Configuración del procesado por lotes
+ */
+struct CORDICStreamConfig {
+    size_t vocab_size;          // Elementos por fila
+    size_t num_threads;         // 0 = hardware_concurrency
+    size_t rows_per_batch;      // 0 = filas de ~4 MB de logits
+    size_t prefetch_batches;    // Lotes pedidos con MADV_WILLNEED además de los que están en curso
+
+    explicit CORDICStreamConfig(size_t vocab, size_t threads = 0, size_t batch_rows = 0,
+                                size_t prefetch = 2)
+        : vocab_size(vocab), num_threads(threads), rows_per_batch(batch_rows),
+          prefetch_batches(prefetch) {}
+};
+
+/**
+ * @brief Resultado de una pasada: volumen, tiempo y throughput sostenido
+ */
+struct CORDICStreamReport {
+    size_t rows = 0;
+    uint64_t bytes_read = 0;       // Logits (+ objetivos)
+    uint64_t bytes_written = 0;    // Probabilidades o log-probabilidades
+    double seconds = 0.0;
+    double nll_sum = 0.0;          // Σ -log p(objetivo) en orden de fila (solo TARGET_LOG_PROB)
+
+    /**
+     * @brief (bytes leídos + escritos) / segundos, en GB/s (10^9)
+     */
+    double gigabytesPerSecond() const;
+};
+
+class CORDICLogitStream {
+public:
+    static constexpr size_t DEFAULT_BATCH_BYTES = size_t(4) << 20;
+
+private:
+    CORDICStreamConfig config;
+    size_t batch_rows;
+    CORDICThreadPool pool;
+    std::vector<std::unique_ptr<CORDICSoftmax>> engines;   // Uno por hilo del pool
+
+public:
+    /**
+     * @brief Constructor
+     * @throws std::invalid_argument si vocab_size == 0
+     */
+    explicit CORDICLogitStream(const CORDICStreamConfig& config);
+
+    CORDICLogitStream(const CORDICLogitStream&) = delete;
+    CORDICLogitStream& operator=(const CORDICLogitStream&) = delete;
+
+    /**
+     * @brief Modo de suma de todos los motores (ver CORDICSoftmax::setSumMode)
+     */
+    void setSumMode(CORDICSumMode mode);
+
+    const CORDICStreamConfig& getConfig() const { return config; }
+    size_t getBatchRows() const { return batch_rows; }
+    size_t getThreadCount() const { return pool.size(); }
+
+    /**
+     * @brief Softmax de rows filas contiguas (computeSoftmax por fila)
+     *
+     * Admite logits == probabilities.
+     */
+    CORDICStreamReport computeProbabilities(const float* logits, float* probabilities,
+                                            size_t rows);
+
+    /**
+     * @brief log p(targets[r]) de cada fila: logits[r][t] - log Σ e^(logits[r][j])
+     * @throws std::invalid_argument si algún objetivo está fuera de [0, vocab)
+     */
+    CORDICStreamReport computeTargetLogProbs(const float* logits, const int32_t* targets,
+                                             float* log_probs, size_t rows);
+
+    /**
+     * @brief Procesa un volcado de logits a un fichero de salida
+     *
+     * logits_path: float32 crudo, filas × vocab_size (el número de filas sale
+     * del tamaño). Con PROBABILITIES la salida tiene el mismo tamaño; con
+     * TARGET_LOG_PROB targets_path tiene un int32 por fila y la salida un
+     * float por fila.
+     *
+     * @throws std::invalid_argument si el tamaño no es múltiplo de una fila,
+     *         el de los objetivos no coincide o un objetivo está fuera de rango
+     * @throws std::runtime_error si falla la E/S
+     */
+    CORDICStreamReport processFile(const std::string& logits_path, const std::string& output_path,
+                                   CORDICStreamOutput output,
+                                   const std::string& targets_path = std::string());
+
+private:
+    /**
+     * @brief Reparte los lotes entre los hilos; prefetch / release si hay mapeo de entrada
+     */
+    void runBatches(const float* logits, size_t rows, const CORDICMappedFile* input,
+                    const std::function<void(CORDICSoftmax&, size_t, size_t)>& batch);
+
+    CORDICStreamReport probabilities(const float* logits, float* probabilities, size_t rows,
+                                     const CORDICMappedFile* input);
+
+    CORDICStreamReport targetLogProbs(const float* logits, const int32_t* targets,
+                                      float* log_probs, size_t rows,
+                                      const CORDICMappedFile* input);
+};
+
+#endif // CORDIC_STREAM_H
@@ -0,0 +1,398 @@
+/**
+ * @file cordic_tables.h
+ * @brief Tablas CORDIC en tiempo de compilación y secuencia de rotaciones fija
+ *
+ * FUNCIÓN: Generar los ángulos α_k = arctanh(2^-k) en Q3.12 crudo como
+ * arrays constexpr (sin std::atanh / std::pow en tiempo de ejecución), los
+ * umbrales enteros de la selección greedy derivados de ellos y describir
+ * una secuencia de rotaciones de longitud fija.
+ *
+ * SECUENCIA FIJA:
+ * - k = 1 .. FRAC_WIDTH (α_k para k > FRAC_WIDTH se cuantiza a 0 en Q3.12),
+ *   o acortada a k = 1 .. N con FixedRotator<Word, Frac, N>
+ * - Repeticiones en k = 4, 7, 10, 13 (misma regla que el iterador greedy)
+ * - Dirección s = sign(Z) en cada paso: sin selección de ángulo ni salida
+ *   anticipada, el desenrollado produce código lineal de shifts y sumas
+ *
+ * Es la forma que se sintetiza directamente en HLS: cada paso es una etapa
+ * de pipeline con shift constante. Las plantillas admiten cualquier formato
+ * FixedPoint<Word, Frac> (ver cordic_format.h); las constantes sin plantilla
+ * son las del formato del pipeline, Q3.12.
+ *
+ * MODO VECTORING: la misma secuencia con dirección s = -sign(Y) lleva Y a 0
+ * y acumula arctanh(Y₀ / X₀) en Z, base del logaritmo.
+ */
+
+#ifndef CORDIC_TABLES_H
+#define CORDIC_TABLES_H
+
+#include "cordic_types.h"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+namespace CORDICTables {
+
+constexpr int TABLE_SIZE = 15;
+
+//==============================================================================
+// FUNCIONES constexpr
+//==============================================================================
+
+/**
+ * @brief 2^-k exacto en double
+ */
+constexpr double pow2Neg(int k) {
+    double value = 1.0;
+    for (int i = 0; i < k; i++) {
+        value *= 0.5;
+    }
+    return value;
+}
+
+/**
+ * @brief arctanh(t) por la serie Σ t^(2n+1) / (2n+1)
+ *
+ * Para |t| ≤ 1/2 converge a precisión double en menos de 30 términos.
+ */
+constexpr double atanhSeries(double t) {
+    const double t_squared = t * t;
+    double term = t;
+    double sum = 0.0;
+    for (int n = 0; n < 64; n++) {
+        const double addend = term / (2 * n + 1);
+        if (sum + addend == sum) {
+            break;
+        }
+        sum += addend;
+        term *= t_squared;
+    }
+    return sum;
+}
+
+/**
+ * @brief Raíz cuadrada por Newton (v > 0)
+ */
+constexpr double sqrtNewton(double v) {
+    double x = v > 1.0 ? v : 1.0;
+    for (int i = 0; i < 64; i++) {
+        const double next = 0.5 * (x + v / x);
+        if (next == x) {
+            break;
+        }
+        x = next;
+    }
+    return x;
+}
+
+/**
+ * @brief Cuantización idéntica a FixedPoint<Word, Frac>(double): truncado hacia 0
+ */
+template <typename Word, int Frac>
+constexpr Word quantize(double value) {
+    return static_cast<Word>(static_cast<int64_t>(value * static_cast<double>(int64_t(1) << Frac)));
+}
+
+constexpr bool isRepeatedShift(int k) {
+    return k >= 4 && (k - 4) % 3 == 0;
+}
+
+//==============================================================================
+// TABLA DE ÁNGULOS
+//==============================================================================
+
+/**
+ * @brief α_k = arctanh(2^-k) para k = 1..Size en el formato <Word, Frac>
+ */
+template <typename Word, int Frac, int Size>
+constexpr std::array<Word, Size + 1> makeRawAngles() {
+    std::array<Word, Size + 1> angles{};
+    for (int k = 1; k <= Size; k++) {
+        angles[k] = quantize<Word, Frac>(atanhSeries(pow2Neg(k)));
+    }
+    return angles;
+}
+
+/**
+ * @brief α_k = arctanh(2^-k) en Q3.12 crudo (índice base 1, [0] = 0)
+ */
+constexpr std::array<int16_t, TABLE_SIZE + 1> RAW_ANGLES =
+    makeRawAngles<int16_t, CORDICConfig::FRAC_WIDTH, TABLE_SIZE>();
+
+static_assert(RAW_ANGLES[1] == 2249, "α_1 = arctanh(1/2) en Q3.12");
+static_assert(RAW_ANGLES[CORDICConfig::FRAC_WIDTH] == 1, "α_FRAC es el último ángulo no nulo");
+static_assert(RAW_ANGLES[CORDICConfig::FRAC_WIDTH + 1] == 0, "α_k > FRAC se cuantiza a 0");
+
+//==============================================================================
+// SELECCIÓN GREEDY
+//==============================================================================
+
+/**
+ * @brief Longitud en bits máxima de |Z| crudo (|INT16_MIN| = 2^15)
+ */
+constexpr int GREEDY_MAX_BIT_LENGTH = 16;
+constexpr int32_t GREEDY_MAX_ABS_RAW = int32_t(1) << (GREEDY_MAX_BIT_LENGTH - 1);
+
+/**
+ * @brief Menor |Z| crudo que selecciona α_k: RAW_ANGLES[k] ≤ |Z|
+ *
+ * Los α_k cuantizados a 0 exigen |Z| ≥ 1 (Z = 0 ya ha convergido).
+ */
+constexpr std::array<int32_t, TABLE_SIZE + 1> makeGreedyThresholds() {
+    std::array<int32_t, TABLE_SIZE + 1> thresholds{};
+    for (int k = 1; k <= TABLE_SIZE; k++) {
+        thresholds[k] = RAW_ANGLES[k] > 0 ? RAW_ANGLES[k] : 1;
+    }
+    return thresholds;
+}
+
+constexpr std::array<int32_t, TABLE_SIZE + 1> GREEDY_THRESHOLDS = makeGreedyThresholds();
+
+/**
+ * @brief Menor k con |Z| ≥ umbral(k): el mayor ángulo que cabe en |Z|
+ */
+constexpr int greedyIndexScan(int32_t abs_z_raw) {
+    for (int k = 1; k <= TABLE_SIZE; k++) {
+        if (abs_z_raw >= GREEDY_THRESHOLDS[k]) {
+            return k;
+        }
+    }
+    return TABLE_SIZE;
+}
+
+/**
+ * @brief Extremos [2^(b-1), 2^b) de |Z| con longitud en bits b
+ */
+constexpr int32_t bitLengthLow(int b) {
+    return int32_t(1) << (b - 1);
+}
+
+constexpr int32_t bitLengthHigh(int b) {
+    return (int32_t(1) << b) - 1 < GREEDY_MAX_ABS_RAW ? (int32_t(1) << b) - 1 : GREEDY_MAX_ABS_RAW;
+}
+
+/**
+ * @brief Candidato k_b por longitud en bits: el k de |Z| = 2^b - 1
+ */
+constexpr std::array<int16_t, GREEDY_MAX_BIT_LENGTH + 1> makeGreedyCandidates() {
+    std::array<int16_t, GREEDY_MAX_BIT_LENGTH + 1> candidates{};
+    for (int b = 1; b <= GREEDY_MAX_BIT_LENGTH; b++) {
+        candidates[b] = static_cast<int16_t>(greedyIndexScan(bitLengthHigh(b)));
+    }
+    return candidates;
+}
+
+/**
+ * @brief Umbral de k_b: |Z| ≥ umbral selecciona k_b, si no k_b + 1 (0 si b no abarca dos k)
+ */
+constexpr std::array<int32_t, GREEDY_MAX_BIT_LENGTH + 1> makeGreedySplits() {
+    std::array<int32_t, GREEDY_MAX_BIT_LENGTH + 1> splits{};
+    for (int b = 1; b <= GREEDY_MAX_BIT_LENGTH; b++) {
+        const int k_high = greedyIndexScan(bitLengthHigh(b));
+        splits[b] = greedyIndexScan(bitLengthLow(b)) == k_high ? 0 : GREEDY_THRESHOLDS[k_high];
+    }
+    return splits;
+}
+
+constexpr std::array<int16_t, GREEDY_MAX_BIT_LENGTH + 1> GREEDY_CANDIDATES = makeGreedyCandidates();
+constexpr std::array<int32_t, GREEDY_MAX_BIT_LENGTH + 1> GREEDY_SPLITS = makeGreedySplits();
+
+/**
+ * @brief Cada longitud en bits abarca como mucho dos k consecutivos (α_k ≈ 2^-k)
+ */
+constexpr bool greedyBitLengthsSpanTwoAngles() {
+    for (int b = 1; b <= GREEDY_MAX_BIT_LENGTH; b++) {
+        if (greedyIndexScan(bitLengthLow(b)) - greedyIndexScan(bitLengthHigh(b)) > 1) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static_assert(greedyBitLengthsSpanTwoAngles(), "Más de dos ángulos por longitud en bits");
+static_assert(GREEDY_CANDIDATES[12] == 1 && GREEDY_SPLITS[12] == RAW_ANGLES[1],
+              "|Z| de 12 bits decide entre α_1 y α_2");
+
+//==============================================================================
+// SECUENCIA FIJA
+//==============================================================================
+
+/**
+ * @brief Número de pasos de la secuencia k = 1..LastShift con repeticiones
+ */
+template <int LastShift>
+constexpr int fixedScheduleLength() {
+    int length = 0;
+    for (int k = 1; k <= LastShift; k++) {
+        length += isRepeatedShift(k) ? 2 : 1;
+    }
+    return length;
+}
+
+template <int LastShift>
+constexpr std::array<int, fixedScheduleLength<LastShift>()> makeFixedSchedule() {
+    std::array<int, fixedScheduleLength<LastShift>()> schedule{};
+    int index = 0;
+    for (int k = 1; k <= LastShift; k++) {
+        schedule[index++] = k;
+        if (isRepeatedShift(k)) {
+            schedule[index++] = k;
+        }
+    }
+    return schedule;
+}
+
+/**
+ * @brief Ganancia K = Π √(1 - 2^-2k) de la secuencia (constante)
+ */
+template <int LastShift>
+constexpr double fixedScheduleGain() {
+    double gain_squared = 1.0;
+    for (int k : makeFixedSchedule<LastShift>()) {
+        gain_squared *= 1.0 - pow2Neg(2 * k);
+    }
+    return sqrtNewton(gain_squared);
+}
+
+/**
+ * @brief Σ α_k cuantizados de la secuencia: mayor |z| que puede anular
+ */
+template <typename Word, int Frac, int LastShift = Frac>
+constexpr double fixedScheduleRange() {
+    constexpr auto angles = makeRawAngles<Word, Frac, LastShift>();
+    double range = 0.0;
+    for (int k : makeFixedSchedule<LastShift>()) {
+        range += static_cast<double>(angles[k]) / static_cast<double>(int64_t(1) << Frac);
+    }
+    return range;
+}
+
+// Secuencia del formato del pipeline (Q3.12): α_k > FRAC_WIDTH es 0
+constexpr int FIXED_LAST_SHIFT = CORDICConfig::FRAC_WIDTH;
+constexpr int FIXED_SCHEDULE_LENGTH = fixedScheduleLength<FIXED_LAST_SHIFT>();
+
+/**
+ * @brief Shifts k de cada paso de la secuencia fija
+ */
+constexpr std::array<int, FIXED_SCHEDULE_LENGTH> FIXED_SCHEDULE =
+    makeFixedSchedule<FIXED_LAST_SHIFT>();
+
+/**
+ * @brief Ganancia de la secuencia fija Q3.12
+ *
+ * Tras la secuencia X = K·cosh(z), Y = K·sinh(z) partiendo de X = 1, Y = 0.
+ */
+constexpr double FIXED_SCHEDULE_GAIN = fixedScheduleGain<FIXED_LAST_SHIFT>();
+
+/**
+ * @brief 1/K redondeado al formato: X₀ que pliega la ganancia en la entrada
+ */
+template <typename Word, int Frac, int LastShift = Frac>
+constexpr Word foldedInitialX() {
+    return static_cast<Word>(static_cast<int64_t>(
+        static_cast<double>(int64_t(1) << Frac) / fixedScheduleGain<LastShift>() + 0.5));
+}
+
+/**
+ * @brief X₀ = 1/K en Q3.12: tras la secuencia X = cosh(z), Y = sinh(z)
+ */
+constexpr int16_t FIXED_SCHEDULE_FOLDED_X0 = foldedInitialX<int16_t, FIXED_LAST_SHIFT>();
+
+static_assert(fixedScheduleRange<int16_t, CORDICConfig::FRAC_WIDTH>() >
+                  CORDICConfig::CONVERGENCE_LIMIT,
+              "La secuencia fija no cubre el rango reducido |x'| ≤ ln(2)/2");
+
+//==============================================================================
+// ROTACIONES DESENROLLADAS
+//==============================================================================
+
+/**
+ * @brief Secuencia fija k = 1..LastShift desenrollada para el formato <Word, Frac>
+ *
+ * Mismas ecuaciones y aritmética entera que CORDICIterator::executeRotationStep.
+ * LastShift = N < Frac acorta la secuencia: el ángulo residual queda por
+ * debajo de ~α_N ≈ 2^-N y la ganancia (plegada en FOLDED_X0) es la de esos pasos.
+ */
+template <typename Word, int Frac, int LastShift = Frac>
+struct FixedRotator {
+    static_assert(LastShift >= 1 && LastShift <= Frac, "LastShift fuera de [1, Frac]");
+
+    static constexpr std::array<Word, LastShift + 1> ANGLES = makeRawAngles<Word, Frac, LastShift>();
+    static constexpr auto SCHEDULE = makeFixedSchedule<LastShift>();
+    static constexpr int LENGTH = static_cast<int>(SCHEDULE.size());
+    static constexpr double GAIN = fixedScheduleGain<LastShift>();
+    static constexpr Word FOLDED_X0 = foldedInitialX<Word, Frac, LastShift>();
+
+    static_assert(fixedScheduleRange<Word, Frac, LastShift>() > CORDICConfig::CONVERGENCE_LIMIT,
+                  "La secuencia fija no cubre el rango reducido |x'| ≤ ln(2)/2");
+
+    template <size_t I>
+    static inline void step(Word& x, Word& y, Word& z) {
+        constexpr int k = SCHEDULE[I];
+        constexpr Word angle = ANGLES[k];
+
+        // sign = 0 (Z ≥ 0) o -1 (Z < 0): (v ^ sign) - sign = ±v sin saltos
+        const Word sign = static_cast<Word>(z >> (sizeof(Word) * 8 - 1));
+        const Word delta_x = static_cast<Word>(y >> k);
+        const Word delta_y = static_cast<Word>(x >> k);
+        x = static_cast<Word>(x + ((delta_x ^ sign) - sign));
+        y = static_cast<Word>(y + ((delta_y ^ sign) - sign));
+        z = static_cast<Word>(z - ((angle ^ sign) - sign));
+    }
+
+    template <size_t... I>
+    static inline void run(Word& x, Word& y, Word& z, std::index_sequence<I...>) {
+        (step<I>(x, y, z), ...);
+    }
+
+    /**
+     * @brief Aplica LENGTH rotaciones desenrolladas sobre X, Y, Z crudos
+     */
+    static inline void rotate(Word& x, Word& y, Word& z) {
+        run(x, y, z, std::make_index_sequence<LENGTH>{});
+    }
+
+    /**
+     * @brief Paso en modo vectoring: dirección -sign(Y) para llevar Y → 0
+     */
+    template <size_t I>
+    static inline void vectorStep(Word& x, Word& y, Word& z) {
+        constexpr int k = SCHEDULE[I];
+        constexpr Word angle = ANGLES[k];
+
+        const Word sign = static_cast<Word>(y >> (sizeof(Word) * 8 - 1));
+        const Word delta_x = static_cast<Word>(y >> k);
+        const Word delta_y = static_cast<Word>(x >> k);
+        x = static_cast<Word>(x - ((delta_x ^ sign) - sign));
+        y = static_cast<Word>(y - ((delta_y ^ sign) - sign));
+        z = static_cast<Word>(z + ((angle ^ sign) - sign));
+    }
+
+    template <size_t... I>
+    static inline void runVectoring(Word& x, Word& y, Word& z, std::index_sequence<I...>) {
+        (vectorStep<I>(x, y, z), ...);
+    }
+
+    /**
+     * @brief Modo vectoring: con X > |Y|, deja Z += arctanh(Y₀ / X₀) e Y ≈ 0
+     *
+     * Converge si |arctanh(Y₀ / X₀)| no supera la suma de ángulos (≈ 1.1).
+     */
+    static inline void vectorize(Word& x, Word& y, Word& z) {
+        runVectoring(x, y, z, std::make_index_sequence<LENGTH>{});
+    }
+};
+
+/**
+ * @brief Aplica la secuencia fija Q3.12 completa sobre X, Y, Z crudos
+ *
+ * FIXED_SCHEDULE_LENGTH pasos desenrollados en tiempo de compilación.
+ */
+inline void rotateFixedSchedule(int16_t& x, int16_t& y, int16_t& z) {
+    FixedRotator<int16_t, CORDICConfig::FRAC_WIDTH>::rotate(x, y, z);
+}
+
+}  // namespace CORDICTables
+
+#endif // CORDIC_TABLES_H
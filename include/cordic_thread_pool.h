@@ -0,0 +1,83 @@
+/**
+ * @file cordic_thread_pool.h
+ * @brief Pool persistente de hilos para softmax sobre vocabularios grandes
+ *
+ * FUNCIÓN: Repartir tareas indexadas (chunks del vocabulario, filas) entre
+ * hilos creados una sola vez, sin crear/destruir hilos por llamada.
+ *
+ * MODELO:
+ * - parallelFor(n, task) ejecuta task(0..n-1), cada índice exactamente una vez
+ * - El hilo llamador también ejecuta tareas
+ * - Las tareas se reparten dinámicamente (contador atómico); el resultado
+ *   solo debe depender del índice de tarea, nunca del hilo que la ejecuta
+ */
+
+#ifndef CORDIC_THREAD_POOL_H
+#define CORDIC_THREAD_POOL_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+class CORDICThreadPool {
+private:
+    std::vector<std::thread> workers;
+
+    std::mutex dispatch_mutex;  // Serializa llamadas concurrentes a parallelFor
+    std::mutex mutex;
+    std::condition_variable work_cv;
+    std::condition_variable done_cv;
+
+    const std::function<void(size_t)>* current_task;
+    size_t task_count;
+    std::atomic<size_t> next_task;
+    size_t pending_workers;
+    uint64_t generation;
+    bool stopping;
+    std::exception_ptr first_error;
+
+public:
+    /**
+     * @brief Constructor
+     * @param num_threads Hilos totales incluyendo el llamador
+     *                    (0 = std::thread::hardware_concurrency())
+     */
+    explicit CORDICThreadPool(size_t num_threads = 0);
+    ~CORDICThreadPool();
+
+    CORDICThreadPool(const CORDICThreadPool&) = delete;
+    CORDICThreadPool& operator=(const CORDICThreadPool&) = delete;
+
+    /**
+     * @brief Número total de hilos (workers + llamador)
+     */
+    size_t size() const { return workers.size() + 1; }
+
+    /**
+     * @brief Ejecuta task(i) para i en [0, num_tasks) y espera a que terminen
+     *
+     * No reentrante: una tarea no debe llamar a parallelFor del mismo pool.
+     * Si alguna tarea lanza, se relanza la primera excepción en el llamador.
+     *
+     * @param num_tasks Número de tareas
+     * @param task Función a ejecutar por índice
+     */
+    void parallelFor(size_t num_tasks, const std::function<void(size_t)>& task);
+
+    /**
+     * @brief Hilos por defecto (hardware_concurrency, mínimo 1)
+     */
+    static size_t defaultThreadCount();
+
+private:
+    void workerLoop();
+    void runTasks();
+};
+
+#endif // CORDIC_THREAD_POOL_H
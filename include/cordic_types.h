@@ -8,8 +8,11 @@
 #ifndef CORDIC_TYPES_H
 #define CORDIC_TYPES_H
 
+#include <cstddef>
 #include <cstdint>
 #include <cmath>
+#include <limits>
+#include <type_traits>
 #include <vector>
 
 //==============================================================================
@@ -44,28 +47,46 @@ namespace CORDICConfig {
 // CLASE PUNTO FIJO
 //==============================================================================
 
-class FixedPoint16 {
+/**
+ * @brief Punto fijo con signo sobre Word con Frac bits fraccionales
+ * 
+ * Formatos usados: Q3.12 en int16_t (FixedPoint16, el del pipeline),
+ * Q2.29 en int32_t y Q8.8 en int16_t. La conversión desde float/double
+ * trunca hacia 0 y satura al rango de Word.
+ */
+template <typename Word, int Frac>
+class FixedPoint {
+    static_assert(std::is_integral<Word>::value && std::is_signed<Word>::value,
+                  "FixedPoint requiere un entero con signo");
+    static_assert(Frac > 0 && Frac < static_cast<int>(sizeof(Word) * 8) - 1,
+                  "Bits fraccionales fuera del rango de Word");
+
 private:
-    int16_t value;
-    static constexpr int16_t FIXED_ONE = 1 << CORDICConfig::FRAC_WIDTH;
-    static constexpr int16_t MAX_VAL = INT16_MAX;
-    static constexpr int16_t MIN_VAL = INT16_MIN;
+    Word value;
+    static constexpr Word FIXED_ONE = static_cast<Word>(Word(1) << Frac);
+    static constexpr Word MAX_VAL = std::numeric_limits<Word>::max();
+    static constexpr Word MIN_VAL = std::numeric_limits<Word>::min();
     
 public:
-    FixedPoint16() : value(0) {}
+    using WordType = Word;
+    static constexpr int WORD_BITS = static_cast<int>(sizeof(Word) * 8);
+    static constexpr int FRAC_BITS = Frac;
+    static constexpr int INT_BITS = WORD_BITS - 1 - Frac;
+    
+    FixedPoint() : value(0) {}
     
-    explicit FixedPoint16(float val) {
-        int32_t temp = static_cast<int32_t>(val * FIXED_ONE);
+    explicit FixedPoint(float val) {
+        int64_t temp = static_cast<int64_t>(val * FIXED_ONE);
         if (temp > MAX_VAL) temp = MAX_VAL;
         if (temp < MIN_VAL) temp = MIN_VAL;
-        value = static_cast<int16_t>(temp);
+        value = static_cast<Word>(temp);
     }
     
-    explicit FixedPoint16(double val) {
-        int32_t temp = static_cast<int32_t>(val * FIXED_ONE);
+    explicit FixedPoint(double val) {
+        int64_t temp = static_cast<int64_t>(val * FIXED_ONE);
         if (temp > MAX_VAL) temp = MAX_VAL;
         if (temp < MIN_VAL) temp = MIN_VAL;
-        value = static_cast<int16_t>(temp);
+        value = static_cast<Word>(temp);
     }
     
     float toFloat() const {
@@ -76,24 +97,29 @@ public:
         return static_cast<double>(value) / FIXED_ONE;
     }
     
-    int16_t getRaw() const { return value; }
-    void setRaw(int16_t val) { value = val; }
+    /**
+     * @brief Resolución (1 LSB) del formato
+     */
+    static constexpr double resolution() { return 1.0 / FIXED_ONE; }
+    
+    Word getRaw() const { return value; }
+    void setRaw(Word val) { value = val; }
     
-    FixedPoint16 operator+(const FixedPoint16& other) const {
-        FixedPoint16 result;
-        result.value = value + other.value;
+    FixedPoint operator+(const FixedPoint& other) const {
+        FixedPoint result;
+        result.value = static_cast<Word>(value + other.value);
         return result;
     }
     
-    FixedPoint16 operator-(const FixedPoint16& other) const {
-        FixedPoint16 result;
-        result.value = value - other.value;
+    FixedPoint operator-(const FixedPoint& other) const {
+        FixedPoint result;
+        result.value = static_cast<Word>(value - other.value);
         return result;
     }
     
-    FixedPoint16 operator>>(int shift) const {
-        FixedPoint16 result;
-        result.value = value >> shift;
+    FixedPoint operator>>(int shift) const {
+        FixedPoint result;
+        result.value = static_cast<Word>(value >> shift);
         return result;
     }
     
@@ -108,6 +134,15 @@ public:
     }
 };
 
+/**
+ * @brief Formato del pipeline: Q3.12 en 16 bits
+ */
+using FixedPoint16 = FixedPoint<int16_t, CORDICConfig::FRAC_WIDTH>;
+
+static_assert(FixedPoint16::WORD_BITS == CORDICConfig::WORD_WIDTH &&
+              FixedPoint16::INT_BITS == CORDICConfig::INT_WIDTH,
+              "CORDICConfig no coincide con FixedPoint16");
+
 //==============================================================================
 // ESTRUCTURAS DE DATOS
 //==============================================================================
@@ -131,6 +166,43 @@ struct CORDICState {
         : X(x), Y(y), Z(z), iteration_count(0), converged(false) {}
 };
 
+/**
+ * @brief Estado CORDIC en enteros planos (Q3.12 crudo)
+ * 
+ * Usado por la ruta rápida: sin vector de ángulos ni campos de diagnóstico,
+ * no realiza ninguna asignación dinámica.
+ */
+struct CORDICRawState {
+    int16_t X, Y, Z;
+    int iteration_count;
+    bool converged;
+    
+    CORDICRawState() : X(0), Y(0), Z(0), iteration_count(0), converged(false) {}
+    CORDICRawState(int16_t x, int16_t y, int16_t z) 
+        : X(x), Y(y), Z(z), iteration_count(0), converged(false) {}
+};
+
+/**
+ * @brief Estado CORDIC de un tile de elementos en estructura de arrays (SoA)
+ * 
+ * X, Y, Z contiguos por separado (Q3.12 crudo) para que cada paso de
+ * rotación recorra el tile completo en L1 con accesos unitarios, forma que
+ * el compilador vectoriza. Ver CORDICIterator::performIterationsTile.
+ */
+struct CORDICTileState {
+    static constexpr size_t SIZE = 256;
+    
+    alignas(64) int16_t X[SIZE];
+    alignas(64) int16_t Y[SIZE];
+    alignas(64) int16_t Z[SIZE];
+    alignas(64) int16_t iteration_count[SIZE];
+    alignas(64) int16_t pending_repeat[SIZE];   // k de la repetición pendiente (0 = ninguna)
+    alignas(64) uint8_t converged[SIZE];
+    size_t count;                               // Elementos válidos (≤ SIZE)
+    
+    CORDICTileState() : count(0) {}
+};
+
 struct IterationResult {
     CORDICState final_state;
     std::vector<int> selected_angles;
@@ -0,0 +1,174 @@
+/**
+ * @file cordic_accumulator.cpp
+ * @brief Implementación del acumulador exacto de 384 bits
+ */
+
+#include "cordic_accumulator.h"
+#include <cmath>
+#include <cstring>
+#include <stdexcept>
+
+namespace {
+
+// Índice del bit de peso 2^128: ningún término float finito llega a él
+constexpr int OVERFLOW_BIT = 128 - CORDICExactAccumulator::LSB_EXPONENT;
+
+// Índice del bit de peso 2^-149 (subnormal mínimo): último bit de un float
+constexpr int FLOAT_MIN_BIT = -149 - CORDICExactAccumulator::LSB_EXPONENT;
+
+/**
+ * @brief Número de bits significativos de v > 0 (64 - clz)
+ */
+inline int bitLength(uint64_t v) {
+#if defined(__GNUC__) || defined(__clang__)
+    return 64 - __builtin_clzll(v);
+#else
+    int bits = 0;
+    while (v != 0) {
+        v >>= 1;
+        bits++;
+    }
+    return bits;
+#endif
+}
+
+}  // namespace
+
+void CORDICExactAccumulator::reset() {
+    for (uint64_t& limb : limbs) {
+        limb = 0;
+    }
+    non_finite = 0.0f;
+}
+
+void CORDICExactAccumulator::add(float value, int exponent) {
+    uint32_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    const uint32_t biased = (bits >> 23) & 0xFF;
+    if (biased == 0xFF) {
+        non_finite += value;
+        return;
+    }
+    uint64_t mantissa = bits & 0x7FFFFF;
+    if (bits & 0x80000000u) {
+        if ((bits & 0x7FFFFFFFu) != 0) {
+            throw std::invalid_argument("CORDICExactAccumulator: término negativo");
+        }
+        return;   // -0
+    }
+    if (biased != 0) {
+        mantissa |= 0x800000;
+    } else if (mantissa == 0) {
+        return;
+    }
+
+    // Posición del bit menos significativo de la mantisa: 2^(e - 150 + n)
+    int position = (biased != 0 ? static_cast<int>(biased) : 1) - 150 + exponent - LSB_EXPONENT;
+    if (position + bitLength(mantissa) > OVERFLOW_BIT) {
+        throw std::overflow_error("CORDICExactAccumulator: término ≥ 2^128");
+    }
+    if (position < 0) {
+        if (position <= -24) {
+            return;   // Por debajo de 2^-192: truncado
+        }
+        mantissa >>= -position;
+        position = 0;
+    }
+
+    // PASO 1: Sumar la mantisa desplazada en (a lo sumo) dos limbs
+    int limb = position >> 6;
+    const int offset = position & 63;
+    const uint64_t low = mantissa << offset;
+    const uint64_t high = offset > 40 ? mantissa >> (64 - offset) : 0;
+
+    limbs[limb] += low;
+    uint64_t carry = high + (limbs[limb] < low ? 1 : 0);
+
+    // PASO 2: Propagar el acarreo (casi siempre termina en el limb siguiente)
+    while (carry != 0 && ++limb < LIMBS) {
+        limbs[limb] += carry;
+        carry = limbs[limb] < carry ? 1 : 0;
+    }
+}
+
+void CORDICExactAccumulator::add(const float* values, size_t size) {
+    for (size_t i = 0; i < size; i++) {
+        add(values[i]);
+    }
+}
+
+void CORDICExactAccumulator::merge(const CORDICExactAccumulator& other) {
+    uint64_t carry = 0;
+    for (int i = 0; i < LIMBS; i++) {
+        const uint64_t partial = limbs[i] + carry;
+        carry = partial < carry ? 1 : 0;
+        limbs[i] = partial + other.limbs[i];
+        carry += limbs[i] < partial ? 1 : 0;
+    }
+    non_finite += other.non_finite;
+}
+
+float CORDICExactAccumulator::toFloat() const {
+    if (non_finite != 0.0f || std::isnan(non_finite)) {
+        return non_finite;
+    }
+
+    // PASO 1: Bit más significativo del entero
+    int top = LIMBS - 1;
+    while (top >= 0 && limbs[top] == 0) {
+        top--;
+    }
+    if (top < 0) {
+        return 0.0f;
+    }
+    const int msb = top * 64 + bitLength(limbs[top]) - 1;
+
+    // PASO 2: Primer bit que conserva el float: 24 bits de mantisa, o el
+    // bit de 2^-149 si el resultado es subnormal
+    const int lsb = msb - 23 > FLOAT_MIN_BIT ? msb - 23 : FLOAT_MIN_BIT;
+
+    auto bitAt = [&](int index) -> uint64_t {
+        return (limbs[index >> 6] >> (index & 63)) & 1;
+    };
+    uint64_t kept = 0;
+    for (int i = msb; i >= lsb; i--) {
+        kept = (kept << 1) | bitAt(i);
+    }
+
+    // PASO 3: Redondeo al más cercano, empates a par (bit de guarda + sticky)
+    const int guard = lsb - 1;
+    if (guard >= 0 && bitAt(guard)) {
+        const int guard_limb = guard >> 6;
+        const uint64_t below = (guard & 63) ? limbs[guard_limb] & ((1ULL << (guard & 63)) - 1) : 0;
+        bool sticky = below != 0;
+        for (int i = 0; i < guard_limb && !sticky; i++) {
+            sticky = limbs[i] != 0;
+        }
+        if (sticky || (kept & 1)) {
+            kept++;
+        }
+    }
+
+    // kept ≤ 2^24: exacto en float; el escalado por 2^(lsb - 192) es exacto
+    // salvo desbordamiento (→ inf, resultado correcto)
+    return std::ldexp(static_cast<float>(kept), lsb + LSB_EXPONENT);
+}
+
+bool CORDICExactAccumulator::isZero() const {
+    for (uint64_t limb : limbs) {
+        if (limb != 0) {
+            return false;
+        }
+    }
+    return non_finite == 0.0f;
+}
+
+bool CORDICExactAccumulator::operator==(const CORDICExactAccumulator& other) const {
+    for (int i = 0; i < LIMBS; i++) {
+        if (limbs[i] != other.limbs[i]) {
+            return false;
+        }
+    }
+    return non_finite == other.non_finite ||
+           (std::isnan(non_finite) && std::isnan(other.non_finite));
+}
@@ -0,0 +1,258 @@
+/**
+ * @file cordic_attention.cpp
+ * @brief Implementación de la atención por bloques de KV con softmax online
+ */
+
+#include "cordic_attention.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+namespace {
+
+// Por debajo, CORDICPreprocessor::validateInput satura la entrada
+constexpr float LOWEST_UNSATURATED_INPUT = -15.0f;
+
+// Límite de la referencia: evita desbordar k con puntuaciones enormes
+constexpr float MAX_REFERENCE_SCORE = 1e6f;
+
+constexpr float NEG_INF = -std::numeric_limits<float>::infinity();
+
+// Marca en exponents[] de las claves con s_j = -inf (aportan 0)
+constexpr int MASKED = std::numeric_limits<int>::min();
+
+/**
+ * @brief q·k con 32 sumas parciales: 4 cadenas vectoriales independientes
+ * (orden fijo, vectorizable sin reasociar)
+ */
+inline float dot(const float* a, const float* b, size_t size) {
+    constexpr size_t LANES = 32;
+    float partial[LANES] = {};
+    size_t i = 0;
+    for (; i + LANES <= size; i += LANES) {
+        for (size_t lane = 0; lane < LANES; lane++) {
+            partial[lane] += a[i + lane] * b[i + lane];
+        }
+    }
+    for (; i < size; i++) {
+        partial[i - (size - size % LANES)] += a[i] * b[i];
+    }
+    float sum = 0.0f;
+    for (size_t lane = 0; lane < LANES; lane++) {
+        sum += partial[lane];
+    }
+    return sum;
+}
+
+/**
+ * @brief out += weight × row
+ */
+inline void axpy(float weight, const float* row, float* out, size_t size) {
+    for (size_t i = 0; i < size; i++) {
+        out[i] += weight * row[i];
+    }
+}
+
+// Columnas de V acumuladas en registros por pasada sobre el bloque
+constexpr size_t VALUE_TILE = 32;
+
+/**
+ * @brief acc[0..dim) += Σ_j p_j × v_j por tiles de columnas
+ *
+ * El tile de acc vive en registros durante todo el bloque en lugar de
+ * cargarse y guardarse por cada clave; cada acc[d] suma en el mismo orden
+ * de j que axpy clave a clave.
+ */
+void accumulateValues(const float* probabilities, size_t count, const float* values,
+                      size_t value_stride, float* acc, size_t dim) {
+    size_t d0 = 0;
+    for (; d0 + VALUE_TILE <= dim; d0 += VALUE_TILE) {
+        float tile[VALUE_TILE];
+        for (size_t t = 0; t < VALUE_TILE; t++) {
+            tile[t] = acc[d0 + t];
+        }
+        for (size_t j = 0; j < count; j++) {
+            const float p = probabilities[j];
+            const float* row = values + j * value_stride + d0;
+            for (size_t t = 0; t < VALUE_TILE; t++) {
+                tile[t] += p * row[t];
+            }
+        }
+        for (size_t t = 0; t < VALUE_TILE; t++) {
+            acc[d0 + t] = tile[t];
+        }
+    }
+    if (d0 < dim) {
+        for (size_t j = 0; j < count; j++) {
+            axpy(probabilities[j], values + j * value_stride + d0, acc + d0, dim - d0);
+        }
+    }
+}
+
+void validateShape(const CORDICAttentionShape& shape) {
+    if (shape.head_dim == 0) {
+        throw std::invalid_argument("CORDICFlashAttention: head_dim debe ser > 0");
+    }
+    if ((shape.key_stride != 0 && shape.key_stride < shape.head_dim) ||
+        (shape.value_stride != 0 && shape.value_stride < shape.head_dim)) {
+        throw std::invalid_argument("CORDICFlashAttention: stride de K / V menor que head_dim");
+    }
+}
+
+}  // namespace
+
+CORDICFlashAttention::CORDICFlashAttention(const CORDICSoftmax& softmax, size_t block_size_)
+    : engine(softmax), block_size(block_size_) {
+    if (block_size == 0) {
+        throw std::invalid_argument("CORDICFlashAttention: block_size debe ser > 0");
+    }
+    scores.resize(block_size);
+    exponents.resize(block_size);
+}
+
+void CORDICFlashAttention::computeQuery(const float* query, const float* keys,
+                                        const float* values, const CORDICAttentionShape& shape,
+                                        float scale, float* output) {
+    validateShape(shape);
+    const size_t key_stride = shape.key_stride ? shape.key_stride : shape.head_dim;
+    const size_t value_stride = shape.value_stride ? shape.value_stride : shape.head_dim;
+    attendSpan(query, keys, values, shape.head_dim, key_stride, value_stride, 0, shape.kv_len,
+               scale, output);
+}
+
+void CORDICFlashAttention::computeQueries(const float* queries, size_t num_queries,
+                                          size_t query_stride, const float* keys,
+                                          const float* values, const CORDICAttentionShape& shape,
+                                          float scale, float* outputs, size_t output_stride,
+                                          const CORDICCausalMask* causal) {
+    validateShape(shape);
+    if (causal && causal->positions == 0) {
+        throw std::invalid_argument("CORDICFlashAttention: positions debe ser > 0");
+    }
+    const size_t dim = shape.head_dim;
+    const size_t key_stride = shape.key_stride ? shape.key_stride : dim;
+    const size_t value_stride = shape.value_stride ? shape.value_stride : dim;
+    query_stride = query_stride ? query_stride : dim;
+    output_stride = output_stride ? output_stride : dim;
+    if (query_stride < dim || output_stride < dim) {
+        throw std::invalid_argument("CORDICFlashAttention: stride de Q / salida menor que head_dim");
+    }
+
+    for (size_t i = 0; i < num_queries; i++) {
+        // Tramo visible [begin, end): mismo criterio que computeSoftmaxRowsCausal
+        size_t begin = 0;
+        size_t end = shape.kv_len;
+        if (causal) {
+            const size_t q = causal->first_position + i % causal->positions;
+            end = std::min(q + 1, shape.kv_len);
+            begin = (causal->window != 0 && q + 1 > causal->window)
+                        ? std::min(q + 1 - causal->window, end) : 0;
+        }
+        attendSpan(queries + i * query_stride, keys, values, dim, key_stride, value_stride,
+                   begin, end, scale, outputs + i * output_stride);
+    }
+}
+
+void CORDICFlashAttention::attendSpan(const float* query, const float* keys, const float* values,
+                                      size_t head_dim, size_t key_stride, size_t value_stride,
+                                      size_t begin, size_t end, float scale, float* output) {
+    accumulator.assign(head_dim, 0.0f);
+    float sum = 0.0f;
+    int reference_exponent = 0;   // R = k × ln(2) ≥ máximo visto
+    bool started = false;
+
+    for (size_t start = begin; start < end; start += block_size) {
+        const size_t count = std::min(block_size, end - start);
+
+        // PASO 1: Puntuaciones del bloque y su máximo
+        float block_max = NEG_INF;
+        for (size_t j = 0; j < count; j++) {
+            const float score = scale * dot(query, keys + (start + j) * key_stride, head_dim);
+            scores[j] = score;
+            block_max = std::max(block_max, score);
+        }
+        if (!(block_max > NEG_INF)) {
+            continue;   // Bloque completamente enmascarado: no aporta
+        }
+
+        // PASO 2: Si el máximo supera la referencia, reescalar por 2^(k - k'):
+        // solo cambia el exponente de la suma y de cada acumulador
+        const int exponent = static_cast<int>(
+            std::ceil(std::min(block_max, MAX_REFERENCE_SCORE) * CORDICConfig::INV_LN2));
+        if (!started || exponent > reference_exponent) {
+            if (started) {
+                const int shift = reference_exponent - exponent;
+                sum = CORDICPostprocessor::scaleByPowerOf2(sum, shift);
+                for (size_t d = 0; d < head_dim; d++) {
+                    accumulator[d] = CORDICPostprocessor::scaleByPowerOf2(accumulator[d], shift);
+                }
+            }
+            reference_exponent = exponent;
+            started = true;
+        }
+
+        // PASO 3: p_j = e^(s_j - R) en el buffer del bloque; bajo -15 se
+        // reduce antes por 2^n (el preprocesador saturaría)
+        const float reference = static_cast<float>(reference_exponent * CORDICConfig::LN2);
+        for (size_t j = 0; j < count; j++) {
+            float x = scores[j] - reference;
+            int n = 0;
+            if (x == NEG_INF) {
+                n = MASKED;
+            } else if (x < LOWEST_UNSATURATED_INPUT) {
+                n = static_cast<int>(std::ceil(x * CORDICConfig::INV_LN2));
+                x = static_cast<float>(x - n * CORDICConfig::LN2);
+            }
+            scores[j] = x;
+            exponents[j] = n;
+        }
+        engine.calculateExpBatchFast(scores.data(), scores.data(), count);
+
+        // PASO 4: Σ p_j y acumulación p_j × v_j sin salir del bloque
+        for (size_t j = 0; j < count; j++) {
+            float p = scores[j];
+            if (exponents[j] == MASKED) {
+                p = 0.0f;
+            } else if (exponents[j] != 0) {
+                p = CORDICPostprocessor::scaleByPowerOf2(p, exponents[j]);
+            }
+            scores[j] = p;
+            sum += p;
+        }
+        accumulateValues(scores.data(), count, values + start * value_stride, value_stride,
+                         accumulator.data(), head_dim);
+    }
+
+    if (!(sum > 0.0f)) {
+        std::fill(output, output + head_dim, 0.0f);
+        return;
+    }
+    const float inv_sum = 1.0f / sum;
+    for (size_t d = 0; d < head_dim; d++) {
+        output[d] = accumulator[d] * inv_sum;
+    }
+}
+
+void CORDICFlashAttention::computeQueryMaterialized(const float* query, const float* keys,
+                                                    const float* values,
+                                                    const CORDICAttentionShape& shape,
+                                                    float scale, float* probabilities,
+                                                    float* output) const {
+    validateShape(shape);
+    const size_t dim = shape.head_dim;
+    const size_t key_stride = shape.key_stride ? shape.key_stride : dim;
+    const size_t value_stride = shape.value_stride ? shape.value_stride : dim;
+
+    std::fill(output, output + dim, 0.0f);
+    if (shape.kv_len == 0) {
+        return;
+    }
+    for (size_t j = 0; j < shape.kv_len; j++) {
+        probabilities[j] = scale * dot(query, keys + j * key_stride, dim);
+    }
+    engine.computeSoftmaxOnline(probabilities, probabilities, shape.kv_len);
+    for (size_t j = 0; j < shape.kv_len; j++) {
+        axpy(probabilities[j], values + j * value_stride, output, dim);
+    }
+}
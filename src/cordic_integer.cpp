@@ -0,0 +1,158 @@
+/**
+ * @file cordic_integer.cpp
+ * @brief Implementación del softmax solo con enteros
+ */
+
+#include "cordic_integer.h"
+#include "cordic_tables.h"
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+namespace {
+
+using Rotator = CORDICTables::FixedRotator<int16_t, CORDICIntegerSoftmax::INTERNAL_FRAC_BITS>;
+
+constexpr int FRAC = CORDICIntegerSoftmax::INTERNAL_FRAC_BITS;
+
+// 1/ln(2) en Q.8: n = round(d × 1/ln(2)) solo elige el exponente, el error
+// (≤ 0.03 en n) se absorbe en r, que sigue dentro del rango de la secuencia
+constexpr int INV_LN2_FRAC_BITS = 8;
+constexpr int32_t INV_LN2_Q8 = 369;
+
+// ln(2) con 4 bits de guarda para r = d - n × ln(2): error < 2^-19 × |n|
+constexpr int REDUCTION_FRAC_BITS = FRAC + 4;
+constexpr int32_t LN2_REDUCTION = 181704;
+
+// Por debajo de -23, n < MIN_EXPONENT: e^d es 0 en Q2.30. El recorte
+// mantiene d × INV_LN2_Q8 dentro de int32
+constexpr int32_t MIN_STABILIZED_RAW = -23 * (int32_t(1) << FRAC);
+
+// e^r (X + Y, Q1.14) → Q2.30
+constexpr int EXP_SHIFT = CORDICIntegerSoftmax::EXP_FRAC_BITS - FRAC;
+
+// Recíproco R = ⌊2^61 / Σ⌋ ≤ 2^31 (Σ ≥ e^0 ≈ 2^30); e × R < 2^62
+constexpr int RECIPROCAL_BITS = 61;
+constexpr int NORMALIZE_SHIFT = RECIPROCAL_BITS - CORDICIntegerSoftmax::PROB_FRAC_BITS;
+
+static_assert(LN2_REDUCTION == static_cast<int32_t>(0.6931471805599453 * (1 << REDUCTION_FRAC_BITS)),
+              "ln(2) truncado al formato de reducción");
+static_assert(int64_t(MIN_STABILIZED_RAW) * INV_LN2_Q8 > INT32_MIN / 2, "d × 1/ln(2) desborda int32");
+
+/**
+ * @brief Reducción de rango entera: z = r en Q1.14 y desplazamiento -n
+ *
+ * Con n < MIN_EXPONENT devuelve z = 0 y desplazamiento 31: (X + Y) × 2^16
+ * < 2^31, así que el resultado es 0 sin salto.
+ */
+inline void reduce(int32_t d_raw, int16_t& z, int32_t& shift) {
+    const int32_t d = std::max(d_raw, MIN_STABILIZED_RAW);
+    const int32_t n = (d * INV_LN2_Q8 + (int32_t(1) << (FRAC + INV_LN2_FRAC_BITS - 1))) >>
+                      (FRAC + INV_LN2_FRAC_BITS);
+    const int32_t r = d * (int32_t(1) << (REDUCTION_FRAC_BITS - FRAC)) - n * LN2_REDUCTION;
+    const int32_t r_rounded = (r + (int32_t(1) << (REDUCTION_FRAC_BITS - FRAC - 1))) >>
+                              (REDUCTION_FRAC_BITS - FRAC);
+    const bool underflow = n < CORDICIntegerSoftmax::MIN_EXPONENT;
+    z = static_cast<int16_t>(underflow ? 0 : r_rounded);
+    shift = underflow ? -CORDICIntegerSoftmax::MIN_EXPONENT : -n;
+}
+
+inline uint32_t scale(int16_t x, int16_t y, int32_t shift) {
+    return (static_cast<uint32_t>(x + y) << EXP_SHIFT) >> shift;
+}
+
+/**
+ * @brief Paso I de la secuencia fija sobre un bloque SoA
+ */
+template <size_t I>
+inline void rotateBlockStep(int16_t* x, int16_t* y, int16_t* z, size_t size) {
+    for (size_t j = 0; j < size; j++) {
+        Rotator::step<I>(x[j], y[j], z[j]);
+    }
+}
+
+template <size_t... I>
+inline void rotateBlock(int16_t* x, int16_t* y, int16_t* z, size_t size,
+                        std::index_sequence<I...>) {
+    (rotateBlockStep<I>(x, y, z, size), ...);
+}
+
+}  // namespace
+
+CORDICIntegerSoftmax::CORDICIntegerSoftmax(int input_frac_bits_)
+    : input_frac_bits(input_frac_bits_) {
+    if (input_frac_bits < 0 || input_frac_bits > INTERNAL_FRAC_BITS) {
+        throw std::invalid_argument("CORDICIntegerSoftmax: input_frac_bits fuera de [0, " +
+                                    std::to_string(INTERNAL_FRAC_BITS) + "]");
+    }
+}
+
+uint32_t CORDICIntegerSoftmax::expRaw(int32_t d_raw) {
+    int16_t z;
+    int32_t shift;
+    reduce(d_raw, z, shift);
+    int16_t x = Rotator::FOLDED_X0;
+    int16_t y = 0;
+    Rotator::rotate(x, y, z);
+    return scale(x, y, shift);
+}
+
+void CORDICIntegerSoftmax::expBlock(const int16_t* logits, int16_t max_logit, uint32_t* out,
+                                    size_t size) const {
+    int16_t x[BLOCK_SIZE], y[BLOCK_SIZE], z[BLOCK_SIZE];
+    int32_t shift[BLOCK_SIZE];
+    const int input_shift = INTERNAL_FRAC_BITS - input_frac_bits;
+
+    // PASO 1: d en Q1.14 y reducción de rango
+    for (size_t j = 0; j < size; j++) {
+        const int32_t d = (static_cast<int32_t>(logits[j]) - max_logit) * (int32_t(1) << input_shift);
+        reduce(d, z[j], shift[j]);
+        x[j] = Rotator::FOLDED_X0;
+        y[j] = 0;
+    }
+
+    // PASO 2: secuencia fija, un paso para todo el bloque
+    rotateBlock(x, y, z, size, std::make_index_sequence<Rotator::LENGTH>{});
+
+    // PASO 3: e^r × 2^n en Q2.30
+    for (size_t j = 0; j < size; j++) {
+        out[j] = scale(x[j], y[j], shift[j]);
+    }
+}
+
+void CORDICIntegerSoftmax::computeExps(const int16_t* logits, uint32_t* outputs,
+                                       size_t size) const {
+    if (size == 0) {
+        return;
+    }
+    const int16_t max_logit = *std::max_element(logits, logits + size);
+    for (size_t start = 0; start < size; start += BLOCK_SIZE) {
+        const size_t count = std::min(BLOCK_SIZE, size - start);
+        expBlock(logits + start, max_logit, outputs + start, count);
+    }
+}
+
+uint64_t CORDICIntegerSoftmax::computeSoftmax(const int16_t* logits, uint16_t* probabilities,
+                                              size_t size) {
+    if (size == 0) {
+        throw std::invalid_argument("CORDICIntegerSoftmax: fila vacía");
+    }
+
+    exps.resize(size);
+    computeExps(logits, exps.data(), size);
+
+    uint64_t sum = 0;
+    for (uint32_t e : exps) {
+        sum += e;
+    }
+
+    // Recíproco en punto fijo: una división por fila, el resto multiplicaciones
+    const uint32_t reciprocal = static_cast<uint32_t>((uint64_t(1) << RECIPROCAL_BITS) / sum);
+    const uint64_t half = uint64_t(1) << (NORMALIZE_SHIFT - 1);
+    for (size_t i = 0; i < size; i++) {
+        probabilities[i] = static_cast<uint16_t>(
+            (static_cast<uint64_t>(exps[i]) * reciprocal + half) >> NORMALIZE_SHIFT);
+    }
+    return sum;
+}
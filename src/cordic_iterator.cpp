@@ -4,9 +4,84 @@
  */
 
 #include "cordic_iterator.h"
+#include "cordic_tables.h"
+#include "cordic_stats.h"
+#include <algorithm>
 #include <iostream>
 #include <iomanip>
 #include <cmath>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+namespace {
+
+//------------------------------------------------------------------------------
+// Secuencias fijas k = 1..N: una instancia desenrollada por N
+//------------------------------------------------------------------------------
+
+template <int LastShift>
+void rotateFixedBlock(int16_t* x, int16_t* y, int16_t* z, size_t size) {
+    using Rotator = CORDICTables::FixedRotator<int16_t, CORDICConfig::FRAC_WIDTH, LastShift>;
+    for (size_t i = 0; i < size; i++) {
+        int16_t xi = x[i];
+        int16_t yi = y[i];
+        int16_t zi = z[i];
+        Rotator::rotate(xi, yi, zi);
+        x[i] = xi;
+        y[i] = yi;
+        z[i] = zi;
+    }
+}
+
+struct FixedScheduleVariant {
+    void (*rotate_block)(int16_t*, int16_t*, int16_t*, size_t);
+    int16_t folded_x0;
+    int length;
+};
+
+template <int LastShift>
+constexpr FixedScheduleVariant makeFixedScheduleVariant() {
+    using Rotator = CORDICTables::FixedRotator<int16_t, CORDICConfig::FRAC_WIDTH, LastShift>;
+    return {&rotateFixedBlock<LastShift>, Rotator::FOLDED_X0, Rotator::LENGTH};
+}
+
+template <size_t... I>
+constexpr std::array<FixedScheduleVariant, sizeof...(I)> makeFixedScheduleVariants(
+    std::index_sequence<I...>) {
+    return {{makeFixedScheduleVariant<static_cast<int>(I) + 1>()...}};
+}
+
+// Índice N - 1
+constexpr auto FIXED_SCHEDULE_VARIANTS = makeFixedScheduleVariants(
+    std::make_index_sequence<CORDICIterator::MAX_FIXED_LAST_SHIFT>{});
+
+const FixedScheduleVariant& fixedScheduleVariant(int last_shift) {
+    if (last_shift < 1 || last_shift > CORDICIterator::MAX_FIXED_LAST_SHIFT) {
+        throw std::invalid_argument("Secuencia fija: N fuera de [1, " +
+                                    std::to_string(CORDICIterator::MAX_FIXED_LAST_SHIFT) + "]");
+    }
+    return FIXED_SCHEDULE_VARIANTS[static_cast<size_t>(last_shift - 1)];
+}
+
+/**
+ * @brief Número de bits significativos de v > 0 (32 - clz)
+ */
+inline int bitLength(uint32_t v) {
+#if defined(__GNUC__) || defined(__clang__)
+    return 32 - __builtin_clz(v);
+#else
+    int bits = 0;
+    while (v != 0) {
+        v >>= 1;
+        bits++;
+    }
+    return bits;
+#endif
+}
+
+}  // namespace
 
 //==============================================================================
 // IMPLEMENTACIÓN AngleTable
@@ -16,6 +91,11 @@ AngleTable::AngleTable() {
     buildTable();
 }
 
+const AngleTable& AngleTable::shared() {
+    static const AngleTable table;
+    return table;
+}
+
 void AngleTable::buildTable() {
     table.clear();
     for (int k = 1; k <= TABLE_SIZE; k++) {
@@ -34,6 +114,16 @@ bool AngleTable::hasIndex(int index) const {
     return index >= 1 && index <= static_cast<int>(table.size());
 }
 
+int AngleTable::selectGreedyIndex(int32_t abs_z_raw) const {
+    const int bits = bitLength(static_cast<uint32_t>(abs_z_raw));
+    return CORDICTables::GREEDY_CANDIDATES[bits] +
+           (abs_z_raw < CORDICTables::GREEDY_SPLITS[bits] ? 1 : 0);
+}
+
+int AngleTable::selectGreedyIndexScan(int32_t abs_z_raw) const {
+    return CORDICTables::greedyIndexScan(abs_z_raw);
+}
+
 void AngleTable::printTable() const {
     std::cout << "\n=== TABLA DE ÁNGULOS CORDIC HIPERBÓLICO ===" << std::endl;
     std::cout << "k\t| tanh(αₖ)\t| αₖ\t\t| Shift\t| Punto Fijo" << std::endl;
@@ -53,12 +143,11 @@ void AngleTable::printTable() const {
 // IMPLEMENTACIÓN CORDICIterator
 //==============================================================================
 
-CORDICIterator::CORDICIterator() {
-    // La tabla se construye automáticamente
+CORDICIterator::CORDICIterator() : angle_table(AngleTable::shared()) {
 }
 
 IterationResult CORDICIterator::performIterations(const CORDICState& initial_state, 
-                                                  bool enable_debug) {
+                                                  bool enable_debug) const {
     IterationResult result;
     CORDICState current_state = initial_state;
     
@@ -135,6 +224,7 @@ IterationResult CORDICIterator::performIterations(const CORDICState& initial_sta
     }
     
     result.final_state = current_state;
+    CORDICStats::recordIterations(result.iterations_used, result.converged_successfully);
     
     if (!result.converged_successfully && enable_debug) {
         std::cout << "⚠ Máximo de iteraciones alcanzado" << std::endl;
@@ -144,36 +234,224 @@ IterationResult CORDICIterator::performIterations(const CORDICState& initial_sta
     return result;
 }
 
-int CORDICIterator::selectGreedyAngle(const FixedPoint16& z_residual) {
-    if (z_residual.hasConverged()) {
-        return 0;
+// La ruta rápida detecta convergencia como Z == 0: debe seguir siendo equivalente
+static_assert(1.0 / (1 << CORDICConfig::FRAC_WIDTH) > CORDICConfig::CONVERGENCE_THRESHOLD,
+              "hasConverged() ya no equivale a Z == 0 en punto fijo");
+
+namespace {
+
+/**
+ * @brief Bucle greedy entero de performIterationsFast con selección inyectada
+ */
+template <typename Select>
+inline void iterateGreedy(const AngleTable& angle_table, CORDICRawState& state, Select select) {
+    const int max_iter = CORDICConfig::MAX_ITERATIONS * 2;
+    int16_t x = state.X;
+    int16_t y = state.Y;
+    int16_t z = state.Z;
+    int iter = 0;
+    bool converged = false;
+    
+    // Paso de rotación en enteros con la misma aritmética int16 que executeRotationStep
+    auto rotate = [&](int k) {
+        const int direction = (z >= 0) ? 1 : -1;
+        const int16_t delta_x = static_cast<int16_t>(direction * (y >> k));
+        const int16_t delta_y = static_cast<int16_t>(direction * (x >> k));
+        const int16_t angle = angle_table.getRawAngle(k);
+        const int16_t delta_z = static_cast<int16_t>(direction * angle);
+        x = static_cast<int16_t>(x + delta_x);
+        y = static_cast<int16_t>(y + delta_y);
+        z = static_cast<int16_t>(z - delta_z);
+    };
+    
+    while (iter < max_iter) {
+        // |Z| < CONVERGENCE_THRESHOLD en Q3.12 equivale a Z == 0
+        if (z == 0) {
+            converged = true;
+            break;
+        }
+        
+        const int k = select(std::abs(static_cast<int32_t>(z)));
+        rotate(k);
+        iter++;
+        
+        if (k >= 4 && (k - 4) % 3 == 0 && z != 0 && iter < max_iter) {
+            rotate(k);
+            iter++;
+        }
     }
     
-    float abs_z = std::abs(z_residual.toFloat());
+    state.X = x;
+    state.Y = y;
+    state.Z = z;
+    state.iteration_count = iter;
+    state.converged = converged;
+}
+
+// k con repetición (4, 7, 10, 13) como tabla, para el bucle sin saltos del tile
+constexpr std::array<int16_t, AngleTable::MAX_BIT_LENGTH> makeRepeatedShifts() {
+    std::array<int16_t, AngleTable::MAX_BIT_LENGTH> repeated{};
+    for (int k = 1; k < AngleTable::MAX_BIT_LENGTH; k++) {
+        repeated[static_cast<size_t>(k)] = CORDICTables::isRepeatedShift(k) ? 1 : 0;
+    }
+    return repeated;
+}
+
+constexpr std::array<int16_t, AngleTable::MAX_BIT_LENGTH> REPEATED_SHIFTS = makeRepeatedShifts();
+
+}  // namespace
+
+void CORDICIterator::performIterationsFast(CORDICRawState& state,
+                                           CORDICGreedySelection selection) const {
+    const AngleTable& table = angle_table;
+    if (selection == CORDICGreedySelection::LINEAR_SCAN) {
+        iterateGreedy(table, state, [&table](int32_t abs_z) {
+            return table.selectGreedyIndexScan(abs_z);
+        });
+    } else {
+        iterateGreedy(table, state, [&table](int32_t abs_z) {
+            return table.selectGreedyIndex(abs_z);
+        });
+    }
+    CORDICStats::recordIterations(state.iteration_count, state.converged);
+}
+
+void CORDICIterator::performIterationsTile(CORDICTileState& tile) const {
+    const int max_iter = CORDICConfig::MAX_ITERATIONS * 2;
+    const size_t count = std::min(tile.count, CORDICTileState::SIZE);
+    int16_t* __restrict x = tile.X;
+    int16_t* __restrict y = tile.Y;
+    int16_t* __restrict z = tile.Z;
+    int16_t* __restrict iterations = tile.iteration_count;
+    int16_t* __restrict pending = tile.pending_repeat;
+    
+    // Copias int32 de las tablas (candidato y umbral por longitud en bits,
+    // ángulo y repetición por k): lecturas por lane que el compilador
+    // convierte en gathers de 32 bits
+    int32_t candidates[AngleTable::MAX_BIT_LENGTH + 1] = {};
+    int32_t splits[AngleTable::MAX_BIT_LENGTH + 1] = {};
+    int32_t angles[AngleTable::MAX_BIT_LENGTH] = {};
+    int32_t repeats[AngleTable::MAX_BIT_LENGTH] = {};
+    for (int b = 1; b <= AngleTable::MAX_BIT_LENGTH; b++) {
+        candidates[b] = angle_table.getGreedyCandidate(b);
+        splits[b] = angle_table.getGreedySplit(b);
+    }
+    for (int k = 1; k < AngleTable::MAX_BIT_LENGTH && k <= angle_table.size(); k++) {
+        angles[k] = angle_table.getRawAngle(k);
+        repeats[k] = REPEATED_SHIFTS[static_cast<size_t>(k)] ? k : 0;
+    }
     
-    for (int i = 1; i <= angle_table.size(); i++) {
-        const auto& entry = angle_table.getEntry(i);
-        if (entry.angle <= abs_z + 1e-6) {
-            return i;
+    for (size_t i = 0; i < count; i++) {
+        iterations[i] = 0;
+        pending[i] = 0;
+    }
+    
+    // Un paso sobre todo el tile antes del siguiente. Un elemento sigue activo
+    // mientras Z != 0 (Z == 0 ya no cambia), así que todos los activos llevan
+    // `step` rotaciones y el límite max_iter es común al tile. La repetición
+    // de k = 4, 7, 10, 13 se aplaza al paso siguiente (pending_repeat), donde
+    // la condición Z != 0 e iter < max_iter coincide con la del bucle escalar.
+    for (int step = 0; step < max_iter; step++) {
+        int32_t active_count = 0;
+        for (size_t i = 0; i < count; i++) {
+            const int32_t zi = z[i];
+            const int32_t active = zi != 0;
+            const int32_t keep = -active;                 // 0 / -1 por lane activa
+            const int32_t sign = zi >> 31;                // 0 / -1 por signo de Z
+            
+            // Longitud en bits de |Z| por el exponente del float (exacto hasta
+            // 2^24); |Z| | !active evita el 0 en lanes inactivas (descartadas)
+            const int32_t abs_z = ((zi ^ sign) - sign) | (active ^ 1);
+            const float abs_float = static_cast<float>(abs_z);
+            int32_t float_bits;
+            std::memcpy(&float_bits, &abs_float, sizeof(float_bits));
+            const int32_t bits = (float_bits >> 23) - 126;
+            const int32_t selected = candidates[bits] + (abs_z < splits[bits]);
+            
+            const int32_t previous = pending[i];
+            const int32_t k = previous != 0 ? previous : selected;
+            
+            const int32_t delta_x = ((static_cast<int32_t>(y[i]) >> k) ^ sign) - sign;
+            const int32_t delta_y = ((static_cast<int32_t>(x[i]) >> k) ^ sign) - sign;
+            const int32_t delta_z = (angles[k] ^ sign) - sign;
+            x[i] = static_cast<int16_t>(x[i] + (delta_x & keep));
+            y[i] = static_cast<int16_t>(y[i] + (delta_y & keep));
+            z[i] = static_cast<int16_t>(zi - (delta_z & keep));
+            
+            iterations[i] = static_cast<int16_t>(iterations[i] + active);
+            const int32_t next_pending = previous != 0 ? 0 : repeats[k];
+            pending[i] = static_cast<int16_t>(next_pending & keep);
+            active_count += active;
+        }
+        if (active_count == 0) {
+            break;
         }
     }
     
-    return angle_table.size();
+    for (size_t i = 0; i < count; i++) {
+        // Igual que el bucle escalar: converge si ve Z == 0 antes de max_iter
+        tile.converged[i] = static_cast<uint8_t>(z[i] == 0 && iterations[i] < max_iter);
+        CORDICStats::recordIterations(iterations[i], tile.converged[i] != 0);
+    }
+}
+
+void CORDICIterator::performIterationsFixed(CORDICRawState& state) {
+    int16_t x = state.X;
+    int16_t y = state.Y;
+    int16_t z = state.Z;
+    
+    CORDICTables::rotateFixedSchedule(x, y, z);
+    
+    state.X = x;
+    state.Y = y;
+    state.Z = z;
+    state.iteration_count = CORDICTables::FIXED_SCHEDULE_LENGTH;
+    state.converged = true;
+}
+
+void CORDICIterator::performIterationsFixed(CORDICRawState& state, int last_shift) {
+    const FixedScheduleVariant& variant = fixedScheduleVariant(last_shift);
+    variant.rotate_block(&state.X, &state.Y, &state.Z, 1);
+    state.iteration_count = variant.length;
+    state.converged = true;
+}
+
+void CORDICIterator::performIterationsFixedBlock(int16_t* x, int16_t* y, int16_t* z,
+                                                 size_t size, int last_shift) {
+    fixedScheduleVariant(last_shift).rotate_block(x, y, z, size);
+}
+
+int16_t CORDICIterator::fixedFoldedInitialX(int last_shift) {
+    return fixedScheduleVariant(last_shift).folded_x0;
+}
+
+int CORDICIterator::fixedScheduleLength(int last_shift) {
+    return fixedScheduleVariant(last_shift).length;
+}
+
+int CORDICIterator::selectGreedyAngle(const FixedPoint16& z_residual) const {
+    if (z_residual.hasConverged()) {
+        return 0;
+    }
+    
+    // Longitud en bits de |Z| + una comparación entera: α_k ≤ |Z| en Q3.12
+    // sin recorrer las entradas double con bounds-check
+    return angle_table.selectGreedyIndex(std::abs(static_cast<int32_t>(z_residual.getRaw())));
 }
 
 CORDICState CORDICIterator::executeRotationStep(const CORDICState& current_state, 
-                                               int angle_idx) {
+                                               int angle_idx) const {
     CORDICState next_state = current_state;
     
     if (!angle_table.hasIndex(angle_idx)) {
         return next_state;
     }
     
-    const auto& angle_entry = angle_table.getEntry(angle_idx);
     int rotation_direction = (current_state.Z >= 0) ? 1 : -1;
     
-    FixedPoint16 shifted_Y = current_state.Y >> angle_entry.shift_amount;
-    FixedPoint16 shifted_X = current_state.X >> angle_entry.shift_amount;
+    // Shift k = índice del ángulo (α_k = arctanh(2^-k))
+    FixedPoint16 shifted_Y = current_state.Y >> angle_idx;
+    FixedPoint16 shifted_X = current_state.X >> angle_idx;
     
     FixedPoint16 delta_X;
     delta_X.setRaw(rotation_direction * shifted_Y.getRaw());
@@ -184,7 +462,7 @@ CORDICState CORDICIterator::executeRotationStep(const CORDICState& current_state
     next_state.Y = current_state.Y + delta_Y;
     
     FixedPoint16 delta_Z;
-    delta_Z.setRaw(rotation_direction * angle_entry.fixed_angle.getRaw());
+    delta_Z.setRaw(rotation_direction * angle_table.getRawAngle(angle_idx));
     next_state.Z = current_state.Z - delta_Z;
     
     return next_state;
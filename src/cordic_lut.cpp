@@ -0,0 +1,137 @@
+/**
+ * @file cordic_lut.cpp
+ * @brief Implementación del e^x híbrido tabla + cola CORDIC
+ */
+
+#include "cordic_lut.h"
+#include "cordic_preprocessor.h"
+#include "cordic_postprocessor.h"
+#include "cordic_tables.h"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <string>
+
+namespace {
+
+constexpr auto TAIL_ANGLES =
+    CORDICTables::makeRawAngles<int32_t, CORDICLutExp::TAIL_FRAC_BITS, CORDICConfig::FRAC_WIDTH>();
+
+constexpr float TAIL_SCALE = 1.0f / static_cast<float>(int64_t(1) << CORDICLutExp::TAIL_FRAC_BITS);
+
+// Fuera de este rango el preprocesador satura; fuera de [-110, 100] e^x ya es
+// 0 o inf en float y n cabe en int
+constexpr float PRACTICAL_LIMIT = 15.0f;
+constexpr float UNDERFLOW_INPUT = -110.0f;
+constexpr float OVERFLOW_INPUT = 100.0f;
+
+/**
+ * @brief Índice h = round(raw / 2^r) (empates hacia +inf, sin saltos)
+ */
+inline int32_t highIndex(int32_t raw, int residual_bits) {
+    if (residual_bits == 0) {
+        return raw;
+    }
+    return (raw + (int32_t(1) << (residual_bits - 1))) >> residual_bits;   // >> aritmético
+}
+
+}  // namespace
+
+CORDICLutExp::CORDICLutExp(int residual_bits_) : residual_bits(residual_bits_) {
+    if (residual_bits < 0 || residual_bits > MAX_RESIDUAL_BITS) {
+        throw std::invalid_argument("CORDICLutExp: residual_bits fuera de [0, " +
+                                    std::to_string(MAX_RESIDUAL_BITS) + "]");
+    }
+
+    // Tabla: e^(h × 2^r) para todos los h alcanzables desde [-MAX, MAX]
+    index_offset = highIndex(-MAX_MAPPED_RAW, residual_bits);
+    const int32_t last_index = highIndex(MAX_MAPPED_RAW, residual_bits);
+    table.resize(static_cast<size_t>(last_index - index_offset + 1));
+    for (int32_t h = index_offset; h <= last_index; h++) {
+        const double high = std::ldexp(static_cast<double>(h), residual_bits - CORDICConfig::FRAC_WIDTH);
+        table[static_cast<size_t>(h - index_offset)] = static_cast<float>(std::exp(high));
+    }
+
+    // Cola: |l| ≤ 2^(r-13) se anula con α_k desde k = 13 - r (α_k > 2^-k)
+    if (residual_bits > 0) {
+        const int first_shift = std::max(1, CORDICConfig::FRAC_WIDTH + 1 - residual_bits);
+        double gain_squared = 1.0;
+        for (int k = first_shift; k <= CORDICConfig::FRAC_WIDTH; k++) {
+            const int repeats = CORDICTables::isRepeatedShift(k) ? 2 : 1;
+            for (int rep = 0; rep < repeats; rep++) {
+                tail_shifts.push_back(k);
+                tail_angles.push_back(TAIL_ANGLES[k]);
+                gain_squared *= 1.0 - std::ldexp(1.0, -2 * k);
+            }
+        }
+        tail_x0 = static_cast<int32_t>(std::ldexp(1.0, TAIL_FRAC_BITS) / std::sqrt(gain_squared) + 0.5);
+    } else {
+        tail_x0 = static_cast<int32_t>(int64_t(1) << TAIL_FRAC_BITS);
+    }
+}
+
+int CORDICLutExp::residualBitsForBudget(size_t table_bytes) {
+    for (int r = 0; r <= MAX_RESIDUAL_BITS; r++) {
+        const size_t entries = static_cast<size_t>(highIndex(MAX_MAPPED_RAW, r) -
+                                                   highIndex(-MAX_MAPPED_RAW, r) + 1);
+        if (entries * sizeof(float) <= table_bytes) {
+            return r;
+        }
+    }
+    return MAX_RESIDUAL_BITS;
+}
+
+float CORDICLutExp::expMapped(int16_t mapped_raw) const {
+    // Solo códigos reducidos (|x'| ≤ ln2/2); calculateExp nunca pasa saturados
+    const int32_t raw = std::min(std::max<int32_t>(mapped_raw, -MAX_MAPPED_RAW), MAX_MAPPED_RAW);
+    const int32_t h = highIndex(raw, residual_bits);
+    const float high = table[static_cast<size_t>(h - index_offset)];
+    if (tail_shifts.empty()) {
+        return high;
+    }
+
+    // Residuo l = raw - h × 2^r en Q2.29; X₀ = 1/K: al final X + Y = e^(l - z)
+    int32_t x = tail_x0;
+    int32_t y = 0;
+    // Productos en vez de << : h y l pueden ser negativos
+    const int32_t residual = raw - h * (int32_t(1) << residual_bits);
+    int32_t z = residual * (int32_t(1) << (TAIL_FRAC_BITS - CORDICConfig::FRAC_WIDTH));
+    for (size_t i = 0; i < tail_shifts.size(); i++) {
+        const int k = tail_shifts[i];
+        const int32_t sign = z >> 31;
+        const int32_t delta_x = y >> k;
+        const int32_t delta_y = x >> k;
+        x += (delta_x ^ sign) - sign;
+        y += (delta_y ^ sign) - sign;
+        z -= (tail_angles[i] ^ sign) - sign;
+    }
+
+    // |z| ≤ α_12: e^z ≈ 1 + z con error z²/2 < 3e-8
+    const float tail = static_cast<float>(x + y) * TAIL_SCALE;
+    return high * tail * (1.0f + static_cast<float>(z) * TAIL_SCALE);
+}
+
+float CORDICLutExp::calculateExp(float x) const {
+    if (std::isnan(x)) {
+        return x;
+    }
+
+    // |x| > 15 lo satura el preprocesador: e^x = 2^n × e^(x - n ln2) antes,
+    // como sumExpStabilized (±inf → 0 / inf vía ldexp)
+    int n = 0;
+    if (std::abs(x) > PRACTICAL_LIMIT) {
+        const float clamped = std::min(std::max(x, UNDERFLOW_INPUT), OVERFLOW_INPUT);
+        n = static_cast<int>(std::lround(clamped * CORDICConfig::INV_LN2));
+        x = static_cast<float>(clamped - n * CORDICConfig::LN2);
+    }
+
+    const PreprocessResult prep = CORDICPreprocessor::processInput(x, false);
+    const float exp_mapped = expMapped(prep.mapped_input.getRaw());
+    return CORDICPostprocessor::scaleByPowerOf2(exp_mapped, prep.reduction_factor + n);
+}
+
+void CORDICLutExp::calculateExpBatch(const float* inputs, float* outputs, size_t size) const {
+    for (size_t i = 0; i < size; i++) {
+        outputs[i] = calculateExp(inputs[i]);
+    }
+}
@@ -0,0 +1,104 @@
+/**
+ * @file cordic_online_softmax.cpp
+ * @brief Implementación del softmax online de una sola pasada
+ */
+
+#include "cordic_online_softmax.h"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+namespace {
+
+// Bloque procesado de una vez: máximo local y exponenciales mientras está en L1
+constexpr size_t BLOCK_SIZE = 256;
+
+// Límites de la referencia: evitan desbordar k con logits ±inf o NaN
+constexpr float MIN_REFERENCE_LOGIT = -1e6f;
+constexpr float MAX_REFERENCE_LOGIT = 1e6f;
+
+}  // namespace
+
+CORDICOnlineSoftmax::CORDICOnlineSoftmax(const CORDICSoftmax& softmax, float* output,
+                                         size_t output_capacity)
+    : engine(softmax) {
+    reset(output, output_capacity);
+}
+
+void CORDICOnlineSoftmax::reset(float* output, size_t output_capacity) {
+    probabilities = output;
+    capacity = output_capacity;
+    count = 0;
+    reference_exponent = 0;
+    sum = 0.0f;
+    finalized = false;
+    segments.clear();
+}
+
+void CORDICOnlineSoftmax::consume(const float* logits, size_t chunk_size) {
+    if (finalized) {
+        throw std::logic_error("CORDICOnlineSoftmax: consume() después de finalize()");
+    }
+    if (chunk_size > capacity - count) {
+        throw std::out_of_range("CORDICOnlineSoftmax: chunk supera la capacidad de salida");
+    }
+
+    for (size_t start = 0; start < chunk_size; start += BLOCK_SIZE) {
+        consumeBlock(logits + start, std::min(BLOCK_SIZE, chunk_size - start));
+    }
+}
+
+void CORDICOnlineSoftmax::consumeBlock(const float* logits, size_t block_size) {
+    // PASO 1: Máximo del bloque → exponente de referencia k = ⌈max / ln(2)⌉
+    float block_max = *std::max_element(logits, logits + block_size);
+    if (!(block_max > MIN_REFERENCE_LOGIT)) {
+        block_max = MIN_REFERENCE_LOGIT;
+    }
+    block_max = std::min(block_max, MAX_REFERENCE_LOGIT);
+    int exponent = static_cast<int>(std::ceil(block_max * CORDICConfig::INV_LN2));
+
+    // PASO 2: Si el máximo crece, reescalar la suma por 2^(k - k'): solo exponente
+    if (segments.empty() || exponent > reference_exponent) {
+        if (!segments.empty()) {
+            sum = std::ldexp(sum, reference_exponent - exponent);
+        }
+        reference_exponent = exponent;
+        segments.push_back({count, exponent});
+    }
+
+    // PASO 3: e^(x_i - k × ln(2)) directamente en la salida
+    const float reference = static_cast<float>(reference_exponent * CORDICConfig::LN2);
+    float* out = probabilities + count;
+    for (size_t i = 0; i < block_size; i++) {
+        out[i] = logits[i] - reference;
+    }
+    engine.calculateExpBatchFast(out, out, block_size);
+
+    for (size_t i = 0; i < block_size; i++) {
+        sum += out[i];
+    }
+    count += block_size;
+}
+
+void CORDICOnlineSoftmax::finalize() {
+    if (finalized) {
+        return;
+    }
+    finalized = true;
+
+    if (count == 0) {
+        return;
+    }
+
+    // Cada tramo se escribió con su propia referencia k_s:
+    // p_i = e^(x_i - k_s ln2) × 2^(k_s - k_final) / suma
+    const float inv_sum = 1.0f / sum;
+    for (size_t s = 0; s < segments.size(); s++) {
+        const size_t begin = segments[s].begin;
+        const size_t end = (s + 1 < segments.size()) ? segments[s + 1].begin : count;
+        const float scale = std::ldexp(inv_sum, segments[s].exponent - reference_exponent);
+        for (size_t i = begin; i < end; i++) {
+            probabilities[i] *= scale;
+        }
+    }
+}
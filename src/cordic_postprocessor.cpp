@@ -7,6 +7,7 @@
 #include <iostream>
 #include <iomanip>
 #include <cmath>
+#include <cstring>
 
 PostprocessResult CORDICPostprocessor::processResults(
     const IterationResult& iteration_result,
@@ -104,6 +105,27 @@ PostprocessResult CORDICPostprocessor::processResults(
     return result;
 }
 
+float CORDICPostprocessor::computeExponential(
+    const CORDICRawState& final_state,
+    const PreprocessResult& preprocess_result
+) {
+    CORDICState state;
+    state.X.setRaw(final_state.X);
+    state.Y.setRaw(final_state.Y);
+    
+    float x_final = state.X.toFloat();
+    float y_final = state.Y.toFloat();
+    float K_squared = x_final * x_final - y_final * y_final;
+    float scaling_factor = std::sqrt(std::abs(K_squared));
+    
+    float cosh_value;
+    float sinh_value;
+    extractHyperbolicFunctions(state, scaling_factor, cosh_value, sinh_value);
+    
+    float exp_mapped = calculateExponential(cosh_value, sinh_value);
+    return restoreOriginalValue(exp_mapped, preprocess_result);
+}
+
 float CORDICPostprocessor::calculateScalingFactor(const std::vector<int>&) {
     // Ya no se usa, se calcula directamente en processResults
     return 1.0f;
@@ -134,8 +156,31 @@ float CORDICPostprocessor::restoreOriginalValue(
         return exp_mapped;
     }
     
-    float power_of_2 = std::pow(2.0f, preprocess_result.reduction_factor);
-    return exp_mapped * power_of_2;
+    return scaleByPowerOf2(exp_mapped, preprocess_result.reduction_factor);
+}
+
+float CORDICPostprocessor::scaleByPowerOf2(float value, int n) {
+    uint32_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    
+    const int exponent = static_cast<int>((bits >> 23) & 0xFF);
+    if (exponent == 0 || exponent == 0xFF || exponent + n <= 0 || exponent + n >= 0xFF) {
+        return std::ldexp(value, n);
+    }
+    
+    bits += static_cast<uint32_t>(n) << 23;
+    std::memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+float CORDICPostprocessor::computeExponentialFolded(
+    const CORDICRawState& final_state,
+    const PreprocessResult& preprocess_result
+) {
+    // X + Y en Q3.12 exacto en float; × 2^-FRAC es solo exponente
+    const float exp_mapped = static_cast<float>(final_state.X + final_state.Y) *
+                             (1.0f / (1 << CORDICConfig::FRAC_WIDTH));
+    return scaleByPowerOf2(exp_mapped, preprocess_result.reduction_factor);
 }
 
 float CORDICPostprocessor::calculateError(float computed_value, float original_input) {
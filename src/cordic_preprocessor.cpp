@@ -4,6 +4,7 @@
  */
 
 #include "cordic_preprocessor.h"
+#include "cordic_stats.h"
 #include <iostream>
 #include <iomanip>
 #include <cmath>
@@ -29,6 +30,7 @@ PreprocessResult CORDICPreprocessor::processInput(float input, bool enable_debug
         }
         result.reduction_factor = 0;
         result.mapping_applied = true;
+        CORDICStats::recordPreprocess(true, 0);
         return result;
     }
     
@@ -74,6 +76,7 @@ PreprocessResult CORDICPreprocessor::processInput(float input, bool enable_debug
         }
     }
     
+    CORDICStats::recordPreprocess(false, result.reduction_factor);
     return result;
 }
 
@@ -0,0 +1,180 @@
+/**
+ * @file cordic_sampling.cpp
+ * @brief Implementación del softmax fusionado con top-k / top-p
+ */
+
+#include "cordic_sampling.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <stdexcept>
+
+CORDICTopKSampler::CORDICTopKSampler(CORDICSoftmax& softmax) : engine(softmax) {}
+
+size_t CORDICTopKSampler::select(const float* logits, size_t size,
+                                 const CORDICSamplingParams& params, CORDICCandidates& out,
+                                 CORDICSamplingMode mode) {
+    if (size == 0) {
+        throw std::invalid_argument("CORDICTopKSampler: vocabulario vacío");
+    }
+    const size_t k = (params.top_k == 0) ? size : std::min(params.top_k, size);
+
+    if (mode == CORDICSamplingMode::FUSED) {
+        selectFused(logits, size, k, out);
+    } else {
+        selectExact(logits, size, k, out);
+    }
+    applyTopP(params, out);
+    return out.size();
+}
+
+void CORDICTopKSampler::selectFused(const float* logits, size_t size, size_t k,
+                                    CORDICCandidates& out) {
+    // Orden de candidatos: logit descendente, índice ascendente en empates
+    auto better = [](const Entry& a, const Entry& b) {
+        return a.logit > b.logit || (a.logit == b.logit && a.index < b.index);
+    };
+
+    // PASO 1: selección parcial; con el heap lleno, heap.front() es el peor
+    heap.clear();
+    heap.reserve(k);
+    size_t i = 0;
+    const float neg_inf = -std::numeric_limits<float>::infinity();
+    for (; i < size && heap.size() < k; i++) {
+        heap.push_back({std::isnan(logits[i]) ? neg_inf : logits[i], static_cast<int32_t>(i)});
+        std::push_heap(heap.begin(), heap.end(), better);
+    }
+    for (; i < size; i++) {
+        // Índices crecientes: un empate con el peor nunca lo desplaza
+        if (logits[i] > heap.front().logit) {
+            std::pop_heap(heap.begin(), heap.end(), better);
+            heap.back() = {logits[i], static_cast<int32_t>(i)};
+            std::push_heap(heap.begin(), heap.end(), better);
+        }
+    }
+    std::sort_heap(heap.begin(), heap.end(), better);
+
+    // Enmascarados (-inf, NaN) al final: no son candidatos. Si había alguno
+    // entre los k, todo lo descartado es -inf y la masa fuera es 0
+    const bool masked_tail = heap.back().logit == neg_inf;
+    while (heap.size() > 1 && heap.back().logit == neg_inf) {
+        heap.pop_back();
+    }
+    k = heap.size();
+
+    // PASO 2: exponenciales solo de los candidatos (mismas que computeSoftmax)
+    const float max_logit = heap.front().logit;
+    stabilized.resize(k);
+    weights.resize(k);
+    for (size_t c = 0; c < k; c++) {
+        stabilized[c] = heap[c].logit - max_logit;
+    }
+    engine.calculateExpStabilizedBatch(stabilized.data(), weights.data(), k);
+
+    // PASO 3: cota de la masa restante, (N - k) × e^(x_k - max)
+    double candidate_sum = 0.0;
+    for (float w : weights) {
+        candidate_sum += w;
+    }
+    const double tail_bound = masked_tail ? 0.0 : static_cast<double>(size - k) * weights[k - 1];
+    out.tail_mass = static_cast<float>(tail_bound / (candidate_sum + tail_bound));
+
+    // PASO 4: la exp CORDIC no es monótona (logits a pocos códigos Q3.12 se
+    // invierten): reordenar por probabilidad, empates por logit e índice,
+    // como el modo exacto, antes de top-p
+    order.resize(k);
+    std::iota(order.begin(), order.end(), 0);
+    const std::vector<Entry>& entries = heap;
+    const std::vector<float>& w = weights;
+    std::sort(order.begin(), order.end(), [&entries, &w](int32_t a, int32_t b) {
+        if (w[a] != w[b]) {
+            return w[a] > w[b];
+        }
+        if (entries[a].logit != entries[b].logit) {
+            return entries[a].logit > entries[b].logit;
+        }
+        return entries[a].index < entries[b].index;
+    });
+    stabilized.assign(weights.begin(), weights.end());   // Copia de los pesos
+    out.indices.resize(k);
+    for (size_t c = 0; c < k; c++) {
+        weights[c] = stabilized[order[c]];
+        out.indices[c] = heap[order[c]].index;
+    }
+}
+
+void CORDICTopKSampler::selectExact(const float* logits, size_t size, size_t k,
+                                    CORDICCandidates& out) {
+    // Softmax completo sobre el vocabulario
+    full_probabilities.resize(size);
+    engine.computeSoftmax(logits, full_probabilities.data(), size);
+
+    // Los k más probables. Logits a menos de 2^-12 comparten código Q3.12 y
+    // probabilidad: los empates se deshacen por logit y luego por índice
+    order.resize(size);
+    std::iota(order.begin(), order.end(), 0);
+    const std::vector<float>& probs = full_probabilities;
+    std::partial_sort(order.begin(), order.begin() + k, order.end(),
+                      [&probs, logits](int32_t a, int32_t b) {
+                          if (probs[a] != probs[b]) {
+                              return probs[a] > probs[b];
+                          }
+                          if (logits[a] != logits[b]) {
+                              return logits[a] > logits[b];
+                          }
+                          return a < b;
+                      });
+
+    // Enmascarados (probabilidad 0, logit -inf) al final: no son candidatos
+    while (k > 1 && logits[order[k - 1]] == -std::numeric_limits<float>::infinity()) {
+        k--;
+    }
+
+    weights.resize(k);
+    out.indices.assign(order.begin(), order.begin() + k);
+    double candidate_mass = 0.0;
+    for (size_t c = 0; c < k; c++) {
+        weights[c] = probs[order[c]];
+        candidate_mass += weights[c];
+    }
+    double total_mass = 0.0;
+    for (float p : probs) {
+        total_mass += p;
+    }
+    out.tail_mass = static_cast<float>((total_mass - candidate_mass) / total_mass);
+}
+
+void CORDICTopKSampler::applyTopP(const CORDICSamplingParams& params, CORDICCandidates& out) {
+    const size_t k = weights.size();
+
+    float candidate_sum = 0.0f;
+    for (float w : weights) {
+        candidate_sum += w;
+    }
+
+    // Prefijo mínimo cuya masa renormalizada alcanza top_p
+    size_t keep = k;
+    if (params.top_p < 1.0f) {
+        const float inv_sum = 1.0f / candidate_sum;
+        float cumulative = 0.0f;
+        for (size_t c = 0; c < k; c++) {
+            cumulative += weights[c] * inv_sum;
+            if (cumulative >= params.top_p && c + 1 >= params.min_keep) {
+                keep = c + 1;
+                break;
+            }
+        }
+    }
+
+    float kept_sum = 0.0f;
+    for (size_t c = 0; c < keep; c++) {
+        kept_sum += weights[c];
+    }
+    const float inv_kept = 1.0f / kept_sum;
+    out.indices.resize(keep);
+    out.probabilities.resize(keep);
+    for (size_t c = 0; c < keep; c++) {
+        out.probabilities[c] = weights[c] * inv_kept;
+    }
+}
@@ -0,0 +1,197 @@
+/**
+ * @file cordic_simd.cpp
+ * @brief Dispatch en tiempo de ejecución de los kernels SIMD de e^x
+ */
+
+#include "cordic_simd.h"
+#include "cordic_iterator.h"
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+
+//==============================================================================
+// IMPLEMENTACIÓN CORDICKernelTables
+//==============================================================================
+
+CORDICKernelTables::CORDICKernelTables(const AngleTable& table) {
+    raw_angles[0] = 0;
+    greedy_thresholds[0] = 0;
+    for (int k = 1; k <= TABLE_SIZE; k++) {
+        raw_angles[k] = table.getRawAngle(k);
+        greedy_thresholds[k] = static_cast<int16_t>(table.getGreedyThreshold(k));
+    }
+    static_assert(AngleTable::MAX_BIT_LENGTH == 16, "Una fila de 16 lanes por longitud en bits");
+    for (int b = 1; b <= AngleTable::MAX_BIT_LENGTH; b++) {
+        greedy_candidates[b - 1] = table.getGreedyCandidate(b);
+        greedy_splits[b - 1] = static_cast<int16_t>(table.getGreedySplit(b));
+    }
+    max_iterations = static_cast<int16_t>(CORDICConfig::MAX_ITERATIONS * 2);
+    
+    small_input_limit = static_cast<float>(CORDICConfig::CONVERGENCE_LIMIT);
+    if (static_cast<double>(small_input_limit) > CORDICConfig::CONVERGENCE_LIMIT) {
+        small_input_limit = std::nextafter(small_input_limit, 0.0f);
+    }
+    adjustment_limit = static_cast<float>(CORDICConfig::CONVERGENCE_LIMIT);
+}
+
+const CORDICKernelTables& CORDICKernelTables::shared() {
+    static const CORDICKernelTables tables(AngleTable::shared());
+    return tables;
+}
+
+//==============================================================================
+// IMPLEMENTACIÓN CORDICSIMD
+//==============================================================================
+
+namespace {
+
+/**
+ * @brief Soporte de cada kernel en esta CPU (compilado + instrucciones disponibles)
+ */
+struct KernelSupport {
+    bool sse41 = false;
+    bool avx2 = false;
+    bool avx512 = false;
+    bool neon = false;
+
+    KernelSupport() {
+#if defined(CORDIC_ENABLE_X86_KERNELS)
+        __builtin_cpu_init();
+        sse41 = __builtin_cpu_supports("sse4.1");
+        avx2 = __builtin_cpu_supports("avx2");
+        avx512 = __builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw") &&
+                 __builtin_cpu_supports("avx512vl");
+#endif
+#if defined(CORDIC_ENABLE_NEON_KERNELS)
+        neon = true;   // Obligatorio en AArch64
+#endif
+    }
+
+    static const KernelSupport& shared() {
+        static const KernelSupport support;
+        return support;
+    }
+};
+
+CORDICKernel bestKernel() {
+    const KernelSupport& support = KernelSupport::shared();
+    if (support.avx512) return CORDICKernel::AVX512;
+    if (support.avx2) return CORDICKernel::AVX2;
+    if (support.sse41) return CORDICKernel::SSE41;
+    if (support.neon) return CORDICKernel::NEON;
+    return CORDICKernel::SCALAR;
+}
+
+const char* backendOverride() {
+    const char* name = std::getenv("CORDIC_BACKEND");
+    return name != nullptr && name[0] != '\0' ? name : nullptr;
+}
+
+/**
+ * @brief Kernel del proceso: CORDIC_BACKEND o el mejor soportado
+ *
+ * Un CORDIC_BACKEND inválido o no soportado no aborta el proceso: se avisa
+ * por stderr y se usa el kernel automático.
+ */
+CORDICKernel detectKernel() {
+    const char* name = backendOverride();
+    if (name == nullptr) {
+        return bestKernel();
+    }
+    try {
+        return CORDICSIMD::selectKernel(name);
+    } catch (const std::invalid_argument& e) {
+        std::cerr << "CORDIC_BACKEND ignorado: " << e.what() << std::endl;
+        return bestKernel();
+    }
+}
+
+}  // namespace
+
+CORDICKernel CORDICSIMD::activeKernel() {
+    static const CORDICKernel kernel = detectKernel();
+    return kernel;
+}
+
+bool CORDICSIMD::isKernelForced() {
+    const char* name = backendOverride();
+    return name != nullptr && std::strcmp(name, kernelName(activeKernel())) == 0;
+}
+
+CORDICKernel CORDICSIMD::selectKernel(const char* name) {
+    if (name == nullptr || name[0] == '\0') {
+        return bestKernel();
+    }
+    const CORDICKernel kernels[] = {CORDICKernel::SCALAR, CORDICKernel::SSE41, CORDICKernel::AVX2,
+                                    CORDICKernel::AVX512, CORDICKernel::NEON};
+    for (CORDICKernel kernel : kernels) {
+        if (std::strcmp(name, kernelName(kernel)) != 0) {
+            continue;
+        }
+        if (!isKernelSupported(kernel)) {
+            throw std::invalid_argument(std::string("backend '") + name +
+                                        "' no soportado en esta CPU / compilación");
+        }
+        return kernel;
+    }
+    throw std::invalid_argument(std::string("backend desconocido '") + name +
+                                "' (scalar, sse4, avx2, avx512, neon)");
+}
+
+bool CORDICSIMD::isKernelSupported(CORDICKernel kernel) {
+    const KernelSupport& support = KernelSupport::shared();
+    switch (kernel) {
+        case CORDICKernel::SCALAR: return true;
+        case CORDICKernel::SSE41:  return support.sse41;
+        case CORDICKernel::AVX2:   return support.avx2;
+        case CORDICKernel::AVX512: return support.avx512;
+        case CORDICKernel::NEON:   return support.neon;
+    }
+    return false;
+}
+
+const char* CORDICSIMD::kernelName(CORDICKernel kernel) {
+    switch (kernel) {
+        case CORDICKernel::SCALAR: return "scalar";
+        case CORDICKernel::SSE41:  return "sse4";
+        case CORDICKernel::AVX2:   return "avx2";
+        case CORDICKernel::AVX512: return "avx512";
+        case CORDICKernel::NEON:   return "neon";
+    }
+    return "unknown";
+}
+
+bool CORDICSIMD::runKernel(CORDICKernel kernel, const CORDICKernelTables& tables,
+                           const float* inputs, float* outputs, size_t size) {
+    if (kernel == CORDICKernel::SCALAR || !isKernelSupported(kernel)) {
+        return false;
+    }
+
+    switch (kernel) {
+#if defined(CORDIC_ENABLE_X86_KERNELS)
+        case CORDICKernel::SSE41:
+            cordicExpBatchSSE41(tables, inputs, outputs, size);
+            return true;
+        case CORDICKernel::AVX2:
+            cordicExpBatchAVX2(tables, inputs, outputs, size);
+            return true;
+        case CORDICKernel::AVX512:
+            cordicExpBatchAVX512(tables, inputs, outputs, size);
+            return true;
+#endif
+#if defined(CORDIC_ENABLE_NEON_KERNELS)
+        case CORDICKernel::NEON:
+            cordicExpBatchNEON(tables, inputs, outputs, size);
+            return true;
+#endif
+        default:
+            (void)tables;
+            (void)inputs;
+            (void)outputs;
+            (void)size;
+            return false;
+    }
+}
@@ -0,0 +1,317 @@
+/**
+ * @file cordic_simd_avx2.cpp
+ * @brief Kernel AVX2 de e^x por lotes (16 lanes int16 Q3.12)
+ *
+ * Compilado con -mavx2. Solo usa intrínsecos y constantes de CORDICConfig:
+ * no instanciar aquí funciones inline compartidas con el resto de la librería.
+ *
+ * AVX2 no tiene shift variable por lane en 16 bits: Y >> k se calcula como
+ * mulhi(Y, 2^(16-k)), exacto para k >= 2, y srai(Y, 1) para k = 1.
+ */
+
+#include "cordic_simd.h"
+#include "cordic_stats.h"
+#include "cordic_types.h"
+#include <immintrin.h>
+#include <cstring>
+
+namespace {
+
+constexpr int LANES = 16;
+constexpr float PRACTICAL_LIMIT = 15.0f;  // Igual que CORDICPreprocessor::validateInput
+
+/**
+ * @brief round() de C (mitades lejos de cero) en double
+ */
+inline __m256d roundHalfAway(__m256d v) {
+    const __m256d half = _mm256_set1_pd(0.5);
+    const __m256d one = _mm256_set1_pd(1.0);
+    __m256d t = _mm256_round_pd(v, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC);
+    __m256d frac = _mm256_sub_pd(v, t);
+    __m256d up = _mm256_and_pd(_mm256_cmp_pd(frac, half, _CMP_GE_OQ), one);
+    __m256d down = _mm256_and_pd(_mm256_cmp_pd(frac, _mm256_sub_pd(_mm256_setzero_pd(), half),
+                                               _CMP_LE_OQ), one);
+    return _mm256_sub_pd(_mm256_add_pd(t, up), down);
+}
+
+/**
+ * @brief float → double → (op) → float para 8 lanes: x - LN2 * delta
+ */
+inline __m256 subtractLn2(__m256 x, __m256 delta) {
+    const __m256d ln2 = _mm256_set1_pd(CORDICConfig::LN2);
+    __m256d delta_lo = _mm256_cvtps_pd(_mm256_castps256_ps128(delta));
+    __m256d delta_hi = _mm256_cvtps_pd(_mm256_extractf128_ps(delta, 1));
+    __m256d lo = _mm256_sub_pd(_mm256_cvtps_pd(_mm256_castps256_ps128(x)),
+                               _mm256_mul_pd(delta_lo, ln2));
+    __m256d hi = _mm256_sub_pd(_mm256_cvtps_pd(_mm256_extractf128_ps(x, 1)),
+                               _mm256_mul_pd(delta_hi, ln2));
+    return _mm256_set_m128(_mm256_cvtpd_ps(hi), _mm256_cvtpd_ps(lo));
+}
+
+/**
+ * @brief Preprocesado de 8 elementos (réplica de CORDICPreprocessor::processInput)
+ *
+ * @param tables Umbrales float precalculados
+ * @param x Entradas
+ * @param raw [out] Entrada mapeada Q3.12 (int32)
+ * @param n [out] Factor de reducción
+ */
+inline void preprocess8(const CORDICKernelTables& tables, __m256 x, __m256i& raw, __m256i& n) {
+    const __m256 fixed_one = _mm256_set1_ps(static_cast<float>(1 << CORDICConfig::FRAC_WIDTH));
+    const __m256 sign_mask = _mm256_set1_ps(-0.0f);
+
+    // PASO 1: entradas inválidas (NaN, ±inf, fuera de ±15) → saturación con n = 0
+    __m256 valid = _mm256_and_ps(_mm256_cmp_ps(x, _mm256_set1_ps(-PRACTICAL_LIMIT), _CMP_GE_OQ),
+                                 _mm256_cmp_ps(x, _mm256_set1_ps(PRACTICAL_LIMIT), _CMP_LE_OQ));
+    __m256i below_min = _mm256_castps_si256(
+        _mm256_cmp_ps(x, _mm256_set1_ps(CORDICConfig::SOFTMAX_MIN_LOGIT), _CMP_LT_OQ));
+    __m256i raw_saturated = _mm256_blendv_epi8(_mm256_set1_epi32(INT16_MAX),
+                                               _mm256_set1_epi32(INT16_MIN), below_min);
+
+    // PASO 2: |x| ≤ CONVERGENCE_LIMIT (umbral float equivalente a la comparación double)
+    __m256 abs_x = _mm256_andnot_ps(sign_mask, x);
+    __m256i small_mask = _mm256_castps_si256(
+        _mm256_cmp_ps(abs_x, _mm256_set1_ps(tables.small_input_limit), _CMP_LE_OQ));
+
+    // PASO 3: mapeo e^x = 2^n × e^(x'), n = round(x / ln 2) en double
+    const __m256d inv_ln2 = _mm256_set1_pd(CORDICConfig::INV_LN2);
+    __m256d x_lo = _mm256_cvtps_pd(_mm256_castps256_ps128(x));
+    __m256d x_hi = _mm256_cvtps_pd(_mm256_extractf128_ps(x, 1));
+    __m256d n_lo = roundHalfAway(_mm256_mul_pd(x_lo, inv_ln2));
+    __m256d n_hi = roundHalfAway(_mm256_mul_pd(x_hi, inv_ln2));
+    __m256 n_f = _mm256_set_m128(_mm256_cvtpd_ps(n_hi), _mm256_cvtpd_ps(n_lo));
+    __m256i mapped_mask = _mm256_andnot_si256(small_mask, _mm256_castps_si256(valid));
+    n_f = _mm256_and_ps(n_f, _mm256_castsi256_ps(mapped_mask));
+    __m256 x_mapped = subtractLn2(x, n_f);
+
+    // Ajuste fino (applyFineAdjustment): límite en float, pasos de ln 2 en double
+    const __m256 limit_f = _mm256_set1_ps(tables.adjustment_limit);
+    const __m256 neg_limit_f = _mm256_sub_ps(_mm256_setzero_ps(), limit_f);
+    const __m256 one = _mm256_set1_ps(1.0f);
+    for (;;) {
+        __m256 above = _mm256_and_ps(_mm256_cmp_ps(x_mapped, limit_f, _CMP_GT_OQ),
+                                     _mm256_castsi256_ps(mapped_mask));
+        if (_mm256_testz_ps(above, above)) break;
+        __m256 step = _mm256_and_ps(above, one);
+        x_mapped = _mm256_blendv_ps(x_mapped, subtractLn2(x_mapped, step), above);
+        n_f = _mm256_add_ps(n_f, step);
+    }
+    for (;;) {
+        __m256 below = _mm256_and_ps(_mm256_cmp_ps(x_mapped, neg_limit_f, _CMP_LT_OQ),
+                                     _mm256_castsi256_ps(mapped_mask));
+        if (_mm256_testz_ps(below, below)) break;
+        __m256 step = _mm256_and_ps(below, one);
+        __m256 neg_step = _mm256_sub_ps(_mm256_setzero_ps(), step);
+        x_mapped = _mm256_blendv_ps(x_mapped, subtractLn2(x_mapped, neg_step), below);
+        n_f = _mm256_sub_ps(n_f, step);
+    }
+
+    // PASO 4: conversión a Q3.12 (truncamiento, como FixedPoint16(float))
+    __m256i raw_small = _mm256_cvttps_epi32(_mm256_mul_ps(x, fixed_one));
+    __m256i raw_mapped = _mm256_cvttps_epi32(_mm256_mul_ps(x_mapped, fixed_one));
+
+    raw = _mm256_blendv_epi8(raw_saturated, raw_mapped, mapped_mask);
+    raw = _mm256_blendv_epi8(raw, raw_small, small_mask);
+    n = _mm256_and_si256(_mm256_cvtps_epi32(n_f), mapped_mask);
+}
+
+/**
+ * @brief Tabla int16 de 16 entradas partida en bytes bajos / altos para pshufb
+ */
+struct Lookup16 {
+    __m256i low;
+    __m256i high;
+
+    explicit Lookup16(const int16_t* table) {
+        alignas(32) uint8_t low_bytes[32];
+        alignas(32) uint8_t high_bytes[32];
+        for (int i = 0; i < 32; i++) {
+            const uint16_t value = static_cast<uint16_t>(table[i % 16]);
+            low_bytes[i] = static_cast<uint8_t>(value & 0xFF);
+            high_bytes[i] = static_cast<uint8_t>(value >> 8);
+        }
+        low = _mm256_load_si256(reinterpret_cast<const __m256i*>(low_bytes));
+        high = _mm256_load_si256(reinterpret_cast<const __m256i*>(high_bytes));
+    }
+
+    /**
+     * @brief table[index] por lane de 16 bits (index en [0, 15]; negativo → 0)
+     */
+    __m256i operator()(__m256i index) const {
+        const __m256i index_bytes = _mm256_or_si256(index, _mm256_slli_epi16(index, 8));
+        const __m256i low_part = _mm256_and_si256(_mm256_shuffle_epi8(low, index_bytes),
+                                                  _mm256_set1_epi16(0x00FF));
+        return _mm256_or_si256(low_part, _mm256_slli_epi16(_mm256_shuffle_epi8(high, index_bytes), 8));
+    }
+};
+
+/**
+ * @brief Tablas de la selección greedy y de la rotación, construidas una vez por lote
+ */
+struct GreedyLookups {
+    Lookup16 candidates;   // Por longitud en bits - 1
+    Lookup16 splits;
+    Lookup16 angles;       // Por k
+    Lookup16 multipliers;  // 2^(16-k) para mulhi (k ≥ 2)
+    Lookup16 repeats;      // -1 si k = 4, 7, 10, 13
+
+    static const int16_t* multiplierTable() {
+        static const int16_t table[16] = {0, 0, 16384, 8192, 4096, 2048, 1024, 512,
+                                          256, 128, 64, 32, 16, 8, 4, 2};
+        return table;
+    }
+
+    static const int16_t* repeatTable() {
+        static const int16_t table[16] = {0, 0, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0};
+        return table;
+    }
+
+    explicit GreedyLookups(const CORDICKernelTables& tables)
+        : candidates(tables.greedy_candidates), splits(tables.greedy_splits),
+          angles(tables.raw_angles), multipliers(multiplierTable()), repeats(repeatTable()) {}
+};
+
+/**
+ * @brief Longitud en bits de cada lane de 16 bits (sin signo; 0 → 0)
+ *
+ * Sin lzcnt en 16 bits: longitud de cada nibble por pshufb, máximo por
+ * byte y después por lane (+8 si el byte alto no es cero).
+ */
+inline __m256i bitLength16(__m256i v) {
+    const __m256i low_lut = _mm256_setr_epi8(0, 1, 2, 2, 3, 3, 3, 3, 4, 4, 4, 4, 4, 4, 4, 4,
+                                             0, 1, 2, 2, 3, 3, 3, 3, 4, 4, 4, 4, 4, 4, 4, 4);
+    const __m256i high_lut = _mm256_setr_epi8(0, 5, 6, 6, 7, 7, 7, 7, 8, 8, 8, 8, 8, 8, 8, 8,
+                                              0, 5, 6, 6, 7, 7, 7, 7, 8, 8, 8, 8, 8, 8, 8, 8);
+    const __m256i nibble = _mm256_set1_epi8(0x0F);
+    __m256i low = _mm256_shuffle_epi8(low_lut, _mm256_and_si256(v, nibble));
+    __m256i high = _mm256_shuffle_epi8(high_lut, _mm256_and_si256(_mm256_srli_epi16(v, 4), nibble));
+    __m256i byte_bits = _mm256_max_epu8(low, high);
+    __m256i low_byte = _mm256_and_si256(byte_bits, _mm256_set1_epi16(0x00FF));
+    __m256i high_byte = _mm256_srli_epi16(byte_bits, 8);
+    __m256i high_nonzero = _mm256_andnot_si256(_mm256_cmpeq_epi16(high_byte, _mm256_setzero_si256()),
+                                               _mm256_set1_epi16(8));
+    return _mm256_max_epi16(low_byte, _mm256_add_epi16(high_byte, high_nonzero));
+}
+
+/**
+ * @brief Rotaciones greedy sobre 16 lanes (réplica de performIterationsFast)
+ *
+ * @return Rotaciones por lane (Z queda con el residuo final)
+ */
+inline __m256i iterate16(const CORDICKernelTables& tables, const GreedyLookups& lookups,
+                         __m256i& x, __m256i& y, __m256i& z) {
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i one = _mm256_set1_epi16(1);
+    const __m256i max_iter = _mm256_set1_epi16(tables.max_iterations);
+    __m256i iter = zero;
+
+    for (;;) {
+        __m256i active = _mm256_andnot_si256(_mm256_cmpeq_epi16(z, zero),
+                                             _mm256_cmpgt_epi16(max_iter, iter));
+        if (_mm256_testz_si256(active, active)) break;
+
+        // Selección greedy por lane: candidato por longitud en bits de |Z| y
+        // k + 1 si |Z| no llega a su umbral (lanes con Z = 0: índice -1 → k = 0)
+        __m256i abs_z = _mm256_abs_epi16(z);  // |INT16_MIN| = 0x8000 sin signo
+        __m256i row = _mm256_sub_epi16(bitLength16(abs_z), one);
+        __m256i split = lookups.splits(row);
+        __m256i reaches = _mm256_cmpeq_epi16(_mm256_max_epu16(abs_z, split), abs_z);
+        __m256i k = _mm256_add_epi16(_mm256_add_epi16(lookups.candidates(row), one), reaches);
+        __m256i angle = lookups.angles(k);
+        __m256i mult = lookups.multipliers(k);
+        __m256i is_k1 = _mm256_cmpeq_epi16(k, one);
+        __m256i repeat = lookups.repeats(k);
+
+        // Rotación: dirección por lane a partir del signo de Z
+        auto rotate = [&](__m256i mask) {
+            __m256i neg = _mm256_cmpgt_epi16(zero, z);
+            __m256i sx = _mm256_blendv_epi8(_mm256_mulhi_epi16(x, mult),
+                                            _mm256_srai_epi16(x, 1), is_k1);
+            __m256i sy = _mm256_blendv_epi8(_mm256_mulhi_epi16(y, mult),
+                                            _mm256_srai_epi16(y, 1), is_k1);
+            __m256i dx = _mm256_sub_epi16(_mm256_xor_si256(sy, neg), neg);
+            __m256i dy = _mm256_sub_epi16(_mm256_xor_si256(sx, neg), neg);
+            __m256i dz = _mm256_sub_epi16(_mm256_xor_si256(angle, neg), neg);
+            x = _mm256_blendv_epi8(x, _mm256_add_epi16(x, dx), mask);
+            y = _mm256_blendv_epi8(y, _mm256_add_epi16(y, dy), mask);
+            z = _mm256_blendv_epi8(z, _mm256_sub_epi16(z, dz), mask);
+            iter = _mm256_sub_epi16(iter, mask);
+        };
+
+        rotate(active);
+
+        // Repetición k = 4, 7, 10, 13 si Z no convergió y quedan iteraciones
+        __m256i again = _mm256_and_si256(_mm256_and_si256(active, repeat),
+                                         _mm256_andnot_si256(_mm256_cmpeq_epi16(z, zero),
+                                                             _mm256_cmpgt_epi16(max_iter, iter)));
+        if (!_mm256_testz_si256(again, again)) {
+            rotate(again);
+        }
+    }
+    return iter;
+}
+
+/**
+ * @brief Postprocesado de 8 lanes: K = √|X²-Y²|, e^x' = (X + Y) / K, × 2^n
+ */
+inline __m256 postprocess8(__m128i x16, __m128i y16, __m256i n) {
+    const __m256 inv_one = _mm256_set1_ps(1.0f / static_cast<float>(1 << CORDICConfig::FRAC_WIDTH));
+    __m256 xf = _mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_cvtepi16_epi32(x16)), inv_one);
+    __m256 yf = _mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_cvtepi16_epi32(y16)), inv_one);
+    __m256 k_squared = _mm256_sub_ps(_mm256_mul_ps(xf, xf), _mm256_mul_ps(yf, yf));
+    __m256 k = _mm256_sqrt_ps(_mm256_andnot_ps(_mm256_set1_ps(-0.0f), k_squared));
+    __m256 e = _mm256_add_ps(_mm256_div_ps(xf, k), _mm256_div_ps(yf, k));
+    __m256i pow2 = _mm256_slli_epi32(_mm256_add_epi32(n, _mm256_set1_epi32(127)), 23);
+    return _mm256_mul_ps(e, _mm256_castsi256_ps(pow2));
+}
+
+inline void block16(const CORDICKernelTables& tables, const GreedyLookups& lookups,
+                    const float* in, float* out, size_t lanes) {
+    __m256i raw_lo, raw_hi, n_lo, n_hi;
+    preprocess8(tables, _mm256_loadu_ps(in), raw_lo, n_lo);
+    preprocess8(tables, _mm256_loadu_ps(in + 8), raw_hi, n_hi);
+
+    // int32 → int16 conservando el orden de lanes
+    __m256i z = _mm256_permute4x64_epi64(_mm256_packs_epi32(raw_lo, raw_hi), 0xD8);
+    __m256i x = _mm256_set1_epi16(static_cast<int16_t>(1 << CORDICConfig::FRAC_WIDTH));
+    __m256i y = _mm256_setzero_si256();
+
+    const __m256i iter = iterate16(tables, lookups, x, y, z);
+
+#if defined(CORDIC_ENABLE_STATS)
+    alignas(32) int16_t iterations[LANES];
+    alignas(32) int16_t residuals[LANES];
+    alignas(32) int32_t reduction[LANES];
+    _mm256_store_si256(reinterpret_cast<__m256i*>(iterations), iter);
+    _mm256_store_si256(reinterpret_cast<__m256i*>(residuals), z);
+    _mm256_store_si256(reinterpret_cast<__m256i*>(reduction), n_lo);
+    _mm256_store_si256(reinterpret_cast<__m256i*>(reduction + 8), n_hi);
+    cordicStatsRecordBlock(in, iterations, residuals, reduction, lanes);
+#else
+    (void)iter;
+    (void)lanes;
+#endif
+
+    _mm256_storeu_ps(out, postprocess8(_mm256_castsi256_si128(x), _mm256_castsi256_si128(y), n_lo));
+    _mm256_storeu_ps(out + 8, postprocess8(_mm256_extracti128_si256(x, 1),
+                                           _mm256_extracti128_si256(y, 1), n_hi));
+}
+
+}  // namespace
+
+void cordicExpBatchAVX2(const CORDICKernelTables& tables,
+                        const float* inputs, float* outputs, size_t size) {
+    const GreedyLookups lookups(tables);
+    size_t i = 0;
+    for (; i + LANES <= size; i += LANES) {
+        block16(tables, lookups, inputs + i, outputs + i, LANES);
+    }
+
+    if (i < size) {
+        float in_tail[LANES] = {};
+        float out_tail[LANES];
+        std::memcpy(in_tail, inputs + i, (size - i) * sizeof(float));
+        block16(tables, lookups, in_tail, out_tail, size - i);
+        std::memcpy(outputs + i, out_tail, (size - i) * sizeof(float));
+    }
+}
@@ -0,0 +1,260 @@
+/**
+ * @file cordic_simd_avx512.cpp
+ * @brief Kernel AVX-512 (F + BW + VL) de e^x por lotes (16 lanes int16 Q3.12)
+ *
+ * Compilado con -mavx512f -mavx512bw -mavx512vl. Mismas reglas que el kernel
+ * AVX2: solo intrínsecos y constantes de CORDICConfig.
+ *
+ * Con AVX-512BW cada lane usa su propio shift (vpsravw) y la selección greedy,
+ * la dirección de rotación y las lanes activas son registros de máscara k.
+ */
+
+#include "cordic_simd.h"
+#include "cordic_stats.h"
+#include "cordic_types.h"
+#include <immintrin.h>
+#include <cstring>
+
+namespace {
+
+constexpr int LANES = 16;
+constexpr float PRACTICAL_LIMIT = 15.0f;  // Igual que CORDICPreprocessor::validateInput
+
+/**
+ * @brief Mitades baja/alta de 16 floats como 2 × 8 doubles
+ */
+inline __m512d lowToDouble(__m512 v) {
+    return _mm512_cvtps_pd(_mm512_castps512_ps256(v));
+}
+
+inline __m512d highToDouble(__m512 v) {
+    return _mm512_cvtps_pd(_mm256_castpd_ps(_mm512_extractf64x4_pd(_mm512_castps_pd(v), 1)));
+}
+
+inline __m512 fromDoubles(__m512d lo, __m512d hi) {
+    return _mm512_castpd_ps(_mm512_insertf64x4(
+        _mm512_castps_pd(_mm512_castps256_ps512(_mm512_cvtpd_ps(lo))),
+        _mm256_castps_pd(_mm512_cvtpd_ps(hi)), 1));
+}
+
+/**
+ * @brief round() de C (mitades lejos de cero) en double
+ */
+inline __m512d roundHalfAway(__m512d v) {
+    __m512d t = _mm512_roundscale_pd(v, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC);
+    __m512d frac = _mm512_sub_pd(v, t);
+    __mmask8 up = _mm512_cmp_pd_mask(frac, _mm512_set1_pd(0.5), _CMP_GE_OQ);
+    __mmask8 down = _mm512_cmp_pd_mask(frac, _mm512_set1_pd(-0.5), _CMP_LE_OQ);
+    t = _mm512_mask_add_pd(t, up, t, _mm512_set1_pd(1.0));
+    return _mm512_mask_sub_pd(t, down, t, _mm512_set1_pd(1.0));
+}
+
+/**
+ * @brief x - LN2 * delta en double con redondeo final a float (16 lanes)
+ */
+inline __m512 subtractLn2(__m512 x, __m512 delta) {
+    const __m512d ln2 = _mm512_set1_pd(CORDICConfig::LN2);
+    __m512d lo = _mm512_sub_pd(lowToDouble(x), _mm512_mul_pd(lowToDouble(delta), ln2));
+    __m512d hi = _mm512_sub_pd(highToDouble(x), _mm512_mul_pd(highToDouble(delta), ln2));
+    return fromDoubles(lo, hi);
+}
+
+/**
+ * @brief Preprocesado de 16 elementos (réplica de CORDICPreprocessor::processInput)
+ *
+ * @param tables Umbrales float precalculados
+ * @param x Entradas
+ * @param n [out] Factor de reducción (int32)
+ * @return Entrada mapeada Q3.12 (int16)
+ */
+inline __m256i preprocess16(const CORDICKernelTables& tables, __m512 x, __m512i& n) {
+    const __m512 fixed_one = _mm512_set1_ps(static_cast<float>(1 << CORDICConfig::FRAC_WIDTH));
+
+    // PASO 1: entradas inválidas (NaN, ±inf, fuera de ±15) → saturación con n = 0
+    __mmask16 valid = _mm512_cmp_ps_mask(x, _mm512_set1_ps(-PRACTICAL_LIMIT), _CMP_GE_OQ) &
+                      _mm512_cmp_ps_mask(x, _mm512_set1_ps(PRACTICAL_LIMIT), _CMP_LE_OQ);
+    __mmask16 below_min = _mm512_cmp_ps_mask(x, _mm512_set1_ps(CORDICConfig::SOFTMAX_MIN_LOGIT),
+                                             _CMP_LT_OQ);
+    __m512i raw = _mm512_mask_mov_epi32(_mm512_set1_epi32(INT16_MAX), below_min,
+                                        _mm512_set1_epi32(INT16_MIN));
+
+    // PASO 2: |x| ≤ CONVERGENCE_LIMIT
+    __mmask16 small = valid & _mm512_cmp_ps_mask(_mm512_abs_ps(x),
+                                                 _mm512_set1_ps(tables.small_input_limit),
+                                                 _CMP_LE_OQ);
+    __mmask16 mapped = valid & static_cast<__mmask16>(~small);
+
+    // PASO 3: mapeo e^x = 2^n × e^(x'), n = round(x / ln 2) en double
+    const __m512d inv_ln2 = _mm512_set1_pd(CORDICConfig::INV_LN2);
+    __m512 n_f = fromDoubles(roundHalfAway(_mm512_mul_pd(lowToDouble(x), inv_ln2)),
+                             roundHalfAway(_mm512_mul_pd(highToDouble(x), inv_ln2)));
+    n_f = _mm512_maskz_mov_ps(mapped, n_f);
+    __m512 x_mapped = subtractLn2(x, n_f);
+
+    // Ajuste fino (applyFineAdjustment): límite en float, pasos de ln 2 en double
+    const __m512 limit_f = _mm512_set1_ps(tables.adjustment_limit);
+    const __m512 neg_limit_f = _mm512_sub_ps(_mm512_setzero_ps(), limit_f);
+    const __m512 one = _mm512_set1_ps(1.0f);
+    for (;;) {
+        __mmask16 above = mapped & _mm512_cmp_ps_mask(x_mapped, limit_f, _CMP_GT_OQ);
+        if (above == 0) break;
+        x_mapped = _mm512_mask_mov_ps(x_mapped, above, subtractLn2(x_mapped, one));
+        n_f = _mm512_mask_add_ps(n_f, above, n_f, one);
+    }
+    for (;;) {
+        __mmask16 below = mapped & _mm512_cmp_ps_mask(x_mapped, neg_limit_f, _CMP_LT_OQ);
+        if (below == 0) break;
+        x_mapped = _mm512_mask_mov_ps(x_mapped, below,
+                                      subtractLn2(x_mapped, _mm512_set1_ps(-1.0f)));
+        n_f = _mm512_mask_sub_ps(n_f, below, n_f, one);
+    }
+
+    // PASO 4: conversión a Q3.12 (truncamiento, como FixedPoint16(float))
+    __m512i raw_mapped = _mm512_cvttps_epi32(_mm512_mul_ps(x_mapped, fixed_one));
+    __m512i raw_small = _mm512_cvttps_epi32(_mm512_mul_ps(x, fixed_one));
+    raw = _mm512_mask_mov_epi32(raw, mapped, raw_mapped);
+    raw = _mm512_mask_mov_epi32(raw, small, raw_small);
+    n = _mm512_maskz_mov_epi32(mapped, _mm512_cvtps_epi32(n_f));
+    return _mm512_cvtsepi32_epi16(raw);
+}
+
+/**
+ * @brief Longitud en bits de cada lane de 16 bits (sin signo; 0 → 0)
+ *
+ * Sin AVX512CD (vplzcnt) ni lzcnt en 16 bits: longitud de cada nibble por
+ * vpshufb, máximo por byte y después por lane (+8 si el byte alto no es cero).
+ */
+inline __m256i bitLength16(__m256i v) {
+    const __m256i low_lut = _mm256_setr_epi8(0, 1, 2, 2, 3, 3, 3, 3, 4, 4, 4, 4, 4, 4, 4, 4,
+                                             0, 1, 2, 2, 3, 3, 3, 3, 4, 4, 4, 4, 4, 4, 4, 4);
+    const __m256i high_lut = _mm256_setr_epi8(0, 5, 6, 6, 7, 7, 7, 7, 8, 8, 8, 8, 8, 8, 8, 8,
+                                              0, 5, 6, 6, 7, 7, 7, 7, 8, 8, 8, 8, 8, 8, 8, 8);
+    const __m256i nibble = _mm256_set1_epi8(0x0F);
+    __m256i low = _mm256_shuffle_epi8(low_lut, _mm256_and_si256(v, nibble));
+    __m256i high = _mm256_shuffle_epi8(high_lut, _mm256_and_si256(_mm256_srli_epi16(v, 4), nibble));
+    __m256i byte_bits = _mm256_max_epu8(low, high);
+    __m256i high_byte = _mm256_srli_epi16(byte_bits, 8);
+    __m256i low_byte = _mm256_and_si256(byte_bits, _mm256_set1_epi16(0x00FF));
+    __m256i high_bits = _mm256_maskz_add_epi16(_mm256_test_epi16_mask(high_byte, high_byte),
+                                               high_byte, _mm256_set1_epi16(8));
+    return _mm256_max_epu16(low_byte, high_bits);
+}
+
+/**
+ * @brief Rotaciones greedy sobre 16 lanes (réplica de performIterationsFast)
+ *
+ * @return Rotaciones por lane (Z queda con el residuo final)
+ */
+inline __m256i iterate16(const CORDICKernelTables& tables, __m256i& x, __m256i& y, __m256i& z) {
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i one = _mm256_set1_epi16(1);
+    const __m256i max_iter = _mm256_set1_epi16(tables.max_iterations);
+    const __m256i angle_lut = _mm256_loadu_si256(
+        reinterpret_cast<const __m256i*>(tables.raw_angles));
+    const __m256i candidate_lut = _mm256_loadu_si256(
+        reinterpret_cast<const __m256i*>(tables.greedy_candidates));
+    const __m256i split_lut = _mm256_loadu_si256(
+        reinterpret_cast<const __m256i*>(tables.greedy_splits));
+    // Índices con repetición: k = 4, 7, 10, 13
+    const __m256i repeat_lut = _mm256_setr_epi16(0, 0, 0, 0, 1, 0, 0, 1, 0, 0, 1, 0, 0, 1, 0, 0);
+    __m256i iter = zero;
+
+    for (;;) {
+        __mmask16 active = _mm256_cmpneq_epi16_mask(z, zero) &
+                           _mm256_cmpgt_epi16_mask(max_iter, iter);
+        if (active == 0) break;
+
+        // Selección greedy por lane: candidato por longitud en bits de |Z| y
+        // k + 1 si |Z| no llega a su umbral (lanes con Z = 0 quedan inactivas)
+        __m256i abs_z = _mm256_abs_epi16(z);  // |INT16_MIN| = 0x8000 sin signo
+        __m256i row = _mm256_sub_epi16(bitLength16(abs_z), one);
+        __m256i k_vec = _mm256_permutexvar_epi16(row, candidate_lut);
+        __mmask16 short_of_split = _mm256_cmplt_epu16_mask(
+            abs_z, _mm256_permutexvar_epi16(row, split_lut));
+        k_vec = _mm256_mask_add_epi16(k_vec, short_of_split, k_vec, one);
+        __m256i angle = _mm256_permutexvar_epi16(k_vec, angle_lut);
+        __mmask16 repeat = _mm256_cmpneq_epi16_mask(_mm256_permutexvar_epi16(k_vec, repeat_lut),
+                                                    zero);
+
+        // Rotación: dirección por lane (máscara) a partir del signo de Z
+        auto rotate = [&](__mmask16 mask) {
+            __mmask16 neg = _mm256_cmplt_epi16_mask(z, zero);
+            __m256i sx = _mm256_srav_epi16(x, k_vec);
+            __m256i sy = _mm256_srav_epi16(y, k_vec);
+            __m256i x_new = _mm256_mask_sub_epi16(_mm256_add_epi16(x, sy), neg, x, sy);
+            __m256i y_new = _mm256_mask_sub_epi16(_mm256_add_epi16(y, sx), neg, y, sx);
+            __m256i z_new = _mm256_mask_add_epi16(_mm256_sub_epi16(z, angle), neg, z, angle);
+            x = _mm256_mask_mov_epi16(x, mask, x_new);
+            y = _mm256_mask_mov_epi16(y, mask, y_new);
+            z = _mm256_mask_mov_epi16(z, mask, z_new);
+            iter = _mm256_mask_add_epi16(iter, mask, iter, one);
+        };
+
+        rotate(active);
+
+        // Repetición k = 4, 7, 10, 13 si Z no convergió y quedan iteraciones
+        __mmask16 again = active & repeat & _mm256_cmpneq_epi16_mask(z, zero) &
+                          _mm256_cmpgt_epi16_mask(max_iter, iter);
+        if (again != 0) {
+            rotate(again);
+        }
+    }
+    return iter;
+}
+
+/**
+ * @brief Postprocesado: K = √|X²-Y²|, e^x' = X/K + Y/K, × 2^n
+ */
+inline __m512 postprocess16(__m256i x16, __m256i y16, __m512i n) {
+    const __m512 inv_one =
+        _mm512_set1_ps(1.0f / static_cast<float>(1 << CORDICConfig::FRAC_WIDTH));
+    __m512 xf = _mm512_mul_ps(_mm512_cvtepi32_ps(_mm512_cvtepi16_epi32(x16)), inv_one);
+    __m512 yf = _mm512_mul_ps(_mm512_cvtepi32_ps(_mm512_cvtepi16_epi32(y16)), inv_one);
+    __m512 k_squared = _mm512_sub_ps(_mm512_mul_ps(xf, xf), _mm512_mul_ps(yf, yf));
+    __m512 k = _mm512_sqrt_ps(_mm512_abs_ps(k_squared));
+    __m512 e = _mm512_add_ps(_mm512_div_ps(xf, k), _mm512_div_ps(yf, k));
+    __m512i pow2 = _mm512_slli_epi32(_mm512_add_epi32(n, _mm512_set1_epi32(127)), 23);
+    return _mm512_mul_ps(e, _mm512_castsi512_ps(pow2));
+}
+
+inline void block16(const CORDICKernelTables& tables, const float* in, float* out, size_t lanes) {
+    __m512i n;
+    __m256i z = preprocess16(tables, _mm512_loadu_ps(in), n);
+    __m256i x = _mm256_set1_epi16(static_cast<int16_t>(1 << CORDICConfig::FRAC_WIDTH));
+    __m256i y = _mm256_setzero_si256();
+
+    const __m256i iter = iterate16(tables, x, y, z);
+
+#if defined(CORDIC_ENABLE_STATS)
+    alignas(32) int16_t iterations[LANES];
+    alignas(32) int16_t residuals[LANES];
+    alignas(64) int32_t reduction[LANES];
+    _mm256_store_si256(reinterpret_cast<__m256i*>(iterations), iter);
+    _mm256_store_si256(reinterpret_cast<__m256i*>(residuals), z);
+    _mm512_store_si512(reduction, n);
+    cordicStatsRecordBlock(in, iterations, residuals, reduction, lanes);
+#else
+    (void)iter;
+    (void)lanes;
+#endif
+
+    _mm512_storeu_ps(out, postprocess16(x, y, n));
+}
+
+}  // namespace
+
+void cordicExpBatchAVX512(const CORDICKernelTables& tables,
+                          const float* inputs, float* outputs, size_t size) {
+    size_t i = 0;
+    for (; i + LANES <= size; i += LANES) {
+        block16(tables, inputs + i, outputs + i, LANES);
+    }
+
+    if (i < size) {
+        float in_tail[LANES] = {};
+        float out_tail[LANES];
+        std::memcpy(in_tail, inputs + i, (size - i) * sizeof(float));
+        block16(tables, in_tail, out_tail, size - i);
+        std::memcpy(outputs + i, out_tail, (size - i) * sizeof(float));
+    }
+}
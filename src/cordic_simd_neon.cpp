@@ -0,0 +1,264 @@
+/**
+ * @file cordic_simd_neon.cpp
+ * @brief Kernel NEON (AArch64) de e^x por lotes (8 lanes int16 Q3.12)
+ *
+ * Mismo algoritmo que los kernels x86: solo usa intrínsecos y constantes de
+ * CORDICConfig (no instanciar aquí funciones inline compartidas con el resto
+ * de la librería). NEON es obligatorio en AArch64: no hace falta CPUID.
+ *
+ * A diferencia de SSE / AVX, NEON tiene shift variable por lane en 16 bits
+ * (vshlq_s16 con cuenta negativa = Y >> k aritmético), clz por lane y
+ * redondeo con mitades lejos de cero (vrndaq_f64).
+ */
+
+#include "cordic_simd.h"
+#include "cordic_stats.h"
+#include "cordic_types.h"
+#include <arm_neon.h>
+#include <cstring>
+
+namespace {
+
+constexpr int LANES = 8;
+constexpr float PRACTICAL_LIMIT = 15.0f;  // Igual que CORDICPreprocessor::validateInput
+
+/**
+ * @brief float → double → (op) → float para 4 lanes: x - LN2 * delta
+ */
+inline float32x4_t subtractLn2(float32x4_t x, float32x4_t delta) {
+    const float64x2_t ln2 = vdupq_n_f64(CORDICConfig::LN2);
+    float64x2_t lo = vsubq_f64(vcvt_f64_f32(vget_low_f32(x)),
+                               vmulq_f64(vcvt_f64_f32(vget_low_f32(delta)), ln2));
+    float64x2_t hi = vsubq_f64(vcvt_high_f64_f32(x), vmulq_f64(vcvt_high_f64_f32(delta), ln2));
+    return vcvt_high_f32_f64(vcvt_f32_f64(lo), hi);
+}
+
+/**
+ * @brief Preprocesado de 4 elementos (réplica de CORDICPreprocessor::processInput)
+ *
+ * @param tables Umbrales float precalculados
+ * @param x Entradas
+ * @param raw [out] Entrada mapeada Q3.12 (int32)
+ * @param n [out] Factor de reducción
+ */
+inline void preprocess4(const CORDICKernelTables& tables, float32x4_t x, int32x4_t& raw,
+                        int32x4_t& n) {
+    const float32x4_t fixed_one = vdupq_n_f32(static_cast<float>(1 << CORDICConfig::FRAC_WIDTH));
+
+    // PASO 1: entradas inválidas (NaN, ±inf, fuera de ±15) → saturación con n = 0
+    uint32x4_t valid = vandq_u32(vcgeq_f32(x, vdupq_n_f32(-PRACTICAL_LIMIT)),
+                                 vcleq_f32(x, vdupq_n_f32(PRACTICAL_LIMIT)));
+    uint32x4_t below_min = vcltq_f32(x, vdupq_n_f32(CORDICConfig::SOFTMAX_MIN_LOGIT));
+    int32x4_t raw_saturated = vbslq_s32(below_min, vdupq_n_s32(INT16_MIN),
+                                        vdupq_n_s32(INT16_MAX));
+
+    // PASO 2: |x| ≤ CONVERGENCE_LIMIT (umbral float equivalente a la comparación double)
+    uint32x4_t small_mask = vcleq_f32(vabsq_f32(x), vdupq_n_f32(tables.small_input_limit));
+
+    // PASO 3: mapeo e^x = 2^n × e^(x'), n = round(x / ln 2) en double
+    const float64x2_t inv_ln2 = vdupq_n_f64(CORDICConfig::INV_LN2);
+    float64x2_t n_lo = vrndaq_f64(vmulq_f64(vcvt_f64_f32(vget_low_f32(x)), inv_ln2));
+    float64x2_t n_hi = vrndaq_f64(vmulq_f64(vcvt_high_f64_f32(x), inv_ln2));
+    float32x4_t n_f = vcvt_high_f32_f64(vcvt_f32_f64(n_lo), n_hi);
+    uint32x4_t mapped_mask = vbicq_u32(valid, small_mask);
+    n_f = vreinterpretq_f32_u32(vandq_u32(vreinterpretq_u32_f32(n_f), mapped_mask));
+    float32x4_t x_mapped = subtractLn2(x, n_f);
+
+    // Ajuste fino (applyFineAdjustment): límite en float, pasos de ln 2 en double
+    const float32x4_t limit_f = vdupq_n_f32(tables.adjustment_limit);
+    const float32x4_t neg_limit_f = vsubq_f32(vdupq_n_f32(0.0f), limit_f);
+    const uint32x4_t one_bits = vreinterpretq_u32_f32(vdupq_n_f32(1.0f));
+    for (;;) {
+        uint32x4_t above = vandq_u32(vcgtq_f32(x_mapped, limit_f), mapped_mask);
+        if (vmaxvq_u32(above) == 0) break;
+        float32x4_t step = vreinterpretq_f32_u32(vandq_u32(above, one_bits));
+        x_mapped = vbslq_f32(above, subtractLn2(x_mapped, step), x_mapped);
+        n_f = vaddq_f32(n_f, step);
+    }
+    for (;;) {
+        uint32x4_t below = vandq_u32(vcltq_f32(x_mapped, neg_limit_f), mapped_mask);
+        if (vmaxvq_u32(below) == 0) break;
+        float32x4_t step = vreinterpretq_f32_u32(vandq_u32(below, one_bits));
+        float32x4_t neg_step = vsubq_f32(vdupq_n_f32(0.0f), step);
+        x_mapped = vbslq_f32(below, subtractLn2(x_mapped, neg_step), x_mapped);
+        n_f = vsubq_f32(n_f, step);
+    }
+
+    // PASO 4: conversión a Q3.12 (truncamiento, como FixedPoint16(float))
+    int32x4_t raw_small = vcvtq_s32_f32(vmulq_f32(x, fixed_one));
+    int32x4_t raw_mapped = vcvtq_s32_f32(vmulq_f32(x_mapped, fixed_one));
+
+    raw = vbslq_s32(mapped_mask, raw_mapped, raw_saturated);
+    raw = vbslq_s32(small_mask, raw_small, raw);
+    n = vandq_s32(vcvtnq_s32_f32(n_f), vreinterpretq_s32_u32(mapped_mask));
+}
+
+/**
+ * @brief Tabla int16 de 16 entradas partida en bytes bajos / altos para tbl
+ */
+struct Lookup16 {
+    uint8x16_t low;
+    uint8x16_t high;
+
+    explicit Lookup16(const int16_t* table) {
+        uint8_t low_bytes[16];
+        uint8_t high_bytes[16];
+        for (int i = 0; i < 16; i++) {
+            const uint16_t value = static_cast<uint16_t>(table[i]);
+            low_bytes[i] = static_cast<uint8_t>(value & 0xFF);
+            high_bytes[i] = static_cast<uint8_t>(value >> 8);
+        }
+        low = vld1q_u8(low_bytes);
+        high = vld1q_u8(high_bytes);
+    }
+
+    /**
+     * @brief table[index] por lane de 16 bits (index en [0, 15]; negativo → 0)
+     */
+    int16x8_t operator()(int16x8_t index) const {
+        const uint8x16_t index_bytes =
+            vreinterpretq_u8_s16(vorrq_s16(index, vshlq_n_s16(index, 8)));
+        const uint16x8_t low_part = vandq_u16(vreinterpretq_u16_u8(vqtbl1q_u8(low, index_bytes)),
+                                              vdupq_n_u16(0x00FF));
+        const uint16x8_t high_part =
+            vshlq_n_u16(vreinterpretq_u16_u8(vqtbl1q_u8(high, index_bytes)), 8);
+        return vreinterpretq_s16_u16(vorrq_u16(low_part, high_part));
+    }
+};
+
+/**
+ * @brief Tablas de la selección greedy y de la rotación, construidas una vez por lote
+ */
+struct GreedyLookups {
+    Lookup16 candidates;   // Por longitud en bits - 1
+    Lookup16 splits;
+    Lookup16 angles;       // Por k
+    Lookup16 repeats;      // -1 si k = 4, 7, 10, 13
+
+    static const int16_t* repeatTable() {
+        static const int16_t table[16] = {0, 0, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0};
+        return table;
+    }
+
+    explicit GreedyLookups(const CORDICKernelTables& tables)
+        : candidates(tables.greedy_candidates), splits(tables.greedy_splits),
+          angles(tables.raw_angles), repeats(repeatTable()) {}
+};
+
+/**
+ * @brief Rotaciones greedy sobre 8 lanes (réplica de performIterationsFast)
+ *
+ * @return Rotaciones por lane (Z queda con el residuo final)
+ */
+inline int16x8_t iterate8(const CORDICKernelTables& tables, const GreedyLookups& lookups,
+                          int16x8_t& x, int16x8_t& y, int16x8_t& z) {
+    const int16x8_t zero = vdupq_n_s16(0);
+    const int16x8_t one = vdupq_n_s16(1);
+    const int16x8_t max_iter = vdupq_n_s16(tables.max_iterations);
+    int16x8_t iter = zero;
+
+    for (;;) {
+        uint16x8_t active = vbicq_u16(vcgtq_s16(max_iter, iter), vceqq_s16(z, zero));
+        if (vmaxvq_u16(active) == 0) break;
+
+        // Selección greedy por lane: candidato por longitud en bits de |Z| y
+        // k + 1 si |Z| no llega a su umbral (lanes con Z = 0: índice -1 → k = 0)
+        uint16x8_t abs_z = vreinterpretq_u16_s16(vabsq_s16(z));  // |INT16_MIN| = 0x8000
+        int16x8_t bits = vsubq_s16(vdupq_n_s16(16), vreinterpretq_s16_u16(vclzq_u16(abs_z)));
+        int16x8_t row = vsubq_s16(bits, one);
+        uint16x8_t reaches = vcgeq_u16(abs_z, vreinterpretq_u16_s16(lookups.splits(row)));
+        int16x8_t k = vaddq_s16(vaddq_s16(lookups.candidates(row), one),
+                                vreinterpretq_s16_u16(reaches));
+        int16x8_t angle = lookups.angles(k);
+        int16x8_t shift = vnegq_s16(k);
+        uint16x8_t repeat = vreinterpretq_u16_s16(lookups.repeats(k));
+
+        // Rotación: dirección por lane a partir del signo de Z
+        auto rotate = [&](uint16x8_t mask) {
+            int16x8_t neg = vreinterpretq_s16_u16(vcltq_s16(z, zero));
+            int16x8_t sx = vshlq_s16(x, shift);
+            int16x8_t sy = vshlq_s16(y, shift);
+            int16x8_t dx = vsubq_s16(veorq_s16(sy, neg), neg);
+            int16x8_t dy = vsubq_s16(veorq_s16(sx, neg), neg);
+            int16x8_t dz = vsubq_s16(veorq_s16(angle, neg), neg);
+            x = vbslq_s16(mask, vaddq_s16(x, dx), x);
+            y = vbslq_s16(mask, vaddq_s16(y, dy), y);
+            z = vbslq_s16(mask, vsubq_s16(z, dz), z);
+            iter = vsubq_s16(iter, vreinterpretq_s16_u16(mask));
+        };
+
+        rotate(active);
+
+        // Repetición k = 4, 7, 10, 13 si Z no convergió y quedan iteraciones
+        uint16x8_t again = vandq_u16(vandq_u16(active, repeat),
+                                     vbicq_u16(vcgtq_s16(max_iter, iter), vceqq_s16(z, zero)));
+        if (vmaxvq_u16(again) != 0) {
+            rotate(again);
+        }
+    }
+    return iter;
+}
+
+/**
+ * @brief Postprocesado de 4 lanes: K = √|X²-Y²|, e^x' = (X + Y) / K, × 2^n
+ */
+inline float32x4_t postprocess4(int16x4_t x16, int16x4_t y16, int32x4_t n) {
+    const float32x4_t inv_one =
+        vdupq_n_f32(1.0f / static_cast<float>(1 << CORDICConfig::FRAC_WIDTH));
+    float32x4_t xf = vmulq_f32(vcvtq_f32_s32(vmovl_s16(x16)), inv_one);
+    float32x4_t yf = vmulq_f32(vcvtq_f32_s32(vmovl_s16(y16)), inv_one);
+    float32x4_t k_squared = vsubq_f32(vmulq_f32(xf, xf), vmulq_f32(yf, yf));
+    float32x4_t k = vsqrtq_f32(vabsq_f32(k_squared));
+    float32x4_t e = vaddq_f32(vdivq_f32(xf, k), vdivq_f32(yf, k));
+    int32x4_t pow2 = vshlq_n_s32(vaddq_s32(n, vdupq_n_s32(127)), 23);
+    return vmulq_f32(e, vreinterpretq_f32_s32(pow2));
+}
+
+inline void block8(const CORDICKernelTables& tables, const GreedyLookups& lookups,
+                   const float* in, float* out, size_t lanes) {
+    int32x4_t raw_lo, raw_hi, n_lo, n_hi;
+    preprocess4(tables, vld1q_f32(in), raw_lo, n_lo);
+    preprocess4(tables, vld1q_f32(in + 4), raw_hi, n_hi);
+
+    int16x8_t z = vcombine_s16(vqmovn_s32(raw_lo), vqmovn_s32(raw_hi));
+    int16x8_t x = vdupq_n_s16(static_cast<int16_t>(1 << CORDICConfig::FRAC_WIDTH));
+    int16x8_t y = vdupq_n_s16(0);
+
+    const int16x8_t iter = iterate8(tables, lookups, x, y, z);
+
+#if defined(CORDIC_ENABLE_STATS)
+    int16_t iterations[LANES];
+    int16_t residuals[LANES];
+    int32_t reduction[LANES];
+    vst1q_s16(iterations, iter);
+    vst1q_s16(residuals, z);
+    vst1q_s32(reduction, n_lo);
+    vst1q_s32(reduction + 4, n_hi);
+    cordicStatsRecordBlock(in, iterations, residuals, reduction, lanes);
+#else
+    (void)iter;
+    (void)lanes;
+#endif
+
+    vst1q_f32(out, postprocess4(vget_low_s16(x), vget_low_s16(y), n_lo));
+    vst1q_f32(out + 4, postprocess4(vget_high_s16(x), vget_high_s16(y), n_hi));
+}
+
+}  // namespace
+
+void cordicExpBatchNEON(const CORDICKernelTables& tables,
+                        const float* inputs, float* outputs, size_t size) {
+    const GreedyLookups lookups(tables);
+    size_t i = 0;
+    for (; i + LANES <= size; i += LANES) {
+        block8(tables, lookups, inputs + i, outputs + i, LANES);
+    }
+
+    if (i < size) {
+        float in_tail[LANES] = {};
+        float out_tail[LANES];
+        std::memcpy(in_tail, inputs + i, (size - i) * sizeof(float));
+        block8(tables, lookups, in_tail, out_tail, size - i);
+        std::memcpy(outputs + i, out_tail, (size - i) * sizeof(float));
+    }
+}
@@ -0,0 +1,320 @@
+/**
+ * @file cordic_simd_sse41.cpp
+ * @brief Kernel SSE4.1 de e^x por lotes (8 lanes int16 Q3.12)
+ *
+ * Compilado con -msse4.1. Mismo algoritmo que el kernel AVX2 sobre registros
+ * de 128 bits: solo usa intrínsecos y constantes de CORDICConfig (no
+ * instanciar aquí funciones inline compartidas con el resto de la librería).
+ *
+ * Sin shift variable por lane en 16 bits: Y >> k se calcula como
+ * mulhi(Y, 2^(16-k)), exacto para k >= 2, y srai(Y, 1) para k = 1.
+ */
+
+#include "cordic_simd.h"
+#include "cordic_stats.h"
+#include "cordic_types.h"
+#include <smmintrin.h>
+#include <cstring>
+
+namespace {
+
+constexpr int LANES = 8;
+constexpr float PRACTICAL_LIMIT = 15.0f;  // Igual que CORDICPreprocessor::validateInput
+
+/**
+ * @brief round() de C (mitades lejos de cero) en double
+ */
+inline __m128d roundHalfAway(__m128d v) {
+    const __m128d half = _mm_set1_pd(0.5);
+    const __m128d one = _mm_set1_pd(1.0);
+    __m128d t = _mm_round_pd(v, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC);
+    __m128d frac = _mm_sub_pd(v, t);
+    __m128d up = _mm_and_pd(_mm_cmpge_pd(frac, half), one);
+    __m128d down = _mm_and_pd(_mm_cmple_pd(frac, _mm_sub_pd(_mm_setzero_pd(), half)), one);
+    return _mm_sub_pd(_mm_add_pd(t, up), down);
+}
+
+inline __m128d lowToDouble(__m128 v) {
+    return _mm_cvtps_pd(v);
+}
+
+inline __m128d highToDouble(__m128 v) {
+    return _mm_cvtps_pd(_mm_movehl_ps(v, v));
+}
+
+inline __m128 toFloat(__m128d lo, __m128d hi) {
+    return _mm_movelh_ps(_mm_cvtpd_ps(lo), _mm_cvtpd_ps(hi));
+}
+
+/**
+ * @brief float → double → (op) → float para 4 lanes: x - LN2 * delta
+ */
+inline __m128 subtractLn2(__m128 x, __m128 delta) {
+    const __m128d ln2 = _mm_set1_pd(CORDICConfig::LN2);
+    __m128d lo = _mm_sub_pd(lowToDouble(x), _mm_mul_pd(lowToDouble(delta), ln2));
+    __m128d hi = _mm_sub_pd(highToDouble(x), _mm_mul_pd(highToDouble(delta), ln2));
+    return toFloat(lo, hi);
+}
+
+inline bool anySet(__m128 mask) {
+    return _mm_movemask_ps(mask) != 0;
+}
+
+/**
+ * @brief Preprocesado de 4 elementos (réplica de CORDICPreprocessor::processInput)
+ *
+ * @param tables Umbrales float precalculados
+ * @param x Entradas
+ * @param raw [out] Entrada mapeada Q3.12 (int32)
+ * @param n [out] Factor de reducción
+ */
+inline void preprocess4(const CORDICKernelTables& tables, __m128 x, __m128i& raw, __m128i& n) {
+    const __m128 fixed_one = _mm_set1_ps(static_cast<float>(1 << CORDICConfig::FRAC_WIDTH));
+    const __m128 sign_mask = _mm_set1_ps(-0.0f);
+
+    // PASO 1: entradas inválidas (NaN, ±inf, fuera de ±15) → saturación con n = 0
+    __m128 valid = _mm_and_ps(_mm_cmpge_ps(x, _mm_set1_ps(-PRACTICAL_LIMIT)),
+                              _mm_cmple_ps(x, _mm_set1_ps(PRACTICAL_LIMIT)));
+    __m128i below_min = _mm_castps_si128(
+        _mm_cmplt_ps(x, _mm_set1_ps(CORDICConfig::SOFTMAX_MIN_LOGIT)));
+    __m128i raw_saturated = _mm_blendv_epi8(_mm_set1_epi32(INT16_MAX),
+                                            _mm_set1_epi32(INT16_MIN), below_min);
+
+    // PASO 2: |x| ≤ CONVERGENCE_LIMIT (umbral float equivalente a la comparación double)
+    __m128 abs_x = _mm_andnot_ps(sign_mask, x);
+    __m128i small_mask = _mm_castps_si128(
+        _mm_cmple_ps(abs_x, _mm_set1_ps(tables.small_input_limit)));
+
+    // PASO 3: mapeo e^x = 2^n × e^(x'), n = round(x / ln 2) en double
+    const __m128d inv_ln2 = _mm_set1_pd(CORDICConfig::INV_LN2);
+    __m128d n_lo = roundHalfAway(_mm_mul_pd(lowToDouble(x), inv_ln2));
+    __m128d n_hi = roundHalfAway(_mm_mul_pd(highToDouble(x), inv_ln2));
+    __m128 n_f = toFloat(n_lo, n_hi);
+    __m128i mapped_mask = _mm_andnot_si128(small_mask, _mm_castps_si128(valid));
+    n_f = _mm_and_ps(n_f, _mm_castsi128_ps(mapped_mask));
+    __m128 x_mapped = subtractLn2(x, n_f);
+
+    // Ajuste fino (applyFineAdjustment): límite en float, pasos de ln 2 en double
+    const __m128 limit_f = _mm_set1_ps(tables.adjustment_limit);
+    const __m128 neg_limit_f = _mm_sub_ps(_mm_setzero_ps(), limit_f);
+    const __m128 one = _mm_set1_ps(1.0f);
+    for (;;) {
+        __m128 above = _mm_and_ps(_mm_cmpgt_ps(x_mapped, limit_f), _mm_castsi128_ps(mapped_mask));
+        if (!anySet(above)) break;
+        __m128 step = _mm_and_ps(above, one);
+        x_mapped = _mm_blendv_ps(x_mapped, subtractLn2(x_mapped, step), above);
+        n_f = _mm_add_ps(n_f, step);
+    }
+    for (;;) {
+        __m128 below = _mm_and_ps(_mm_cmplt_ps(x_mapped, neg_limit_f),
+                                  _mm_castsi128_ps(mapped_mask));
+        if (!anySet(below)) break;
+        __m128 step = _mm_and_ps(below, one);
+        __m128 neg_step = _mm_sub_ps(_mm_setzero_ps(), step);
+        x_mapped = _mm_blendv_ps(x_mapped, subtractLn2(x_mapped, neg_step), below);
+        n_f = _mm_sub_ps(n_f, step);
+    }
+
+    // PASO 4: conversión a Q3.12 (truncamiento, como FixedPoint16(float))
+    __m128i raw_small = _mm_cvttps_epi32(_mm_mul_ps(x, fixed_one));
+    __m128i raw_mapped = _mm_cvttps_epi32(_mm_mul_ps(x_mapped, fixed_one));
+
+    raw = _mm_blendv_epi8(raw_saturated, raw_mapped, mapped_mask);
+    raw = _mm_blendv_epi8(raw, raw_small, small_mask);
+    n = _mm_and_si128(_mm_cvtps_epi32(n_f), mapped_mask);
+}
+
+/**
+ * @brief Tabla int16 de 16 entradas partida en bytes bajos / altos para pshufb
+ */
+struct Lookup16 {
+    __m128i low;
+    __m128i high;
+
+    explicit Lookup16(const int16_t* table) {
+        alignas(16) uint8_t low_bytes[16];
+        alignas(16) uint8_t high_bytes[16];
+        for (int i = 0; i < 16; i++) {
+            const uint16_t value = static_cast<uint16_t>(table[i]);
+            low_bytes[i] = static_cast<uint8_t>(value & 0xFF);
+            high_bytes[i] = static_cast<uint8_t>(value >> 8);
+        }
+        low = _mm_load_si128(reinterpret_cast<const __m128i*>(low_bytes));
+        high = _mm_load_si128(reinterpret_cast<const __m128i*>(high_bytes));
+    }
+
+    /**
+     * @brief table[index] por lane de 16 bits (index en [0, 15]; negativo → 0)
+     */
+    __m128i operator()(__m128i index) const {
+        const __m128i index_bytes = _mm_or_si128(index, _mm_slli_epi16(index, 8));
+        const __m128i low_part = _mm_and_si128(_mm_shuffle_epi8(low, index_bytes),
+                                               _mm_set1_epi16(0x00FF));
+        return _mm_or_si128(low_part, _mm_slli_epi16(_mm_shuffle_epi8(high, index_bytes), 8));
+    }
+};
+
+/**
+ * @brief Tablas de la selección greedy y de la rotación, construidas una vez por lote
+ */
+struct GreedyLookups {
+    Lookup16 candidates;   // Por longitud en bits - 1
+    Lookup16 splits;
+    Lookup16 angles;       // Por k
+    Lookup16 multipliers;  // 2^(16-k) para mulhi (k ≥ 2)
+    Lookup16 repeats;      // -1 si k = 4, 7, 10, 13
+
+    static const int16_t* multiplierTable() {
+        static const int16_t table[16] = {0, 0, 16384, 8192, 4096, 2048, 1024, 512,
+                                          256, 128, 64, 32, 16, 8, 4, 2};
+        return table;
+    }
+
+    static const int16_t* repeatTable() {
+        static const int16_t table[16] = {0, 0, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0};
+        return table;
+    }
+
+    explicit GreedyLookups(const CORDICKernelTables& tables)
+        : candidates(tables.greedy_candidates), splits(tables.greedy_splits),
+          angles(tables.raw_angles), multipliers(multiplierTable()), repeats(repeatTable()) {}
+};
+
+/**
+ * @brief Longitud en bits de cada lane de 16 bits (sin signo; 0 → 0)
+ *
+ * Longitud de cada nibble por pshufb, máximo por byte y después por lane
+ * (+8 si el byte alto no es cero).
+ */
+inline __m128i bitLength16(__m128i v) {
+    const __m128i low_lut = _mm_setr_epi8(0, 1, 2, 2, 3, 3, 3, 3, 4, 4, 4, 4, 4, 4, 4, 4);
+    const __m128i high_lut = _mm_setr_epi8(0, 5, 6, 6, 7, 7, 7, 7, 8, 8, 8, 8, 8, 8, 8, 8);
+    const __m128i nibble = _mm_set1_epi8(0x0F);
+    __m128i low = _mm_shuffle_epi8(low_lut, _mm_and_si128(v, nibble));
+    __m128i high = _mm_shuffle_epi8(high_lut, _mm_and_si128(_mm_srli_epi16(v, 4), nibble));
+    __m128i byte_bits = _mm_max_epu8(low, high);
+    __m128i low_byte = _mm_and_si128(byte_bits, _mm_set1_epi16(0x00FF));
+    __m128i high_byte = _mm_srli_epi16(byte_bits, 8);
+    __m128i high_nonzero = _mm_andnot_si128(_mm_cmpeq_epi16(high_byte, _mm_setzero_si128()),
+                                            _mm_set1_epi16(8));
+    return _mm_max_epi16(low_byte, _mm_add_epi16(high_byte, high_nonzero));
+}
+
+/**
+ * @brief Rotaciones greedy sobre 8 lanes (réplica de performIterationsFast)
+ *
+ * @return Rotaciones por lane (Z queda con el residuo final)
+ */
+inline __m128i iterate8(const CORDICKernelTables& tables, const GreedyLookups& lookups,
+                        __m128i& x, __m128i& y, __m128i& z) {
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i one = _mm_set1_epi16(1);
+    const __m128i max_iter = _mm_set1_epi16(tables.max_iterations);
+    __m128i iter = zero;
+
+    for (;;) {
+        __m128i active = _mm_andnot_si128(_mm_cmpeq_epi16(z, zero), _mm_cmpgt_epi16(max_iter, iter));
+        if (_mm_testz_si128(active, active)) break;
+
+        // Selección greedy por lane: candidato por longitud en bits de |Z| y
+        // k + 1 si |Z| no llega a su umbral (lanes con Z = 0: índice -1 → k = 0)
+        __m128i abs_z = _mm_abs_epi16(z);  // |INT16_MIN| = 0x8000 sin signo
+        __m128i row = _mm_sub_epi16(bitLength16(abs_z), one);
+        __m128i split = lookups.splits(row);
+        __m128i reaches = _mm_cmpeq_epi16(_mm_max_epu16(abs_z, split), abs_z);
+        __m128i k = _mm_add_epi16(_mm_add_epi16(lookups.candidates(row), one), reaches);
+        __m128i angle = lookups.angles(k);
+        __m128i mult = lookups.multipliers(k);
+        __m128i is_k1 = _mm_cmpeq_epi16(k, one);
+        __m128i repeat = lookups.repeats(k);
+
+        // Rotación: dirección por lane a partir del signo de Z
+        auto rotate = [&](__m128i mask) {
+            __m128i neg = _mm_cmpgt_epi16(zero, z);
+            __m128i sx = _mm_blendv_epi8(_mm_mulhi_epi16(x, mult), _mm_srai_epi16(x, 1), is_k1);
+            __m128i sy = _mm_blendv_epi8(_mm_mulhi_epi16(y, mult), _mm_srai_epi16(y, 1), is_k1);
+            __m128i dx = _mm_sub_epi16(_mm_xor_si128(sy, neg), neg);
+            __m128i dy = _mm_sub_epi16(_mm_xor_si128(sx, neg), neg);
+            __m128i dz = _mm_sub_epi16(_mm_xor_si128(angle, neg), neg);
+            x = _mm_blendv_epi8(x, _mm_add_epi16(x, dx), mask);
+            y = _mm_blendv_epi8(y, _mm_add_epi16(y, dy), mask);
+            z = _mm_blendv_epi8(z, _mm_sub_epi16(z, dz), mask);
+            iter = _mm_sub_epi16(iter, mask);
+        };
+
+        rotate(active);
+
+        // Repetición k = 4, 7, 10, 13 si Z no convergió y quedan iteraciones
+        __m128i again = _mm_and_si128(_mm_and_si128(active, repeat),
+                                      _mm_andnot_si128(_mm_cmpeq_epi16(z, zero),
+                                                       _mm_cmpgt_epi16(max_iter, iter)));
+        if (!_mm_testz_si128(again, again)) {
+            rotate(again);
+        }
+    }
+    return iter;
+}
+
+/**
+ * @brief Postprocesado de 4 lanes: K = √|X²-Y²|, e^x' = (X + Y) / K, × 2^n
+ */
+inline __m128 postprocess4(__m128i x16, __m128i y16, __m128i n) {
+    const __m128 inv_one = _mm_set1_ps(1.0f / static_cast<float>(1 << CORDICConfig::FRAC_WIDTH));
+    __m128 xf = _mm_mul_ps(_mm_cvtepi32_ps(_mm_cvtepi16_epi32(x16)), inv_one);
+    __m128 yf = _mm_mul_ps(_mm_cvtepi32_ps(_mm_cvtepi16_epi32(y16)), inv_one);
+    __m128 k_squared = _mm_sub_ps(_mm_mul_ps(xf, xf), _mm_mul_ps(yf, yf));
+    __m128 k = _mm_sqrt_ps(_mm_andnot_ps(_mm_set1_ps(-0.0f), k_squared));
+    __m128 e = _mm_add_ps(_mm_div_ps(xf, k), _mm_div_ps(yf, k));
+    __m128i pow2 = _mm_slli_epi32(_mm_add_epi32(n, _mm_set1_epi32(127)), 23);
+    return _mm_mul_ps(e, _mm_castsi128_ps(pow2));
+}
+
+inline void block8(const CORDICKernelTables& tables, const GreedyLookups& lookups,
+                   const float* in, float* out, size_t lanes) {
+    __m128i raw_lo, raw_hi, n_lo, n_hi;
+    preprocess4(tables, _mm_loadu_ps(in), raw_lo, n_lo);
+    preprocess4(tables, _mm_loadu_ps(in + 4), raw_hi, n_hi);
+
+    // int32 → int16 (en 128 bits packs conserva el orden de lanes)
+    __m128i z = _mm_packs_epi32(raw_lo, raw_hi);
+    __m128i x = _mm_set1_epi16(static_cast<int16_t>(1 << CORDICConfig::FRAC_WIDTH));
+    __m128i y = _mm_setzero_si128();
+
+    const __m128i iter = iterate8(tables, lookups, x, y, z);
+
+#if defined(CORDIC_ENABLE_STATS)
+    alignas(16) int16_t iterations[LANES];
+    alignas(16) int16_t residuals[LANES];
+    alignas(16) int32_t reduction[LANES];
+    _mm_store_si128(reinterpret_cast<__m128i*>(iterations), iter);
+    _mm_store_si128(reinterpret_cast<__m128i*>(residuals), z);
+    _mm_store_si128(reinterpret_cast<__m128i*>(reduction), n_lo);
+    _mm_store_si128(reinterpret_cast<__m128i*>(reduction + 4), n_hi);
+    cordicStatsRecordBlock(in, iterations, residuals, reduction, lanes);
+#else
+    (void)iter;
+    (void)lanes;
+#endif
+
+    _mm_storeu_ps(out, postprocess4(x, y, n_lo));
+    _mm_storeu_ps(out + 4, postprocess4(_mm_srli_si128(x, 8), _mm_srli_si128(y, 8), n_hi));
+}
+
+}  // namespace
+
+void cordicExpBatchSSE41(const CORDICKernelTables& tables,
+                         const float* inputs, float* outputs, size_t size) {
+    const GreedyLookups lookups(tables);
+    size_t i = 0;
+    for (; i + LANES <= size; i += LANES) {
+        block8(tables, lookups, inputs + i, outputs + i, LANES);
+    }
+
+    if (i < size) {
+        float in_tail[LANES] = {};
+        float out_tail[LANES];
+        std::memcpy(in_tail, inputs + i, (size - i) * sizeof(float));
+        block8(tables, lookups, in_tail, out_tail, size - i);
+        std::memcpy(outputs + i, out_tail, (size - i) * sizeof(float));
+    }
+}
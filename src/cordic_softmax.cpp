@@ -4,19 +4,44 @@
  */
 
 #include "cordic_softmax.h"
+#include "cordic_online_softmax.h"
+#include "cordic_sampling.h"
+#include "cordic_tables.h"
+#include "cordic_format.h"
+#include "cordic_stats.h"
 #include <iostream>
 #include <iomanip>
 #include <cmath>
+#include <limits>
+#include <stdexcept>
+
+namespace {
+
+// Por debajo, CORDICPreprocessor::validateInput satura la entrada
+constexpr float LOWEST_UNSATURATED_INPUT = -15.0f;
+
+// Exponente de reducción que marca una entrada -inf (salida 0 exacto)
+constexpr int MASKED = std::numeric_limits<int>::min();
+
+}  // namespace
 
 //==============================================================================
 // IMPLEMENTACIÓN CORDICSoftmax
 //==============================================================================
 
 CORDICSoftmax::CORDICSoftmax(bool enable_debug) 
-    : debug_mode(enable_debug) {
+    : kernel_tables(CORDICKernelTables::shared()), debug_mode(enable_debug),
+      sum_mode(CORDICSumMode::FLOAT) {
 }
 
 float CORDICSoftmax::calculateExp(float x) {
+    if (!debug_mode) {
+        if (rotation_config.mode == CORDICRotationMode::FIXED_SCHEDULE) {
+            return calculateExpFolded(x, rotation_config.fixed_last_shift);
+        }
+        return calculateExpFast(x);
+    }
+    
     // PASO 1: Preprocesamiento
     PreprocessResult prep = CORDICPreprocessor::processInput(x, debug_mode);
     
@@ -33,7 +58,36 @@ float CORDICSoftmax::calculateExp(float x) {
     return post_result.exponential_value;
 }
 
+float CORDICSoftmax::calculateExpFast(float x) const {
+    PreprocessResult prep = CORDICPreprocessor::processInput(x, false);
+    
+    CORDICRawState state(FixedPoint16(1.0f).getRaw(), 0, prep.mapped_input.getRaw());
+    iterator.performIterationsFast(state);
+    
+    return CORDICPostprocessor::computeExponential(state, prep);
+}
+
+float CORDICSoftmax::calculateExpFolded(float x) const {
+    PreprocessResult prep = CORDICPreprocessor::processInput(x, false);
+    
+    CORDICRawState state(CORDICTables::FIXED_SCHEDULE_FOLDED_X0, 0, prep.mapped_input.getRaw());
+    CORDICIterator::performIterationsFixed(state);
+    
+    return CORDICPostprocessor::computeExponentialFolded(state, prep);
+}
+
+float CORDICSoftmax::calculateExpFolded(float x, int last_shift) const {
+    PreprocessResult prep = CORDICPreprocessor::processInput(x, false);
+    
+    CORDICRawState state(CORDICIterator::fixedFoldedInitialX(last_shift), 0,
+                         prep.mapped_input.getRaw());
+    CORDICIterator::performIterationsFixed(state, last_shift);
+    
+    return CORDICPostprocessor::computeExponentialFolded(state, prep);
+}
+
 void CORDICSoftmax::computeSoftmax(const float* logits, float* probabilities, size_t size) {
+    CORDICStatsTimer timer;
     if (debug_mode) {
         std::cout << "\n=== SOFTMAX CORDIC ===" << std::endl;
         std::cout << "Procesando " << size << " elementos" << std::endl;
@@ -48,10 +102,18 @@ void CORDICSoftmax::computeSoftmax(const float* logits, float* probabilities, si
     
     // PASO 2: Calcular exponenciales estabilizadas
     float sum = 0.0f;
-    for (size_t i = 0; i < size; i++) {
-        float stabilized_logit = logits[i] - max_logit;
-        probabilities[i] = calculateExp(stabilized_logit);
-        sum += probabilities[i];
+    if (debug_mode) {
+        for (size_t i = 0; i < size; i++) {
+            float stabilized_logit = logits[i] - max_logit;
+            probabilities[i] = calculateExp(stabilized_logit);
+            sum += probabilities[i];
+        }
+    } else if (sum_mode == CORDICSumMode::EXACT) {
+        CORDICExactAccumulator exact;
+        exponentiateStabilized(logits, probabilities, size, max_logit, &exact);
+        sum = exact.toFloat();
+    } else {
+        sum = exponentiateStabilized(logits, probabilities, size, max_logit);
     }
     
     if (debug_mode) {
@@ -75,18 +137,562 @@ void CORDICSoftmax::computeSoftmax(const float* logits, float* probabilities, si
     }
 }
 
+void CORDICSoftmax::computeSoftmaxOnline(const float* logits, float* probabilities,
+                                         size_t size) const {
+    CORDICStatsTimer timer;
+    CORDICOnlineSoftmax online(*this, probabilities, size);
+    online.consume(logits, size);
+    online.finalize();
+}
+
+void CORDICSoftmax::computeSoftmax(const CORDICFloat16* logits, float* probabilities,
+                                   size_t size) const {
+    softmaxConverted(logits, probabilities, size);
+}
+
+void CORDICSoftmax::computeSoftmax(const CORDICFloat16* logits, CORDICFloat16* probabilities,
+                                   size_t size) const {
+    softmaxConverted(logits, probabilities, size);
+}
+
+void CORDICSoftmax::computeSoftmax(const CORDICBFloat16* logits, float* probabilities,
+                                   size_t size) const {
+    softmaxConverted(logits, probabilities, size);
+}
+
+void CORDICSoftmax::computeSoftmax(const CORDICBFloat16* logits, CORDICBFloat16* probabilities,
+                                   size_t size) const {
+    softmaxConverted(logits, probabilities, size);
+}
+
+template <typename In, typename Out>
+void CORDICSoftmax::softmaxConverted(const In* logits, Out* probabilities, size_t size) const {
+    CORDICStatsTimer timer;
+    if (size == 0) {
+        return;
+    }
+    const size_t block = 256;
+    float values[block];
+    
+    // PASO 1: máximo sobre los logits convertidos en registro
+    float max_logit = CORDICHalf::toFloat(logits[0]);
+    for (size_t start = 0; start < size; start += block) {
+        const size_t count = std::min(block, size - start);
+        CORDICHalf::toFloat(logits + start, values, count);
+        for (size_t i = 0; i < count; i++) {
+            max_logit = std::max(max_logit, values[i]);
+        }
+    }
+    
+    // PASO 2: mismos bloques y orden de suma que exponentiateStabilized
+    float sum = 0.0f;
+    CORDICExactAccumulator exact;
+    for (size_t start = 0; start < size; start += block) {
+        const size_t count = std::min(block, size - start);
+        CORDICHalf::toFloat(logits + start, values, count);
+        for (size_t i = 0; i < count; i++) {
+            values[i] -= max_logit;
+        }
+        calculateExpStabilizedBatch(values, values, count);
+        if (sum_mode == CORDICSumMode::EXACT) {
+            exact.add(values, count);
+        } else {
+            for (size_t i = 0; i < count; i++) {
+                sum += values[i];
+            }
+        }
+        CORDICHalf::fromFloat(values, probabilities + start, count);
+    }
+    if (sum_mode == CORDICSumMode::EXACT) {
+        sum = exact.toFloat();
+    }
+    
+    // PASO 3: normalización en sitio sobre la salida
+    const float inv_sum = 1.0f / sum;
+    for (size_t start = 0; start < size; start += block) {
+        const size_t count = std::min(block, size - start);
+        CORDICHalf::toFloat(probabilities + start, values, count);
+        for (size_t i = 0; i < count; i++) {
+            values[i] *= inv_sum;
+        }
+        CORDICHalf::fromFloat(values, probabilities + start, count);
+    }
+}
+
+void CORDICSoftmax::calculateExpBatchFast(const CORDICFloat16* inputs, float* outputs,
+                                          size_t size) const {
+    expBatchConverted(inputs, outputs, size);
+}
+
+void CORDICSoftmax::calculateExpBatchFast(const CORDICFloat16* inputs, CORDICFloat16* outputs,
+                                          size_t size) const {
+    expBatchConverted(inputs, outputs, size);
+}
+
+void CORDICSoftmax::calculateExpBatchFast(const CORDICBFloat16* inputs, float* outputs,
+                                          size_t size) const {
+    expBatchConverted(inputs, outputs, size);
+}
+
+void CORDICSoftmax::calculateExpBatchFast(const CORDICBFloat16* inputs, CORDICBFloat16* outputs,
+                                          size_t size) const {
+    expBatchConverted(inputs, outputs, size);
+}
+
+template <typename In, typename Out>
+void CORDICSoftmax::expBatchConverted(const In* inputs, Out* outputs, size_t size) const {
+    const size_t block = 256;
+    float values[block];
+    for (size_t start = 0; start < size; start += block) {
+        const size_t count = std::min(block, size - start);
+        CORDICHalf::toFloat(inputs + start, values, count);
+        calculateExpBatchFast(values, values, count);
+        CORDICHalf::fromFloat(values, outputs + start, count);
+    }
+}
+
+float CORDICSoftmax::computeLogSumExp(const float* logits, size_t size) const {
+    const float neg_inf = -std::numeric_limits<float>::infinity();
+    if (size == 0) {
+        return neg_inf;
+    }
+    const float max_logit = *std::max_element(logits, logits + size);
+    if (max_logit == neg_inf) {
+        return neg_inf;
+    }
+    const float sum = sumExpStabilized(logits, size, max_logit);
+    return max_logit + CORDICFormatQ2_29::log(sum);
+}
+
+void CORDICSoftmax::computeLogSoftmax(const float* logits, float* log_probs, size_t size) const {
+    CORDICStatsTimer timer;
+    const float neg_inf = -std::numeric_limits<float>::infinity();
+    if (size == 0) {
+        return;
+    }
+    
+    // PASO 1: máximo y ln Σ e^(x - max) (un solo logaritmo CORDIC)
+    const float max_logit = *std::max_element(logits, logits + size);
+    if (max_logit == neg_inf) {
+        std::fill(log_probs, log_probs + size, neg_inf);
+        return;
+    }
+    const float log_sum = CORDICFormatQ2_29::log(sumExpStabilized(logits, size, max_logit));
+    
+    // PASO 2: solo restas, sin log por elemento
+    for (size_t i = 0; i < size; i++) {
+        log_probs[i] = (logits[i] - max_logit) - log_sum;
+    }
+}
+
+void CORDICSoftmax::computeSoftmaxParallel(const float* logits, float* probabilities, 
+                                           size_t size) {
+    CORDICStatsTimer timer;
+    if (size == 0) {
+        return;
+    }
+    
+    const size_t chunk_size = std::max<size_t>(parallel_config.chunk_size, 1);
+    const size_t num_chunks = (size + chunk_size - 1) / chunk_size;
+    CORDICThreadPool& pool = getThreadPool();
+    chunk_partials.resize(num_chunks);
+    
+    auto chunkBegin = [&](size_t chunk) { return chunk * chunk_size; };
+    auto chunkCount = [&](size_t chunk) { return std::min(chunk_size, size - chunk * chunk_size); };
+    
+    // PASO 1: Máximo por chunk
+    pool.parallelFor(num_chunks, [&](size_t chunk) {
+        const float* begin = logits + chunkBegin(chunk);
+        chunk_partials[chunk] = *std::max_element(begin, begin + chunkCount(chunk));
+    });
+    float max_logit = *std::max_element(chunk_partials.begin(), chunk_partials.end());
+    
+    // PASO 2: Exponenciales y sumas parciales por chunk
+    float sum = 0.0f;
+    if (sum_mode == CORDICSumMode::EXACT) {
+        // Parciales enteros exactos: Σ independiente también de chunk_size
+        chunk_accumulators.resize(num_chunks);
+        pool.parallelFor(num_chunks, [&](size_t chunk) {
+            const size_t begin = chunkBegin(chunk);
+            chunk_accumulators[chunk].reset();
+            exponentiateStabilized(logits + begin, probabilities + begin, chunkCount(chunk),
+                                   max_logit, &chunk_accumulators[chunk]);
+        });
+        CORDICExactAccumulator exact;
+        for (const CORDICExactAccumulator& partial : chunk_accumulators) {
+            exact.merge(partial);
+        }
+        sum = exact.toFloat();
+    } else {
+        pool.parallelFor(num_chunks, [&](size_t chunk) {
+            const size_t begin = chunkBegin(chunk);
+            chunk_partials[chunk] = exponentiateStabilized(logits + begin, probabilities + begin,
+                                                           chunkCount(chunk), max_logit);
+        });
+        
+        // Reducción en orden fijo de chunk: independiente del número de hilos
+        for (float partial : chunk_partials) {
+            sum += partial;
+        }
+    }
+    
+    if (debug_mode) {
+        std::cout << "\n=== SOFTMAX CORDIC PARALELO ===" << std::endl;
+        std::cout << "Elementos: " << size << ", chunks: " << num_chunks 
+                  << ", hilos: " << pool.size() << std::endl;
+        std::cout << "Máximo logit: " << max_logit << std::endl;
+        std::cout << "Suma de exponenciales: " << sum << std::endl;
+    }
+    
+    // PASO 3: Normalización por chunk
+    const float inv_sum = 1.0f / sum;
+    pool.parallelFor(num_chunks, [&](size_t chunk) {
+        float* begin = probabilities + chunkBegin(chunk);
+        const size_t count = chunkCount(chunk);
+        for (size_t i = 0; i < count; i++) {
+            begin[i] *= inv_sum;
+        }
+    });
+}
+
+void CORDICSoftmax::computeSoftmaxRows(const float* logits, float* probabilities, size_t rows,
+                                       size_t cols, size_t row_stride, float scale,
+                                       const float* mask, size_t mask_stride, size_t mask_rows) {
+    softmaxRowsImpl(logits, probabilities, rows, cols, row_stride, scale, mask, mask_stride,
+                    mask_rows, nullptr);
+}
+
+void CORDICSoftmax::computeSoftmaxRowsCausal(const float* logits, float* probabilities,
+                                             size_t rows, size_t cols, size_t row_stride,
+                                             const CORDICCausalMask& causal, float scale,
+                                             const float* mask, size_t mask_stride,
+                                             size_t mask_rows) {
+    if (causal.positions == 0) {
+        throw std::invalid_argument("computeSoftmaxRowsCausal: positions debe ser > 0");
+    }
+    softmaxRowsImpl(logits, probabilities, rows, cols, row_stride, scale, mask, mask_stride,
+                    mask_rows, &causal);
+}
+
+void CORDICSoftmax::softmaxRowsImpl(const float* logits, float* probabilities, size_t rows,
+                                    size_t cols, size_t row_stride, float scale,
+                                    const float* mask, size_t mask_stride, size_t mask_rows,
+                                    const CORDICCausalMask* causal) {
+    if (row_stride < cols) {
+        throw std::invalid_argument("computeSoftmaxRows: row_stride menor que cols");
+    }
+    if (mask && (mask_stride < cols || mask_rows == 0)) {
+        throw std::invalid_argument("computeSoftmaxRows: máscara con stride o filas inválidos");
+    }
+    if (rows == 0 || cols == 0) {
+        return;
+    }
+    CORDICStatsTimer timer;
+    
+    // Grupos de filas de ~chunk_size elementos: amortiza el reparto con filas cortas
+    const size_t chunk_size = std::max<size_t>(parallel_config.chunk_size, 1);
+    const size_t rows_per_task = std::max<size_t>(chunk_size / cols, 1);
+    const size_t num_tasks = (rows + rows_per_task - 1) / rows_per_task;
+    CORDICThreadPool& pool = getThreadPool();
+    
+    if (debug_mode) {
+        std::cout << "\n=== SOFTMAX CORDIC POR FILAS ===" << std::endl;
+        std::cout << "Filas: " << rows << " × " << cols << ", escala: " << scale
+                  << ", máscara: " << (mask ? "sí" : "no") << ", tareas: " << num_tasks
+                  << ", hilos: " << pool.size() << std::endl;
+        if (causal) {
+            std::cout << "Causal: primera posición " << causal->first_position << ", "
+                      << causal->positions << " consultas, ventana " << causal->window
+                      << std::endl;
+        }
+    }
+    
+    pool.parallelFor(num_tasks, [&](size_t task) {
+        const size_t first = task * rows_per_task;
+        const size_t last = std::min(first + rows_per_task, rows);
+        for (size_t r = first; r < last; r++) {
+            const float* row_logits = logits + r * row_stride;
+            float* row_probs = probabilities + r * row_stride;
+            const float* row_mask = mask ? mask + (r % mask_rows) * mask_stride : nullptr;
+            if (!causal) {
+                softmaxRow(row_logits, row_probs, cols, scale, row_mask);
+                continue;
+            }
+            
+            // Tramo visible [begin, end) de la consulta q; fuera, 0 sin calcular
+            const size_t q = causal->first_position + r % causal->positions;
+            const size_t end = std::min(q + 1, cols);
+            const size_t begin = (causal->window != 0 && q + 1 > causal->window)
+                                     ? std::min(q + 1 - causal->window, end) : 0;
+            std::fill(row_probs, row_probs + begin, 0.0f);
+            std::fill(row_probs + end, row_probs + cols, 0.0f);
+            if (begin < end) {
+                softmaxRow(row_logits + begin, row_probs + begin, end - begin, scale,
+                           row_mask ? row_mask + begin : nullptr);
+            }
+        }
+    });
+}
+
+void CORDICSoftmax::softmaxRow(const float* logits, float* probabilities, size_t cols,
+                               float scale, const float* mask) const {
+    // PASO 1: Escala y máscara fusionadas, escritas en la salida junto al máximo
+    float max_logit = -std::numeric_limits<float>::infinity();
+    if (mask) {
+        for (size_t i = 0; i < cols; i++) {
+            float value = logits[i] * scale + mask[i];
+            probabilities[i] = value;
+            max_logit = std::max(max_logit, value);
+        }
+    } else {
+        for (size_t i = 0; i < cols; i++) {
+            float value = logits[i] * scale;
+            probabilities[i] = value;
+            max_logit = std::max(max_logit, value);
+        }
+    }
+    
+    // Fila completamente enmascarada: sin probabilidad que repartir
+    if (max_logit == -std::numeric_limits<float>::infinity()) {
+        std::fill(probabilities, probabilities + cols, 0.0f);
+        return;
+    }
+    
+    // PASO 2: Exponenciales por bloques; -inf (enmascarado) → 0 exacto
+    const size_t block = 256;
+    float sum = 0.0f;
+    CORDICExactAccumulator exact;
+    for (size_t start = 0; start < cols; start += block) {
+        const size_t count = std::min(block, cols - start);
+        float* out = probabilities + start;
+        for (size_t i = 0; i < count; i++) {
+            out[i] -= max_logit;
+        }
+        calculateExpStabilizedBatch(out, out, count);
+        if (sum_mode == CORDICSumMode::EXACT) {
+            exact.add(out, count);
+            continue;
+        }
+        for (size_t i = 0; i < count; i++) {
+            sum += out[i];
+        }
+    }
+    if (sum_mode == CORDICSumMode::EXACT) {
+        sum = exact.toFloat();
+    }
+    
+    // PASO 3: Normalizar
+    const float inv_sum = 1.0f / sum;
+    for (size_t i = 0; i < cols; i++) {
+        probabilities[i] *= inv_sum;
+    }
+}
+
+void CORDICSoftmax::setParallelConfig(const CORDICParallelConfig& config) {
+    if (thread_pool && config.num_threads != parallel_config.num_threads) {
+        thread_pool.reset();
+    }
+    parallel_config = config;
+}
+
+void CORDICSoftmax::setRotationConfig(const CORDICRotationConfig& config) {
+    if (config.mode == CORDICRotationMode::FIXED_SCHEDULE) {
+        // Valida N (lanza std::invalid_argument fuera de rango)
+        CORDICIterator::fixedScheduleLength(config.fixed_last_shift);
+    }
+    rotation_config = config;
+}
+
+CORDICThreadPool& CORDICSoftmax::getThreadPool() {
+    if (!thread_pool) {
+        thread_pool.reset(new CORDICThreadPool(parallel_config.num_threads));
+    }
+    return *thread_pool;
+}
+
 void CORDICSoftmax::calculateExpBatch(const float* inputs, float* outputs, size_t size) {
+    if (!debug_mode) {
+        calculateExpBatchFast(inputs, outputs, size);
+        return;
+    }
+    
     for (size_t i = 0; i < size; i++) {
         outputs[i] = calculateExp(inputs[i]);
     }
 }
 
+void CORDICSoftmax::calculateExpBatchFast(const float* inputs, float* outputs, 
+                                          size_t size) const {
+    if (rotation_config.mode == CORDICRotationMode::FIXED_SCHEDULE) {
+        expBatchFixedSchedule(inputs, outputs, size);
+        return;
+    }
+    if (CORDICSIMD::runKernel(CORDICSIMD::activeKernel(), kernel_tables, inputs, outputs, size)) {
+        return;
+    }
+    calculateExpBatchTiled(inputs, outputs, size);
+}
+
+void CORDICSoftmax::calculateExpBatchTiled(const float* inputs, float* outputs,
+                                           size_t size) const {
+    const int16_t one = FixedPoint16(1.0f).getRaw();
+    CORDICTileState tile;
+    PreprocessResult preps[CORDICTileState::SIZE];
+    for (size_t start = 0; start < size; start += CORDICTileState::SIZE) {
+        tile.count = std::min(CORDICTileState::SIZE, size - start);
+        for (size_t i = 0; i < tile.count; i++) {
+            preps[i] = CORDICPreprocessor::processInput(inputs[start + i], false);
+            tile.X[i] = one;
+            tile.Y[i] = 0;
+            tile.Z[i] = preps[i].mapped_input.getRaw();
+        }
+        
+        iterator.performIterationsTile(tile);
+        
+        for (size_t i = 0; i < tile.count; i++) {
+            const CORDICRawState state(tile.X[i], tile.Y[i], tile.Z[i]);
+            outputs[start + i] = CORDICPostprocessor::computeExponential(state, preps[i]);
+        }
+    }
+}
+
+void CORDICSoftmax::expBatchFixedSchedule(const float* inputs, float* outputs,
+                                          size_t size) const {
+    const int last_shift = rotation_config.fixed_last_shift;
+    const int16_t folded_x0 = CORDICIterator::fixedFoldedInitialX(last_shift);
+    
+    // Preprocesado por elemento, rotaciones sobre bloques SoA sin saltos y
+    // postprocesado plegado (X + Y) × 2^n; admite inputs == outputs
+    const size_t block = 256;
+    int16_t x[block];
+    int16_t y[block];
+    int16_t z[block];
+    PreprocessResult preps[block];
+    for (size_t start = 0; start < size; start += block) {
+        const size_t count = std::min(block, size - start);
+        for (size_t i = 0; i < count; i++) {
+            preps[i] = CORDICPreprocessor::processInput(inputs[start + i], false);
+            x[i] = folded_x0;
+            y[i] = 0;
+            z[i] = preps[i].mapped_input.getRaw();
+        }
+        CORDICIterator::performIterationsFixedBlock(x, y, z, count, last_shift);
+        for (size_t i = 0; i < count; i++) {
+            outputs[start + i] = CORDICPostprocessor::computeExponentialFolded(
+                CORDICRawState(x[i], y[i], z[i]), preps[i]);
+        }
+    }
+}
+
+void CORDICSoftmax::calculateExpStabilizedBatch(const float* inputs, float* outputs,
+                                                size_t size) const {
+    const size_t block = 256;
+    float reduced[block];
+    int exponents[block];
+    for (size_t start = 0; start < size; start += block) {
+        const size_t count = std::min(block, size - start);
+        bool any_reduced = false;
+        for (size_t i = 0; i < count; i++) {
+            float x = inputs[start + i];
+            int n = 0;
+            // El preprocesador satura bajo -15: e^x = 2^n × e^(x - n ln2), x - n ln2 ∈ (-ln2, 0]
+            if (x == -std::numeric_limits<float>::infinity()) {
+                n = MASKED;
+            } else if (x < LOWEST_UNSATURATED_INPUT) {
+                n = static_cast<int>(std::ceil(x * CORDICConfig::INV_LN2));
+                x = static_cast<float>(x - n * CORDICConfig::LN2);
+            }
+            reduced[i] = x;
+            exponents[i] = n;
+            any_reduced = any_reduced || n != 0;
+        }
+        float* out = outputs + start;
+        calculateExpBatchFast(reduced, out, count);
+        if (!any_reduced) {
+            continue;
+        }
+        for (size_t i = 0; i < count; i++) {
+            if (exponents[i] == MASKED) {
+                out[i] = 0.0f;
+            } else if (exponents[i] != 0) {
+                out[i] = CORDICPostprocessor::scaleByPowerOf2(out[i], exponents[i]);
+            }
+        }
+    }
+}
+
+float CORDICSoftmax::exponentiateStabilized(const float* logits, float* outputs, size_t size,
+                                            float max_logit, CORDICExactAccumulator* exact) const {
+    // Por bloques: logits estabilizados escritos en la salida y exponenciados
+    // en el sitio con el kernel por lotes mientras siguen en caché
+    const size_t block = 256;
+    float sum = 0.0f;
+    for (size_t start = 0; start < size; start += block) {
+        const size_t count = std::min(block, size - start);
+        for (size_t i = start; i < start + count; i++) {
+            outputs[i] = logits[i] - max_logit;
+        }
+        calculateExpStabilizedBatch(outputs + start, outputs + start, count);
+        if (exact) {
+            exact->add(outputs + start, count);
+            continue;
+        }
+        for (size_t i = start; i < start + count; i++) {
+            sum += outputs[i];
+        }
+    }
+    return sum;
+}
+
+float CORDICSoftmax::sumExpStabilized(const float* logits, size_t size, float max_logit) const {
+    const size_t block = 256;
+    float stabilized[block];
+    float exps[block];
+    int exponents[block];
+    float sum = 0.0f;
+    CORDICExactAccumulator exact;
+    for (size_t start = 0; start < size; start += block) {
+        const size_t count = std::min(block, size - start);
+        for (size_t i = 0; i < count; i++) {
+            float x = logits[start + i] - max_logit;
+            int n = 0;
+            // El preprocesador satura bajo -15: e^x = 2^n × e^(x - n ln2), x - n ln2 ∈ (-ln2, 0]
+            if (x < LOWEST_UNSATURATED_INPUT && x != -std::numeric_limits<float>::infinity()) {
+                n = static_cast<int>(std::ceil(x * CORDICConfig::INV_LN2));
+                x = static_cast<float>(x - n * CORDICConfig::LN2);
+            }
+            stabilized[i] = x;
+            exponents[i] = n;
+        }
+        calculateExpBatchFast(stabilized, exps, count);
+        if (sum_mode == CORDICSumMode::EXACT) {
+            // El factor 2^n entra en la posición del acumulador, sin redondeo
+            for (size_t i = 0; i < count; i++) {
+                if (stabilized[i] != -std::numeric_limits<float>::infinity()) {
+                    exact.add(exps[i], exponents[i]);
+                }
+            }
+            continue;
+        }
+        for (size_t i = 0; i < count; i++) {
+            if (exponents[i] != 0) {
+                sum += CORDICPostprocessor::scaleByPowerOf2(exps[i], exponents[i]);
+            } else if (stabilized[i] != -std::numeric_limits<float>::infinity()) {
+                sum += exps[i];
+            }
+        }
+    }
+    return sum_mode == CORDICSumMode::EXACT ? exact.toFloat() : sum;
+}
+
 void CORDICSoftmax::printConfiguration() {
     std::cout << "\n=== CONFIGURACIÓN CORDIC SOFTMAX ===" << std::endl;
     std::cout << "Precisión: " << CORDICConfig::WORD_WIDTH << "-bit punto fijo" << std::endl;
     std::cout << "  Bits fraccionales: " << CORDICConfig::FRAC_WIDTH << std::endl;
     std::cout << "  Resolución: " << (1.0 / (1 << CORDICConfig::FRAC_WIDTH)) << std::endl;
     std::cout << "Algoritmo: CORDIC hiperbólico con selección greedy" << std::endl;
+    std::cout << "  Kernel por lotes: " << CORDICSIMD::kernelName(CORDICSIMD::activeKernel()) 
+              << std::endl;
     std::cout << "  Máximo iteraciones: " << CORDICConfig::MAX_ITERATIONS << std::endl;
     std::cout << "  Umbral convergencia: " << CORDICConfig::CONVERGENCE_THRESHOLD << std::endl;
     std::cout << "Rango softmax: [" << CORDICConfig::SOFTMAX_MIN_LOGIT 
@@ -98,12 +704,32 @@ void CORDICSoftmax::printConfiguration() {
 // FUNCIONES C PARA LLAMA.CPP
 //==============================================================================
 
-// Instancia singleton para las funciones C
+// Instancia por hilo para las funciones C sin contexto: las tablas son
+// compartidas, el estado mutable (parciales) es propio de cada hilo. Un solo
+// hilo (pool sin workers): llamadas desde N hilos de ggml no crean N × N hilos
 static CORDICSoftmax& getCORDICInstance() {
-    static CORDICSoftmax instance(false);  // Sin debug para C API
+    thread_local CORDICSoftmax instance = [] {
+        CORDICSoftmax softmax(false);  // Sin debug para C API
+        CORDICParallelConfig config;
+        config.num_threads = 1;
+        softmax.setParallelConfig(config);
+        return softmax;
+    }();
     return instance;
 }
 
+struct llama_cordic_context {
+    CORDICSoftmax softmax;
+    CORDICTopKSampler sampler;
+    CORDICCandidates candidates;
+    
+    explicit llama_cordic_context(size_t n_threads) : softmax(false), sampler(softmax) {
+        CORDICParallelConfig config;
+        config.num_threads = n_threads;
+        softmax.setParallelConfig(config);
+    }
+};
+
 extern "C" {
 
 float llama_cordic_exp(float x) {
@@ -114,4 +740,121 @@ void llama_cordic_softmax(const float* logits, float* probs, size_t vocab_size)
     getCORDICInstance().computeSoftmax(logits, probs, vocab_size);
 }
 
+void llama_cordic_log_softmax(const float* logits, float* log_probs, size_t vocab_size) {
+    getCORDICInstance().computeLogSoftmax(logits, log_probs, vocab_size);
+}
+
+int llama_cordic_softmax_rows(const float* logits, float* probs, size_t rows, size_t cols,
+                              size_t row_stride, float scale, const float* mask,
+                              size_t mask_stride, size_t mask_rows) {
+    try {
+        getCORDICInstance().computeSoftmaxRows(logits, probs, rows, cols, row_stride, scale,
+                                               mask, mask_stride, mask_rows);
+    } catch (const std::invalid_argument&) {
+        return -1;
+    }
+    return 0;
+}
+
+
+llama_cordic_context* llama_cordic_context_create(size_t n_threads) {
+    try {
+        return new llama_cordic_context(n_threads);
+    } catch (...) {
+        return nullptr;
+    }
+}
+
+void llama_cordic_context_free(llama_cordic_context* ctx) {
+    delete ctx;
+}
+
+float llama_cordic_ctx_exp(const llama_cordic_context* ctx, float x) {
+    return ctx->softmax.calculateExpFast(x);
+}
+
+void llama_cordic_ctx_exp_batch(const llama_cordic_context* ctx, const float* inputs,
+                                float* outputs, size_t size) {
+    ctx->softmax.calculateExpBatchFast(inputs, outputs, size);
+}
+
+void llama_cordic_ctx_softmax(llama_cordic_context* ctx, const float* logits, float* probs,
+                              size_t vocab_size) {
+    ctx->softmax.computeSoftmax(logits, probs, vocab_size);
+}
+
+int llama_cordic_ctx_softmax_rows(llama_cordic_context* ctx, const float* logits, float* probs,
+                                  size_t rows, size_t cols, size_t row_stride, float scale,
+                                  const float* mask, size_t mask_stride, size_t mask_rows) {
+    try {
+        ctx->softmax.computeSoftmaxRows(logits, probs, rows, cols, row_stride, scale, mask,
+                                        mask_stride, mask_rows);
+    } catch (const std::invalid_argument&) {
+        return -1;
+    }
+    return 0;
+}
+
+int llama_cordic_ctx_softmax_rows_causal(llama_cordic_context* ctx, const float* logits,
+                                         float* probs, size_t rows, size_t cols,
+                                         size_t row_stride, float scale, size_t first_position,
+                                         size_t positions, size_t window) {
+    try {
+        ctx->softmax.computeSoftmaxRowsCausal(logits, probs, rows, cols, row_stride,
+                                              CORDICCausalMask(first_position, positions, window),
+                                              scale);
+    } catch (const std::invalid_argument&) {
+        return -1;
+    }
+    return 0;
+}
+
+void llama_cordic_ctx_softmax_f16(llama_cordic_context* ctx, const uint16_t* logits,
+                                  float* probs, size_t vocab_size) {
+    ctx->softmax.computeSoftmax(reinterpret_cast<const CORDICFloat16*>(logits), probs,
+                                vocab_size);
+}
+
+void llama_cordic_ctx_softmax_f16_f16(llama_cordic_context* ctx, const uint16_t* logits,
+                                      uint16_t* probs, size_t vocab_size) {
+    ctx->softmax.computeSoftmax(reinterpret_cast<const CORDICFloat16*>(logits),
+                                reinterpret_cast<CORDICFloat16*>(probs), vocab_size);
+}
+
+void llama_cordic_ctx_softmax_bf16(llama_cordic_context* ctx, const uint16_t* logits,
+                                   float* probs, size_t vocab_size) {
+    ctx->softmax.computeSoftmax(reinterpret_cast<const CORDICBFloat16*>(logits), probs,
+                                vocab_size);
+}
+
+void llama_cordic_ctx_softmax_bf16_bf16(llama_cordic_context* ctx, const uint16_t* logits,
+                                        uint16_t* probs, size_t vocab_size) {
+    ctx->softmax.computeSoftmax(reinterpret_cast<const CORDICBFloat16*>(logits),
+                                reinterpret_cast<CORDICBFloat16*>(probs), vocab_size);
+}
+
+float llama_cordic_ctx_log_sum_exp(const llama_cordic_context* ctx, const float* logits,
+                                   size_t size) {
+    return ctx->softmax.computeLogSumExp(logits, size);
+}
+
+void llama_cordic_ctx_log_softmax(const llama_cordic_context* ctx, const float* logits,
+                                  float* log_probs, size_t vocab_size) {
+    ctx->softmax.computeLogSoftmax(logits, log_probs, vocab_size);
+}
+
+size_t llama_cordic_ctx_top_k_top_p(llama_cordic_context* ctx, const float* logits,
+                                    size_t vocab_size, size_t top_k, float top_p,
+                                    int32_t* out_indices, float* out_probs) {
+    if (vocab_size == 0) {
+        return 0;
+    }
+    const size_t count = ctx->sampler.select(logits, vocab_size,
+                                             CORDICSamplingParams(top_k, top_p), ctx->candidates);
+    std::copy(ctx->candidates.indices.begin(), ctx->candidates.indices.end(), out_indices);
+    std::copy(ctx->candidates.probabilities.begin(), ctx->candidates.probabilities.end(),
+              out_probs);
+    return count;
+}
+
 }  // extern "C"
@@ -0,0 +1,222 @@
+/**
+ * @file cordic_stats.cpp
+ * @brief Contadores por hilo y agregación para la API C de estadísticas
+ */
+
+#include "cordic_stats.h"
+#include "cordic_types.h"
+#include <cstring>
+
+#if defined(CORDIC_ENABLE_STATS)
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <vector>
+
+namespace {
+
+// llama_cordic_stats es un array de uint64_t: cada campo es un índice
+constexpr size_t FIELD_COUNT = sizeof(llama_cordic_stats) / sizeof(uint64_t);
+
+constexpr size_t field(size_t offset) {
+    return offset / sizeof(uint64_t);
+}
+
+constexpr size_t ELEMENTS = field(offsetof(llama_cordic_stats, elements));
+constexpr size_t SATURATED = field(offsetof(llama_cordic_stats, saturated));
+constexpr size_t REDUCTION = field(offsetof(llama_cordic_stats, reduction_histogram));
+constexpr size_t ITERATIONS = field(offsetof(llama_cordic_stats, iteration_histogram));
+constexpr size_t NOT_CONVERGED = field(offsetof(llama_cordic_stats, not_converged));
+constexpr size_t SOFTMAX_CALLS = field(offsetof(llama_cordic_stats, softmax_calls));
+constexpr size_t SOFTMAX_NS = field(offsetof(llama_cordic_stats, softmax_ns));
+constexpr size_t LATENCY = field(offsetof(llama_cordic_stats, softmax_latency_histogram));
+
+constexpr int MAX_ITERATIONS = CORDICConfig::MAX_ITERATIONS * 2;
+static_assert(LLAMA_CORDIC_STATS_ITERATION_BUCKETS == MAX_ITERATIONS + 1,
+              "Una cubeta por número de iteraciones 0 .. 2 × MAX_ITERATIONS");
+
+/**
+ * @brief Contadores de un hilo
+ *
+ * Solo el hilo dueño escribe (load + store relajados, sin RMW); el snapshot
+ * los lee desde otros hilos.
+ */
+struct ThreadCounters {
+    std::atomic<uint64_t> values[FIELD_COUNT];
+
+    ThreadCounters() {
+        for (auto& value : values) {
+            value.store(0, std::memory_order_relaxed);
+        }
+    }
+
+    void add(size_t index, uint64_t amount) {
+        values[index].store(values[index].load(std::memory_order_relaxed) + amount,
+                            std::memory_order_relaxed);
+    }
+};
+
+/**
+ * @brief Hilos vivos, totales de hilos terminados y base del último reset
+ *
+ * Los contadores son monotónicos: el reset guarda el total actual como base
+ * en lugar de escribir en contadores de otros hilos.
+ */
+struct Registry {
+    std::mutex mutex;
+    std::vector<const ThreadCounters*> live;
+    uint64_t retired[FIELD_COUNT] = {};
+    uint64_t baseline[FIELD_COUNT] = {};
+
+    void totals(uint64_t* out) const {
+        std::memcpy(out, retired, sizeof(retired));
+        for (const ThreadCounters* counters : live) {
+            for (size_t i = 0; i < FIELD_COUNT; i++) {
+                out[i] += counters->values[i].load(std::memory_order_relaxed);
+            }
+        }
+    }
+};
+
+Registry& registry() {
+    // Sin destructor: hay hilos que pueden terminar después de los estáticos
+    static Registry* instance = new Registry();
+    return *instance;
+}
+
+/**
+ * @brief Alta / baja del hilo en el registro; al terminar suma sus contadores
+ */
+struct ThreadSlot {
+    ThreadCounters counters;
+
+    ThreadSlot() {
+        Registry& reg = registry();
+        std::lock_guard<std::mutex> lock(reg.mutex);
+        reg.live.push_back(&counters);
+    }
+
+    ~ThreadSlot() {
+        Registry& reg = registry();
+        std::lock_guard<std::mutex> lock(reg.mutex);
+        for (size_t i = 0; i < FIELD_COUNT; i++) {
+            reg.retired[i] += counters.values[i].load(std::memory_order_relaxed);
+        }
+        reg.live.erase(std::find(reg.live.begin(), reg.live.end(), &counters));
+    }
+};
+
+ThreadCounters& local() {
+    thread_local ThreadSlot slot;
+    return slot.counters;
+}
+
+inline size_t reductionBucket(int reduction_factor) {
+    const int bucket = reduction_factor - LLAMA_CORDIC_STATS_REDUCTION_MIN;
+    return static_cast<size_t>(
+        std::min(std::max(bucket, 0), LLAMA_CORDIC_STATS_REDUCTION_BUCKETS - 1));
+}
+
+inline size_t iterationBucket(int iterations) {
+    return static_cast<size_t>(std::min(std::max(iterations, 0), MAX_ITERATIONS));
+}
+
+inline size_t latencyBucket(uint64_t nanoseconds) {
+    size_t bucket = 0;
+    while (nanoseconds > 1 && bucket + 1 < LLAMA_CORDIC_STATS_LATENCY_BUCKETS) {
+        nanoseconds >>= 1;
+        bucket++;
+    }
+    return bucket;
+}
+
+}  // namespace
+
+//==============================================================================
+// IMPLEMENTACIÓN CORDICStats
+//==============================================================================
+
+void CORDICStats::recordPreprocess(bool saturated, int reduction_factor) {
+    ThreadCounters& counters = local();
+    counters.add(ELEMENTS, 1);
+    if (saturated) {
+        counters.add(SATURATED, 1);
+    } else {
+        counters.add(REDUCTION + reductionBucket(reduction_factor), 1);
+    }
+}
+
+void CORDICStats::recordIterations(int iterations, bool converged) {
+    ThreadCounters& counters = local();
+    counters.add(ITERATIONS + iterationBucket(iterations), 1);
+    if (!converged) {
+        counters.add(NOT_CONVERGED, 1);
+    }
+}
+
+void CORDICStats::recordSoftmax(uint64_t nanoseconds) {
+    ThreadCounters& counters = local();
+    counters.add(SOFTMAX_CALLS, 1);
+    counters.add(SOFTMAX_NS, nanoseconds);
+    counters.add(LATENCY + latencyBucket(nanoseconds), 1);
+}
+
+void cordicStatsRecordBlock(const float* inputs, const int16_t* iterations,
+                            const int16_t* residuals, const int32_t* reduction, size_t lanes) {
+    ThreadCounters& counters = local();
+    uint64_t saturated = 0;
+    uint64_t not_converged = 0;
+    for (size_t i = 0; i < lanes; i++) {
+        // Mismo criterio que CORDICPreprocessor::validateInput (NaN → saturada)
+        if (!(inputs[i] >= -15.0f && inputs[i] <= 15.0f)) {
+            saturated++;
+        } else {
+            counters.add(REDUCTION + reductionBucket(reduction[i]), 1);
+        }
+        counters.add(ITERATIONS + iterationBucket(iterations[i]), 1);
+        not_converged += (residuals[i] != 0 || iterations[i] >= MAX_ITERATIONS) ? 1 : 0;
+    }
+    counters.add(ELEMENTS, lanes);
+    counters.add(SATURATED, saturated);
+    counters.add(NOT_CONVERGED, not_converged);
+}
+#endif  // CORDIC_ENABLE_STATS
+
+//==============================================================================
+// API C
+//==============================================================================
+
+extern "C" {
+
+int llama_cordic_stats_enabled(void) {
+    return CORDICStats::ENABLED ? 1 : 0;
+}
+
+void llama_cordic_stats_snapshot(llama_cordic_stats* stats) {
+    if (stats == nullptr) {
+        return;
+    }
+    std::memset(stats, 0, sizeof(*stats));
+#if defined(CORDIC_ENABLE_STATS)
+    uint64_t totals[FIELD_COUNT];
+    Registry& reg = registry();
+    {
+        std::lock_guard<std::mutex> lock(reg.mutex);
+        reg.totals(totals);
+        for (size_t i = 0; i < FIELD_COUNT; i++) {
+            totals[i] -= reg.baseline[i];
+        }
+    }
+    std::memcpy(stats, totals, sizeof(totals));
+#endif
+}
+
+void llama_cordic_stats_reset(void) {
+#if defined(CORDIC_ENABLE_STATS)
+    Registry& reg = registry();
+    std::lock_guard<std::mutex> lock(reg.mutex);
+    reg.totals(reg.baseline);
+#endif
+}
+
+}  // extern "C"
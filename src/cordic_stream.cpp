@@ -0,0 +1,306 @@
+/**
+ * @file cordic_stream.cpp
+ * @brief Implementación del softmax por filas sobre ficheros mapeados
+ */
+
+#include "cordic_stream.h"
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace {
+
+constexpr float NEG_INF = -std::numeric_limits<float>::infinity();
+
+size_t pageSize() {
+    static const size_t size = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    return size;
+}
+
+std::runtime_error ioError(const std::string& what, const std::string& path) {
+    return std::runtime_error("CORDICMappedFile: " + what + " '" + path + "': " +
+                              std::strerror(errno));
+}
+
+/**
+ * @brief Descriptor con cierre automático (el mapeo sobrevive al close)
+ */
+struct FileDescriptor {
+    int fd;
+    explicit FileDescriptor(int descriptor) : fd(descriptor) {}
+    ~FileDescriptor() {
+        if (fd >= 0) {
+            close(fd);
+        }
+    }
+};
+
+}  // namespace
+
+//==============================================================================
+// IMPLEMENTACIÓN CORDICMappedFile
+//==============================================================================
+
+CORDICMappedFile::CORDICMappedFile(void* address, size_t length, bool writable)
+    : address(address), length(length), writable(writable) {
+}
+
+CORDICMappedFile::~CORDICMappedFile() {
+    if (address != nullptr) {
+        munmap(address, length);
+    }
+}
+
+CORDICMappedFile::CORDICMappedFile(CORDICMappedFile&& other) noexcept
+    : address(other.address), length(other.length), writable(other.writable) {
+    other.address = nullptr;
+    other.length = 0;
+}
+
+CORDICMappedFile& CORDICMappedFile::operator=(CORDICMappedFile&& other) noexcept {
+    if (this != &other) {
+        if (address != nullptr) {
+            munmap(address, length);
+        }
+        address = other.address;
+        length = other.length;
+        writable = other.writable;
+        other.address = nullptr;
+        other.length = 0;
+    }
+    return *this;
+}
+
+CORDICMappedFile CORDICMappedFile::openRead(const std::string& path) {
+    FileDescriptor file(open(path.c_str(), O_RDONLY));
+    if (file.fd < 0) {
+        throw ioError("no se puede abrir", path);
+    }
+    struct stat info;
+    if (fstat(file.fd, &info) != 0) {
+        throw ioError("no se puede leer el tamaño de", path);
+    }
+    const size_t size = static_cast<size_t>(info.st_size);
+    if (size == 0) {
+        return CORDICMappedFile();   // mmap no admite longitud 0
+    }
+
+    void* address = mmap(nullptr, size, PROT_READ, MAP_SHARED, file.fd, 0);
+    if (address == MAP_FAILED) {
+        throw ioError("no se puede mapear", path);
+    }
+    madvise(address, size, MADV_SEQUENTIAL);
+    return CORDICMappedFile(address, size, false);
+}
+
+CORDICMappedFile CORDICMappedFile::create(const std::string& path, size_t size) {
+    FileDescriptor file(open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644));
+    if (file.fd < 0) {
+        throw ioError("no se puede crear", path);
+    }
+    if (ftruncate(file.fd, static_cast<off_t>(size)) != 0) {
+        throw ioError("no se puede redimensionar", path);
+    }
+    if (size == 0) {
+        return CORDICMappedFile();
+    }
+
+    void* address = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, file.fd, 0);
+    if (address == MAP_FAILED) {
+        throw ioError("no se puede mapear", path);
+    }
+    return CORDICMappedFile(address, size, true);
+}
+
+void CORDICMappedFile::prefetch(size_t offset, size_t bytes) const {
+    if (address == nullptr || offset >= length) {
+        return;
+    }
+    // madvise exige una dirección alineada a página
+    const size_t begin = offset / pageSize() * pageSize();
+    const size_t end = std::min(offset + bytes, length);
+    madvise(static_cast<char*>(address) + begin, end - begin, MADV_WILLNEED);
+}
+
+void CORDICMappedFile::release(size_t offset, size_t bytes) const {
+    if (address == nullptr || writable) {
+        return;
+    }
+    // Solo páginas completas: las de los bordes pueden seguir en uso por el lote vecino
+    const size_t begin = (offset + pageSize() - 1) / pageSize() * pageSize();
+    const size_t end = std::min(offset + bytes, length) / pageSize() * pageSize();
+    if (begin < end) {
+        madvise(static_cast<char*>(address) + begin, end - begin, MADV_DONTNEED);
+    }
+}
+
+//==============================================================================
+// IMPLEMENTACIÓN CORDICLogitStream
+//==============================================================================
+
+double CORDICStreamReport::gigabytesPerSecond() const {
+    return seconds > 0.0 ? static_cast<double>(bytes_read + bytes_written) / seconds / 1e9 : 0.0;
+}
+
+CORDICLogitStream::CORDICLogitStream(const CORDICStreamConfig& config)
+    : config(config), batch_rows(config.rows_per_batch), pool(config.num_threads) {
+    if (config.vocab_size == 0) {
+        throw std::invalid_argument("CORDICLogitStream: vocab_size debe ser > 0");
+    }
+    if (batch_rows == 0) {
+        batch_rows = std::max<size_t>(1, DEFAULT_BATCH_BYTES / (config.vocab_size * sizeof(float)));
+    }
+    engines.reserve(pool.size());
+    for (size_t i = 0; i < pool.size(); i++) {
+        engines.push_back(std::make_unique<CORDICSoftmax>(false));
+    }
+}
+
+void CORDICLogitStream::setSumMode(CORDICSumMode mode) {
+    for (auto& engine : engines) {
+        engine->setSumMode(mode);
+    }
+}
+
+void CORDICLogitStream::runBatches(
+    const float* logits, size_t rows, const CORDICMappedFile* input,
+    const std::function<void(CORDICSoftmax&, size_t, size_t)>& batch) {
+    const size_t num_batches = (rows + batch_rows - 1) / batch_rows;
+    const size_t row_bytes = config.vocab_size * sizeof(float);
+    const size_t batch_bytes = batch_rows * row_bytes;
+    const size_t base = input != nullptr
+        ? static_cast<size_t>(reinterpret_cast<const char*>(logits) -
+                              static_cast<const char*>(input->data()))
+        : 0;
+
+    // Ventana inicial: los lotes en curso más los pedidos por delante
+    const size_t distance = pool.size() + config.prefetch_batches;
+    if (input != nullptr) {
+        input->prefetch(base, std::min(distance, num_batches) * batch_bytes);
+    }
+
+    // Una tarea por hilo: cada una usa su motor y toma lotes en orden creciente
+    std::atomic<size_t> next_batch(0);
+    pool.parallelFor(engines.size(), [&](size_t slot) {
+        CORDICSoftmax& engine = *engines[slot];
+        for (size_t b = next_batch.fetch_add(1, std::memory_order_relaxed); b < num_batches;
+             b = next_batch.fetch_add(1, std::memory_order_relaxed)) {
+            const size_t first = b * batch_rows;
+            const size_t count = std::min(batch_rows, rows - first);
+            if (input != nullptr) {
+                if (b + distance < num_batches) {
+                    input->prefetch(base + (b + distance) * batch_bytes, batch_bytes);
+                }
+                batch(engine, first, count);
+                input->release(base + first * row_bytes, count * row_bytes);
+            } else {
+                batch(engine, first, count);
+            }
+        }
+    });
+}
+
+CORDICStreamReport CORDICLogitStream::computeProbabilities(const float* logits,
+                                                           float* probabilities, size_t rows) {
+    return this->probabilities(logits, probabilities, rows, nullptr);
+}
+
+CORDICStreamReport CORDICLogitStream::computeTargetLogProbs(const float* logits,
+                                                            const int32_t* targets,
+                                                            float* log_probs, size_t rows) {
+    return targetLogProbs(logits, targets, log_probs, rows, nullptr);
+}
+
+CORDICStreamReport CORDICLogitStream::probabilities(const float* logits, float* probabilities,
+                                                    size_t rows, const CORDICMappedFile* input) {
+    const size_t vocab = config.vocab_size;
+    const auto start = std::chrono::steady_clock::now();
+
+    runBatches(logits, rows, input, [&](CORDICSoftmax& engine, size_t first, size_t count) {
+        for (size_t r = first; r < first + count; r++) {
+            engine.computeSoftmax(logits + r * vocab, probabilities + r * vocab, vocab);
+        }
+    });
+
+    CORDICStreamReport report;
+    report.rows = rows;
+    report.bytes_read = static_cast<uint64_t>(rows) * vocab * sizeof(float);
+    report.bytes_written = report.bytes_read;
+    report.seconds =
+        std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    return report;
+}
+
+CORDICStreamReport CORDICLogitStream::targetLogProbs(const float* logits, const int32_t* targets,
+                                                     float* log_probs, size_t rows,
+                                                     const CORDICMappedFile* input) {
+    const size_t vocab = config.vocab_size;
+    // Validar antes de escribir nada en la salida
+    for (size_t r = 0; r < rows; r++) {
+        if (targets[r] < 0 || static_cast<size_t>(targets[r]) >= vocab) {
+            throw std::invalid_argument("CORDICLogitStream: objetivo fuera de [0, vocab) en la fila " +
+                                        std::to_string(r));
+        }
+    }
+    const auto start = std::chrono::steady_clock::now();
+
+    runBatches(logits, rows, input, [&](CORDICSoftmax& engine, size_t first, size_t count) {
+        for (size_t r = first; r < first + count; r++) {
+            const float* row = logits + r * vocab;
+            const float log_sum = engine.computeLogSumExp(row, vocab);
+            // Fila toda -inf: -inf como computeLogSoftmax (no -inf - -inf = NaN)
+            log_probs[r] = log_sum == NEG_INF ? NEG_INF : row[targets[r]] - log_sum;
+        }
+    });
+
+    CORDICStreamReport report;
+    report.rows = rows;
+    report.bytes_read = static_cast<uint64_t>(rows) * (vocab * sizeof(float) + sizeof(int32_t));
+    report.bytes_written = static_cast<uint64_t>(rows) * sizeof(float);
+    report.seconds =
+        std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    // En orden de fila: el total no depende del reparto entre hilos
+    for (size_t r = 0; r < rows; r++) {
+        report.nll_sum -= static_cast<double>(log_probs[r]);
+    }
+    return report;
+}
+
+CORDICStreamReport CORDICLogitStream::processFile(const std::string& logits_path,
+                                                  const std::string& output_path,
+                                                  CORDICStreamOutput output,
+                                                  const std::string& targets_path) {
+    const size_t row_bytes = config.vocab_size * sizeof(float);
+    CORDICMappedFile input = CORDICMappedFile::openRead(logits_path);
+    if (input.size() % row_bytes != 0) {
+        throw std::invalid_argument("CORDICLogitStream: el tamaño de '" + logits_path +
+                                    "' no es múltiplo de vocab_size × 4 bytes");
+    }
+    const size_t rows = input.size() / row_bytes;
+    const float* logits = static_cast<const float*>(input.data());
+
+    if (output == CORDICStreamOutput::PROBABILITIES) {
+        CORDICMappedFile result = CORDICMappedFile::create(output_path, input.size());
+        return probabilities(logits, static_cast<float*>(result.data()), rows, &input);
+    }
+
+    if (targets_path.empty()) {
+        throw std::invalid_argument("CORDICLogitStream: TARGET_LOG_PROB requiere targets_path");
+    }
+    CORDICMappedFile targets = CORDICMappedFile::openRead(targets_path);
+    if (targets.size() != rows * sizeof(int32_t)) {
+        throw std::invalid_argument("CORDICLogitStream: '" + targets_path +
+                                    "' debe tener un int32 por fila de logits");
+    }
+    CORDICMappedFile result = CORDICMappedFile::create(output_path, rows * sizeof(float));
+    return targetLogProbs(logits, static_cast<const int32_t*>(targets.data()),
+                          static_cast<float*>(result.data()), rows, &input);
+}
@@ -0,0 +1,119 @@
+/**
+ * @file cordic_thread_pool.cpp
+ * @brief Implementación del pool persistente de hilos
+ */
+
+#include "cordic_thread_pool.h"
+
+CORDICThreadPool::CORDICThreadPool(size_t num_threads)
+    : current_task(nullptr), task_count(0), next_task(0), pending_workers(0),
+      generation(0), stopping(false) {
+    if (num_threads == 0) {
+        num_threads = defaultThreadCount();
+    }
+
+    // El llamador cuenta como un hilo más
+    for (size_t i = 1; i < num_threads; i++) {
+        workers.emplace_back(&CORDICThreadPool::workerLoop, this);
+    }
+}
+
+CORDICThreadPool::~CORDICThreadPool() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    work_cv.notify_all();
+
+    for (auto& worker : workers) {
+        worker.join();
+    }
+}
+
+size_t CORDICThreadPool::defaultThreadCount() {
+    unsigned int hw = std::thread::hardware_concurrency();
+    return hw > 0 ? hw : 1;
+}
+
+void CORDICThreadPool::parallelFor(size_t num_tasks, const std::function<void(size_t)>& task) {
+    if (num_tasks == 0) {
+        return;
+    }
+
+    // Sin workers o una sola tarea: ejecutar en el hilo llamador
+    if (workers.empty() || num_tasks == 1) {
+        for (size_t i = 0; i < num_tasks; i++) {
+            task(i);
+        }
+        return;
+    }
+
+    std::lock_guard<std::mutex> dispatch_lock(dispatch_mutex);
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        current_task = &task;
+        task_count = num_tasks;
+        next_task.store(0, std::memory_order_relaxed);
+        pending_workers = workers.size();
+        first_error = nullptr;
+        generation++;
+    }
+    work_cv.notify_all();
+
+    runTasks();
+
+    std::exception_ptr error;
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        done_cv.wait(lock, [this] { return pending_workers == 0; });
+        current_task = nullptr;
+        error = first_error;
+    }
+
+    if (error) {
+        std::rethrow_exception(error);
+    }
+}
+
+void CORDICThreadPool::workerLoop() {
+    uint64_t seen_generation = 0;
+
+    for (;;) {
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            work_cv.wait(lock, [&] { return stopping || generation != seen_generation; });
+            if (stopping) {
+                return;
+            }
+            seen_generation = generation;
+        }
+
+        runTasks();
+
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (--pending_workers == 0) {
+                done_cv.notify_one();
+            }
+        }
+    }
+}
+
+void CORDICThreadPool::runTasks() {
+    for (;;) {
+        size_t index = next_task.fetch_add(1, std::memory_order_relaxed);
+        if (index >= task_count) {
+            return;
+        }
+
+        try {
+            (*current_task)(index);
+        } catch (...) {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (!first_error) {
+                first_error = std::current_exception();
+            }
+        }
+    }
+}
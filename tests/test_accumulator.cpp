@@ -0,0 +1,276 @@
+#include "cordic_accumulator.h"
+#include "cordic_softmax.h"
+#include "test_logits.h"
+#include <iostream>
+#include <iomanip>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+//==============================================================================
+// UTILIDADES
+//==============================================================================
+
+/**
+ * @brief Softmax de referencia en double con las mismas exponenciales CORDIC
+ *
+ * Aísla el error de la suma / normalización del error de e^x.
+ */
+std::vector<double> referenceFromExps(const std::vector<float>& exps) {
+    double sum = 0.0;
+    for (float e : exps) {
+        sum += e;
+    }
+    std::vector<double> probs(exps.size());
+    for (size_t i = 0; i < exps.size(); i++) {
+        probs[i] = exps[i] / sum;
+    }
+    return probs;
+}
+
+double meanSquaredError(const std::vector<float>& probs, const std::vector<double>& expected) {
+    double mse = 0.0;
+    for (size_t i = 0; i < probs.size(); i++) {
+        const double diff = probs[i] - expected[i];
+        mse += diff * diff;
+    }
+    return mse / probs.size();
+}
+
+//==============================================================================
+// TESTS
+//==============================================================================
+
+void testExactSums() {
+    std::cout << "\n========== TEST: SUMA EXACTA Y REDONDEO ÚNICO ==========" << std::endl;
+
+    // 1 + 1024 × 2^-24: en float cada suma redondea a 1; exacto 1 + 2^-14
+    CORDICExactAccumulator small_terms;
+    float float_sum = 1.0f;
+    small_terms.add(1.0f);
+    for (int i = 0; i < 1024; i++) {
+        small_terms.add(std::ldexp(1.0f, -24));
+        float_sum += std::ldexp(1.0f, -24);
+    }
+    const bool absorbed_ok = small_terms.toFloat() == 1.0f + std::ldexp(1.0f, -14) &&
+                             float_sum == 1.0f;
+    std::cout << "1 + 1024 × 2^-24 = 1 + 2^-14 (float: " << float_sum << "): "
+              << (absorbed_ok ? "✓" : "✗") << std::endl;
+
+    // Empates a par y bit sticky
+    CORDICExactAccumulator tie;
+    tie.add(1.0f);
+    tie.add(std::ldexp(1.0f, -24));
+    CORDICExactAccumulator above_tie = tie;
+    above_tie.add(std::ldexp(1.0f, -60));
+    const bool ties_ok = tie.toFloat() == 1.0f &&
+                         above_tie.toFloat() == 1.0f + std::ldexp(1.0f, -23);
+    std::cout << "Empate → par, empate + 2^-60 → arriba: " << (ties_ok ? "✓" : "✗") << std::endl;
+
+    // Subnormales y términos escalados por 2^n por debajo del rango float
+    CORDICExactAccumulator subnormal;
+    subnormal.add(std::numeric_limits<float>::denorm_min());
+    subnormal.add(std::numeric_limits<float>::denorm_min());
+    CORDICExactAccumulator scaled;
+    for (int i = 0; i < (1 << 20); i++) {
+        scaled.add(1.0f, -160);
+    }
+    const bool tiny_ok = subnormal.toFloat() == std::ldexp(1.0f, -148) &&
+                         scaled.toFloat() == std::ldexp(1.0f, -140);
+    std::cout << "2 × 2^-149 = 2^-148, 2^20 × (1, n = -160) = 2^-140: "
+              << (tiny_ok ? "✓" : "✗") << std::endl;
+
+    // Contra double exacto: términos múltiplos de 2^-34 con suma < 2^11
+    std::mt19937 gen(5);
+    std::uniform_real_distribution<float> dist(0.0f, 1.0f);
+    bool rounding_ok = true;
+    for (int trial = 0; trial < 200; trial++) {
+        CORDICExactAccumulator acc;
+        double exact = 0.0;
+        for (int i = 0; i < 1000; i++) {
+            const float v = std::ldexp(std::round(std::ldexp(dist(gen), 24)), -34 + trial % 10);
+            acc.add(v);
+            exact += v;
+        }
+        rounding_ok = rounding_ok && acc.toFloat() == static_cast<float>(exact);
+    }
+    std::cout << "200 sumas = float(suma exacta en double): " << (rounding_ok ? "✓" : "✗")
+              << std::endl;
+
+    if (!absorbed_ok || !ties_ok || !tiny_ok || !rounding_ok) {
+        throw std::runtime_error("CORDICExactAccumulator no suma exacto");
+    }
+}
+
+void testOrderIndependence() {
+    std::cout << "\n========== TEST: INDEPENDENCIA DEL ORDEN ==========" << std::endl;
+
+    std::vector<float> values = randomLogits(100000, 11);
+    for (float& v : values) {
+        v = std::exp(-std::abs(v));
+    }
+
+    CORDICExactAccumulator forward;
+    forward.add(values.data(), values.size());
+
+    std::vector<float> shuffled = values;
+    std::shuffle(shuffled.begin(), shuffled.end(), std::mt19937(3));
+    CORDICExactAccumulator permuted;
+    permuted.add(shuffled.data(), shuffled.size());
+
+    // Chunks irregulares fusionados en orden inverso
+    std::vector<CORDICExactAccumulator> chunks;
+    for (size_t start = 0; start < values.size(); start += 777) {
+        chunks.emplace_back();
+        chunks.back().add(values.data() + start, std::min<size_t>(777, values.size() - start));
+    }
+    CORDICExactAccumulator merged;
+    for (auto it = chunks.rbegin(); it != chunks.rend(); ++it) {
+        merged.merge(*it);
+    }
+
+    float float_forward = 0.0f;
+    float float_permuted = 0.0f;
+    for (size_t i = 0; i < values.size(); i++) {
+        float_forward += values[i];
+        float_permuted += shuffled[i];
+    }
+
+    const bool ok = forward == permuted && forward == merged &&
+                    forward.toFloat() == merged.toFloat();
+    std::cout << "Orden directo / permutado / chunks: " << std::setprecision(9)
+              << forward.toFloat() << " / " << permuted.toFloat() << " / " << merged.toFloat()
+              << " " << (ok ? "✓" : "✗") << std::endl;
+    std::cout << "(suma float: " << float_forward << " / " << float_permuted << ")"
+              << std::endl;
+
+    if (!ok) {
+        throw std::runtime_error("La suma exacta depende del orden");
+    }
+}
+
+void testSoftmaxSumModes() {
+    std::cout << "\n========== TEST: SOFTMAX CON SUMA EXACTA ==========" << std::endl;
+
+    CORDICSoftmax float_mode(false);
+    CORDICSoftmax exact_mode(false);
+    exact_mode.setSumMode(CORDICSumMode::EXACT);
+
+    bool all_ok = true;
+    std::cout << std::setw(8) << "n" << std::setw(16) << "MSE float" << std::setw(16)
+              << "MSE exacta" << std::setw(14) << "|Σp - 1| f" << std::setw(14) << "|Σp - 1| e"
+              << std::endl;
+    for (size_t size : {size_t(10000), size_t(100000), size_t(256000)}) {
+        // σ = 1.5: toda la fila dentro del rango práctico del preprocesador
+        std::vector<float> logits = randomLogits(size, static_cast<unsigned>(size), 1.5f);
+        const float max_logit = *std::max_element(logits.begin(), logits.end());
+        std::vector<float> exps(size);
+        for (size_t i = 0; i < size; i++) {
+            exps[i] = logits[i] - max_logit;
+        }
+        exact_mode.calculateExpBatchFast(exps.data(), exps.data(), size);
+        std::vector<double> expected = referenceFromExps(exps);
+
+        std::vector<float> float_probs(size);
+        std::vector<float> exact_probs(size);
+        float_mode.computeSoftmax(logits.data(), float_probs.data(), size);
+        exact_mode.computeSoftmax(logits.data(), exact_probs.data(), size);
+
+        double float_total = 0.0;
+        double exact_total = 0.0;
+        for (size_t i = 0; i < size; i++) {
+            float_total += float_probs[i];
+            exact_total += exact_probs[i];
+        }
+        const double float_mse = meanSquaredError(float_probs, expected);
+        const double exact_mse = meanSquaredError(exact_probs, expected);
+        std::cout << std::setw(8) << size << std::scientific << std::setprecision(3)
+                  << std::setw(16) << float_mse << std::setw(16) << exact_mse << std::setw(14)
+                  << std::abs(float_total - 1.0) << std::setw(14) << std::abs(exact_total - 1.0)
+                  << std::endl;
+        all_ok = all_ok && exact_mse <= float_mse;
+
+        // Paralelo: idéntico a la versión secuencial con cualquier chunk e hilos
+        for (size_t chunk : {size_t(1000), size_t(4096), size_t(65536)}) {
+            for (size_t threads : {size_t(1), size_t(3)}) {
+                exact_mode.setParallelConfig(CORDICParallelConfig(threads, chunk));
+                std::vector<float> parallel(size);
+                exact_mode.computeSoftmaxParallel(logits.data(), parallel.data(), size);
+                all_ok = all_ok && parallel == exact_probs;
+            }
+        }
+    }
+    std::cout << std::defaultfloat;
+    std::cout << "MSE exacta ≤ float y paralelo idéntico bit a bit (chunk 1000 / 4096 / 65536, "
+              << "1 / 3 hilos): " << (all_ok ? "✓" : "✗") << std::endl;
+
+    if (!all_ok) {
+        throw std::runtime_error("Softmax con suma exacta incorrecto");
+    }
+}
+
+void testErrors() {
+    std::cout << "\n========== TEST: TÉRMINOS INVÁLIDOS ==========" << std::endl;
+
+    CORDICExactAccumulator acc;
+    bool negative_caught = false;
+    try {
+        acc.add(-1.0f);
+    } catch (const std::invalid_argument&) {
+        negative_caught = true;
+    }
+    bool overflow_caught = false;
+    try {
+        acc.add(1.0f, 128);
+    } catch (const std::overflow_error&) {
+        overflow_caught = true;
+    }
+    acc.add(-0.0f);
+    acc.add(std::numeric_limits<float>::max());
+    const bool max_ok = acc.toFloat() == std::numeric_limits<float>::max();
+    acc.add(std::numeric_limits<float>::max());
+    const bool overflow_inf = std::isinf(acc.toFloat());
+    acc.add(std::numeric_limits<float>::quiet_NaN());
+    const bool nan_ok = std::isnan(acc.toFloat());
+
+    std::cout << "Término negativo → std::invalid_argument: " << (negative_caught ? "✓" : "✗")
+              << std::endl;
+    std::cout << "Término ≥ 2^128 → std::overflow_error: " << (overflow_caught ? "✓" : "✗")
+              << std::endl;
+    std::cout << "FLT_MAX exacto, 2 × FLT_MAX → inf, NaN se propaga: "
+              << (max_ok && overflow_inf && nan_ok ? "✓" : "✗") << std::endl;
+
+    if (!negative_caught || !overflow_caught || !max_ok || !overflow_inf || !nan_ok) {
+        throw std::runtime_error("CORDICExactAccumulator no valida sus términos");
+    }
+}
+
+//==============================================================================
+// MAIN
+//==============================================================================
+
+int main() {
+    std::cout << "========================================" << std::endl;
+    std::cout << "TEST: acumulador exacto" << std::endl;
+    std::cout << "========================================" << std::endl;
+
+    try {
+        testExactSums();
+        testOrderIndependence();
+        testSoftmaxSumModes();
+        testErrors();
+
+        std::cout << "\n========================================" << std::endl;
+        std::cout << "✅ TODOS LOS TESTS COMPLETADOS" << std::endl;
+        std::cout << "========================================" << std::endl;
+
+        return 0;
+
+    } catch (const std::exception& e) {
+        std::cerr << "\n❌ ERROR: " << e.what() << std::endl;
+        return 1;
+    }
+}
@@ -0,0 +1,299 @@
+#include "cordic_attention.h"
+#include <iostream>
+#include <iomanip>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+//==============================================================================
+// UTILIDADES
+//==============================================================================
+
+std::vector<float> randomMatrix(size_t size, unsigned seed, float stddev = 1.0f) {
+    std::mt19937 gen(seed);
+    std::normal_distribution<float> dist(0.0f, stddev);
+    std::vector<float> values(size);
+    for (float& v : values) {
+        v = dist(gen);
+    }
+    return values;
+}
+
+/**
+ * Referencia en double: o = Σ softmax(scale × q·k_j) × v_j sobre [begin, end)
+ */
+std::vector<double> referenceAttention(const float* query, const float* keys, const float* values,
+                                       size_t dim, size_t begin, size_t end, float scale) {
+    std::vector<double> scores(end - begin);
+    double max_score = -std::numeric_limits<double>::infinity();
+    for (size_t j = begin; j < end; j++) {
+        double dot = 0.0;
+        for (size_t d = 0; d < dim; d++) {
+            dot += static_cast<double>(query[d]) * keys[j * dim + d];
+        }
+        scores[j - begin] = scale * dot;
+        max_score = std::max(max_score, scores[j - begin]);
+    }
+    std::vector<double> output(dim, 0.0);
+    double sum = 0.0;
+    for (size_t j = begin; j < end; j++) {
+        const double p = std::exp(scores[j - begin] - max_score);
+        sum += p;
+        for (size_t d = 0; d < dim; d++) {
+            output[d] += p * values[j * dim + d];
+        }
+    }
+    for (double& v : output) {
+        v = sum > 0.0 ? v / sum : 0.0;
+    }
+    return output;
+}
+
+/**
+ * Error máximo relativo a max|o_ref| (las componentes de o pueden anularse)
+ */
+double maxError(const float* output, const std::vector<double>& expected) {
+    double scale = 0.0;
+    double error = 0.0;
+    for (size_t d = 0; d < expected.size(); d++) {
+        scale = std::max(scale, std::abs(expected[d]));
+        error = std::max(error, std::abs(output[d] - expected[d]));
+    }
+    return scale > 0.0 ? error / scale : error;
+}
+
+//==============================================================================
+// TESTS
+//==============================================================================
+
+void testAgainstReference() {
+    std::cout << "\n========== TEST: FLASH vs REFERENCIA DOUBLE ==========" << std::endl;
+
+    CORDICSoftmax cordic(false);
+    const size_t dim = 64;
+    const float scale = 1.0f / std::sqrt(static_cast<float>(dim));
+
+    bool all_ok = true;
+    for (size_t kv_len : {size_t(1), size_t(100), size_t(1000), size_t(4099)}) {
+        // s ~ N(0, 1): s - max dentro del rango práctico [-15, 0] de la fila
+        // materializada (la ruta por bloques no lo necesita, ver test siguiente)
+        std::vector<float> query = randomMatrix(dim, 1);
+        std::vector<float> keys = randomMatrix(kv_len * dim, 2);
+        std::vector<float> values = randomMatrix(kv_len * dim, 3);
+        std::vector<double> expected = referenceAttention(query.data(), keys.data(),
+                                                          values.data(), dim, 0, kv_len, scale);
+
+        for (size_t block_size : {size_t(1), size_t(7), size_t(256)}) {
+            CORDICFlashAttention attention(cordic, block_size);
+            std::vector<float> output(dim);
+            attention.computeQuery(query.data(), keys.data(), values.data(),
+                                   CORDICAttentionShape(dim, kv_len), scale, output.data());
+            const double error = maxError(output.data(), expected);
+            const bool ok = error < 5e-3;
+            all_ok = all_ok && ok;
+            std::cout << "n_kv=" << std::setw(5) << kv_len << " bloque=" << std::setw(3)
+                      << block_size << ": error " << std::scientific << std::setprecision(2)
+                      << error << " " << (ok ? "✓" : "✗") << std::endl;
+        }
+
+        CORDICFlashAttention attention(cordic);
+        std::vector<float> probabilities(kv_len);
+        std::vector<float> materialized(dim);
+        attention.computeQueryMaterialized(query.data(), keys.data(), values.data(),
+                                           CORDICAttentionShape(dim, kv_len), scale,
+                                           probabilities.data(), materialized.data());
+        const double error = maxError(materialized.data(), expected);
+        const bool ok = error < 5e-3;
+        all_ok = all_ok && ok;
+        std::cout << "n_kv=" << std::setw(5) << kv_len << " materializada: error "
+                  << std::scientific << std::setprecision(2) << error << " "
+                  << (ok ? "✓" : "✗") << std::endl;
+    }
+
+    if (!all_ok) {
+        throw std::runtime_error("Atención por bloques fuera de tolerancia");
+    }
+}
+
+void testStridesAndScoreSpread() {
+    std::cout << "\n========== TEST: STRIDES Y PUNTUACIONES DISPERSAS ==========" << std::endl;
+
+    CORDICSoftmax cordic(false);
+    CORDICFlashAttention attention(cordic, 16);
+    const size_t dim = 8;
+    const size_t kv_len = 300;
+    const size_t stride = 12;
+
+    // Filas intercaladas [K | basura] con stride 12: solo se leen 8 elementos
+    std::vector<float> query = randomMatrix(dim, 4);
+    std::vector<float> dense_keys = randomMatrix(kv_len * dim, 5);
+    std::vector<float> values = randomMatrix(kv_len * dim, 6);
+    std::vector<float> strided_keys(kv_len * stride, std::numeric_limits<float>::quiet_NaN());
+    for (size_t j = 0; j < kv_len; j++) {
+        std::copy(dense_keys.begin() + j * dim, dense_keys.begin() + (j + 1) * dim,
+                  strided_keys.begin() + j * stride);
+    }
+
+    std::vector<float> dense(dim);
+    std::vector<float> strided(dim);
+    attention.computeQuery(query.data(), dense_keys.data(), values.data(),
+                           CORDICAttentionShape(dim, kv_len), 1.0f, dense.data());
+    attention.computeQuery(query.data(), strided_keys.data(), values.data(),
+                           CORDICAttentionShape(dim, kv_len, stride), 1.0f, strided.data());
+    const bool strides_ok = std::equal(dense.begin(), dense.end(), strided.begin());
+    std::cout << "key_stride=12 idéntico a filas densas: " << (strides_ok ? "✓" : "✗")
+              << std::endl;
+
+    // scale = 4: puntuaciones repartidas en decenas de unidades, con el
+    // referencia que crece entre bloques y s - R < -15
+    const float scale = 4.0f;
+    std::vector<double> expected = referenceAttention(query.data(), dense_keys.data(),
+                                                      values.data(), dim, 0, kv_len, scale);
+    attention.computeQuery(query.data(), dense_keys.data(), values.data(),
+                           CORDICAttentionShape(dim, kv_len), scale, dense.data());
+    const double error = maxError(dense.data(), expected);
+    const bool spread_ok = error < 5e-3;
+    std::cout << "scale=4 (s - R ≪ -15): error " << std::scientific << std::setprecision(2)
+              << error << " " << (spread_ok ? "✓" : "✗") << std::endl;
+
+    if (!strides_ok || !spread_ok) {
+        throw std::runtime_error("Strides o reescalado de referencia incorrectos");
+    }
+}
+
+void testCausalQueries() {
+    std::cout << "\n========== TEST: CONSULTAS CON MÁSCARA CAUSAL ==========" << std::endl;
+
+    CORDICSoftmax cordic(false);
+    CORDICFlashAttention attention(cordic, 32);
+    const size_t dim = 16;
+    const size_t kv_len = 200;
+    const size_t num_queries = 6;
+    const float scale = 0.25f;
+
+    std::vector<float> queries = randomMatrix(num_queries * dim, 7, 2.0f);
+    std::vector<float> keys = randomMatrix(kv_len * dim, 8, 2.0f);
+    std::vector<float> values = randomMatrix(kv_len * dim, 9);
+    std::vector<float> outputs(num_queries * dim);
+
+    bool all_ok = true;
+    for (size_t window : {size_t(0), size_t(50)}) {
+        // Dos cabezas de 3 consultas en las posiciones 60..62, en una llamada
+        CORDICCausalMask rows(60, 3, window);
+        std::vector<float> batched(num_queries * dim);
+        attention.computeQueries(queries.data(), num_queries, 0, keys.data(), values.data(),
+                                 CORDICAttentionShape(dim, kv_len), scale, batched.data(), 0,
+                                 &rows);
+
+        // Misma fila consulta a consulta: resultado idéntico
+        for (size_t i = 0; i < num_queries; i++) {
+            CORDICCausalMask single(60 + i % 3, 1, window);
+            attention.computeQueries(queries.data() + i * dim, 1, 0, keys.data(), values.data(),
+                                     CORDICAttentionShape(dim, kv_len), scale,
+                                     outputs.data() + i * dim, 0, &single);
+        }
+        const bool identical = std::equal(outputs.begin(), outputs.end(), batched.begin());
+        all_ok = all_ok && identical;
+
+        double worst = 0.0;
+        for (size_t i = 0; i < num_queries; i++) {
+            const size_t q = 60 + i % 3;
+            const size_t end = std::min(q + 1, kv_len);
+            const size_t begin = (window != 0 && q + 1 > window) ? q + 1 - window : 0;
+            std::vector<double> expected = referenceAttention(queries.data() + i * dim,
+                                                              keys.data(), values.data(), dim,
+                                                              begin, end, scale);
+            worst = std::max(worst, maxError(batched.data() + i * dim, expected));
+        }
+        const bool ok = worst < 5e-3;
+        all_ok = all_ok && ok;
+        std::cout << "ventana=" << std::setw(3) << window << ": error máximo "
+                  << std::scientific << std::setprecision(2) << worst << " "
+                  << (ok ? "✓" : "✗") << ", por consulta idéntico "
+                  << (identical ? "✓" : "✗") << std::endl;
+    }
+
+    // Sin claves visibles (n_kv = 0) la salida es cero
+    std::vector<float> empty(dim, 1.0f);
+    attention.computeQuery(queries.data(), keys.data(), values.data(),
+                           CORDICAttentionShape(dim, 0), scale, empty.data());
+    const bool empty_ok = std::all_of(empty.begin(), empty.end(),
+                                      [](float v) { return v == 0.0f; });
+    std::cout << "n_kv = 0 → ceros: " << (empty_ok ? "✓" : "✗") << std::endl;
+
+    if (!all_ok || !empty_ok) {
+        throw std::runtime_error("Atención causal por bloques incorrecta");
+    }
+}
+
+void testErrors() {
+    std::cout << "\n========== TEST: ARGUMENTOS INVÁLIDOS ==========" << std::endl;
+
+    CORDICSoftmax cordic(false);
+    std::vector<float> data(64, 0.0f);
+    std::vector<float> output(8);
+
+    auto throwsInvalid = [](auto&& func) {
+        try {
+            func();
+        } catch (const std::invalid_argument&) {
+            return true;
+        }
+        return false;
+    };
+
+    const bool block_ok = throwsInvalid([&] { CORDICFlashAttention attention(cordic, 0); });
+    CORDICFlashAttention attention(cordic);
+    const bool dim_ok = throwsInvalid([&] {
+        attention.computeQuery(data.data(), data.data(), data.data(),
+                               CORDICAttentionShape(0, 4), 1.0f, output.data());
+    });
+    const bool stride_ok = throwsInvalid([&] {
+        attention.computeQuery(data.data(), data.data(), data.data(),
+                               CORDICAttentionShape(8, 4, 4), 1.0f, output.data());
+    });
+    const bool positions_ok = throwsInvalid([&] {
+        CORDICCausalMask causal(0, 0);
+        attention.computeQueries(data.data(), 1, 0, data.data(), data.data(),
+                                 CORDICAttentionShape(8, 4), 1.0f, output.data(), 0, &causal);
+    });
+
+    std::cout << "block_size = 0: " << (block_ok ? "✓" : "✗") << std::endl;
+    std::cout << "head_dim = 0: " << (dim_ok ? "✓" : "✗") << std::endl;
+    std::cout << "key_stride < head_dim: " << (stride_ok ? "✓" : "✗") << std::endl;
+    std::cout << "positions = 0: " << (positions_ok ? "✓" : "✗") << std::endl;
+
+    if (!block_ok || !dim_ok || !stride_ok || !positions_ok) {
+        throw std::runtime_error("CORDICFlashAttention no valida sus argumentos");
+    }
+}
+
+//==============================================================================
+// MAIN
+//==============================================================================
+
+int main() {
+    std::cout << "========================================" << std::endl;
+    std::cout << "TEST: atención por bloques (softmax·V)" << std::endl;
+    std::cout << "========================================" << std::endl;
+
+    try {
+        testAgainstReference();
+        testStridesAndScoreSpread();
+        testCausalQueries();
+        testErrors();
+
+        std::cout << "\n========================================" << std::endl;
+        std::cout << "✅ TODOS LOS TESTS COMPLETADOS" << std::endl;
+        std::cout << "========================================" << std::endl;
+
+        return 0;
+
+    } catch (const std::exception& e) {
+        std::cerr << "\n❌ ERROR: " << e.what() << std::endl;
+        return 1;
+    }
+}
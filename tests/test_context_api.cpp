@@ -0,0 +1,190 @@
+#include "cordic_softmax.h"
+#include "cordic_iterator.h"
+#include "test_logits.h"
+#include <iostream>
+#include <iomanip>
+#include <atomic>
+#include <cmath>
+#include <cstring>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+//==============================================================================
+// UTILIDADES
+//==============================================================================
+
+/**
+ * Ejecuta body(t) en num_threads hilos a la vez y devuelve si todos acertaron
+ */
+template <typename Body>
+bool runConcurrently(size_t num_threads, Body body) {
+    std::atomic<bool> all_ok(true);
+    std::atomic<size_t> ready(0);
+    std::vector<std::thread> threads;
+    for (size_t t = 0; t < num_threads; t++) {
+        threads.emplace_back([&, t] {
+            // Arranque simultáneo para maximizar el solapamiento
+            ready.fetch_add(1);
+            while (ready.load() < num_threads) {
+                std::this_thread::yield();
+            }
+            if (!body(t)) {
+                all_ok.store(false);
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    return all_ok.load();
+}
+
+//==============================================================================
+// TESTS
+//==============================================================================
+
+void testSharedTables() {
+    std::cout << "\n========== TEST: TABLAS COMPARTIDAS ==========" << std::endl;
+
+    CORDICIterator a;
+    CORDICIterator b;
+    bool shared = &a.getAngleTable() == &b.getAngleTable() &&
+                  &a.getAngleTable() == &AngleTable::shared();
+    std::cout << "Todos los iteradores leen la misma AngleTable: " << (shared ? "✓" : "✗")
+              << std::endl;
+    if (!shared) {
+        throw std::runtime_error("La tabla de ángulos no es compartida");
+    }
+}
+
+void testContextLifecycle() {
+    std::cout << "\n========== TEST: CICLO DE VIDA DEL CONTEXTO ==========" << std::endl;
+
+    llama_cordic_context* ctx = llama_cordic_context_create(1);
+    if (!ctx) {
+        throw std::runtime_error("llama_cordic_context_create devolvió NULL");
+    }
+
+    CORDICSoftmax reference(false);
+    std::vector<float> logits = randomLogits(1000, 1);
+    std::vector<float> probs(1000);
+    std::vector<float> expected(1000);
+    llama_cordic_ctx_softmax(ctx, logits.data(), probs.data(), logits.size());
+    reference.computeSoftmax(logits.data(), expected.data(), logits.size());
+
+    bool exp_ok = llama_cordic_ctx_exp(ctx, 1.5f) == reference.calculateExpFast(1.5f);
+    bool softmax_ok = std::memcmp(probs.data(), expected.data(), probs.size() * sizeof(float)) == 0;
+    bool rows_error = llama_cordic_ctx_softmax_rows(ctx, logits.data(), probs.data(), 10, 100, 99,
+                                                    1.0f, nullptr, 0, 1) == -1 &&
+                      llama_cordic_softmax_rows(logits.data(), probs.data(), 10, 100, 99, 1.0f,
+                                                nullptr, 0, 1) == -1;
+    llama_cordic_context_free(ctx);
+    llama_cordic_context_free(nullptr);
+
+    std::cout << "exp idéntica: " << (exp_ok ? "✓" : "✗")
+              << ", softmax idéntico: " << (softmax_ok ? "✓" : "✗")
+              << ", stride inválido → -1 (con y sin contexto): " << (rows_error ? "✓" : "✗")
+              << std::endl;
+    if (!exp_ok || !softmax_ok || !rows_error) {
+        throw std::runtime_error("La API con contexto difiere de CORDICSoftmax");
+    }
+}
+
+void testConcurrentContexts() {
+    std::cout << "\n========== TEST: CONTEXTOS CONCURRENTES ==========" << std::endl;
+
+    const size_t num_threads = 8;
+    const size_t vocab_size = 32000;
+    const size_t rows = 64, cols = 500;
+
+    // Resultados esperados calculados en un solo hilo
+    std::vector<std::vector<float>> logits(num_threads);
+    std::vector<std::vector<float>> expected(num_threads);
+    std::vector<std::vector<float>> expected_rows(num_threads);
+    CORDICSoftmax reference(false);
+    for (size_t t = 0; t < num_threads; t++) {
+        logits[t] = randomLogits(vocab_size, static_cast<unsigned>(100 + t));
+        expected[t].resize(vocab_size);
+        reference.computeSoftmax(logits[t].data(), expected[t].data(), vocab_size);
+        expected_rows[t].resize(rows * cols);
+        reference.computeSoftmaxRows(logits[t].data(), expected_rows[t].data(), rows, cols, cols,
+                                     0.5f);
+    }
+
+    // Un contexto por hilo, todos a la vez
+    bool ok = runConcurrently(num_threads, [&](size_t t) {
+        llama_cordic_context* ctx = llama_cordic_context_create(1);
+        std::vector<float> probs(vocab_size);
+        std::vector<float> row_probs(rows * cols);
+        bool same = true;
+        for (int rep = 0; rep < 5; rep++) {
+            llama_cordic_ctx_softmax(ctx, logits[t].data(), probs.data(), vocab_size);
+            llama_cordic_ctx_softmax_rows(ctx, logits[t].data(), row_probs.data(), rows, cols, cols,
+                                          0.5f, nullptr, 0, 1);
+            same = same && probs == expected[t] && row_probs == expected_rows[t];
+        }
+        llama_cordic_context_free(ctx);
+        return same;
+    });
+    std::cout << num_threads << " hilos, un contexto cada uno: " << (ok ? "✓" : "✗") << std::endl;
+
+    // Un único contexto compartido para exp: funciones const sin estado
+    llama_cordic_context* shared_ctx = llama_cordic_context_create(1);
+    bool exp_ok = runConcurrently(num_threads, [&](size_t t) {
+        std::vector<float> out(vocab_size);
+        llama_cordic_ctx_exp_batch(shared_ctx, logits[t].data(), out.data(), vocab_size);
+        for (size_t i = 0; i < vocab_size; i += 97) {
+            if (llama_cordic_ctx_exp(shared_ctx, logits[t][i]) != out[i] ||
+                out[i] != reference.calculateExpFast(logits[t][i])) {
+                return false;
+            }
+        }
+        return true;
+    });
+    llama_cordic_context_free(shared_ctx);
+    std::cout << num_threads << " hilos, exp sobre un contexto compartido: "
+              << (exp_ok ? "✓" : "✗") << std::endl;
+
+    // API sin contexto: instancia por hilo
+    bool legacy_ok = runConcurrently(num_threads, [&](size_t t) {
+        std::vector<float> probs(vocab_size);
+        std::vector<float> row_probs(rows * cols);
+        llama_cordic_softmax(logits[t].data(), probs.data(), vocab_size);
+        const int status = llama_cordic_softmax_rows(logits[t].data(), row_probs.data(), rows, cols,
+                                                     cols, 0.5f, nullptr, 0, 1);
+        return probs == expected[t] && status == 0 && row_probs == expected_rows[t];
+    });
+    std::cout << num_threads << " hilos, llama_cordic_softmax / _rows sin contexto: "
+              << (legacy_ok ? "✓" : "✗") << std::endl;
+
+    if (!ok || !exp_ok || !legacy_ok) {
+        throw std::runtime_error("Resultados distintos con llamadas concurrentes");
+    }
+}
+
+//==============================================================================
+// MAIN
+//==============================================================================
+
+int main() {
+    std::cout << "========================================" << std::endl;
+    std::cout << "TEST: API C con contexto" << std::endl;
+    std::cout << "========================================" << std::endl;
+
+    try {
+        testSharedTables();
+        testContextLifecycle();
+        testConcurrentContexts();
+
+        std::cout << "\n========================================" << std::endl;
+        std::cout << "✅ TODOS LOS TESTS COMPLETADOS" << std::endl;
+        std::cout << "========================================" << std::endl;
+
+        return 0;
+
+    } catch (const std::exception& e) {
+        std::cerr << "\n❌ ERROR: " << e.what() << std::endl;
+        return 1;
+    }
+}
@@ -0,0 +1,190 @@
+#include "cordic_format.h"
+#include "cordic_iterator.h"
+#include <iostream>
+#include <iomanip>
+#include <cmath>
+#include <stdexcept>
+
+//==============================================================================
+// UTILIDADES
+//==============================================================================
+
+struct ErrorStats {
+    double max_error;
+    double mean_error;
+};
+
+template <typename Engine>
+ErrorStats measureError(float from, float to, float step) {
+    ErrorStats stats{0.0, 0.0};
+    size_t count = 0;
+    for (float x = from; x <= to; x += step) {
+        double reference = std::exp(static_cast<double>(x));
+        double error = std::abs(Engine::exp(x) - reference) / reference;
+        stats.max_error = std::max(stats.max_error, error);
+        stats.mean_error += error;
+        count++;
+    }
+    stats.mean_error /= count;
+    return stats;
+}
+
+//==============================================================================
+// TESTS
+//==============================================================================
+
+void testFixedPointTemplate() {
+    std::cout << "\n========== TEST: FixedPoint<Word, Frac> ==========" << std::endl;
+
+    // FixedPoint16 sigue siendo Q3.12: mismos códigos crudos que antes
+    bool q312_ok = FixedPoint16(1.0f).getRaw() == 4096 &&
+                   FixedPoint16(-0.5f).getRaw() == -2048 &&
+                   FixedPoint16(100.0f).getRaw() == INT16_MAX &&
+                   FixedPoint16(-100.0f).getRaw() == INT16_MIN &&
+                   FixedPoint16(0.3f).getRaw() == static_cast<int16_t>(0.3f * 4096);
+    std::cout << "Q3.12 (FixedPoint16) conversión y saturación: " << (q312_ok ? "✓" : "✗")
+              << std::endl;
+
+    using Q2_29 = FixedPoint<int32_t, 29>;
+    using Q8_8 = FixedPoint<int16_t, 8>;
+    bool q229_ok = Q2_29(1.0).getRaw() == (1 << 29) &&
+                   Q2_29(5.0).getRaw() == INT32_MAX &&
+                   std::abs(Q2_29(0.123456789).toDouble() - 0.123456789) < Q2_29::resolution();
+    bool q88_ok = Q8_8(100.25f).getRaw() == 100 * 256 + 64 &&
+                  Q8_8(-200.0f).getRaw() == INT16_MIN &&
+                  (Q8_8(3.0f) >> 1).toFloat() == 1.5f;
+    std::cout << "Q2.29 (int32): " << (q229_ok ? "✓" : "✗")
+              << ", Q8.8 (int16): " << (q88_ok ? "✓" : "✗") << std::endl;
+
+    if (!q312_ok || !q229_ok || !q88_ok) {
+        throw std::runtime_error("Conversión FixedPoint<Word, Frac> incorrecta");
+    }
+}
+
+void testFormatTables() {
+    std::cout << "\n========== TEST: TABLAS POR FORMATO ==========" << std::endl;
+
+    // Cada tabla constexpr debe coincidir con FixedPoint(std::atanh(2^-k))
+    bool ok = true;
+    for (int k = 1; k <= 29; k++) {
+        double angle = std::atanh(std::pow(2.0, -k));
+        ok = ok && CORDICFormatQ2_29::Rotator::ANGLES[k] == FixedPoint<int32_t, 29>(angle).getRaw();
+        if (k <= 12) {
+            ok = ok && CORDICFormatQ3_12::Rotator::ANGLES[k] == FixedPoint16(angle).getRaw();
+        }
+        if (k <= 8) {
+            ok = ok && CORDICFormatQ8_8::Rotator::ANGLES[k] == FixedPoint<int16_t, 8>(angle).getRaw();
+        }
+    }
+    std::cout << "Ángulos constexpr == FixedPoint(atanh(2^-k)) en los tres formatos: "
+              << (ok ? "✓" : "✗") << std::endl;
+    std::cout << "Rotaciones: Q8.8 = " << CORDICFormatQ8_8::ITERATIONS
+              << ", Q3.12 = " << CORDICFormatQ3_12::ITERATIONS
+              << ", Q2.29 = " << CORDICFormatQ2_29::ITERATIONS << std::endl;
+
+    // La instancia Q3.12 reproduce la secuencia fija del iterador
+    bool same_schedule = true;
+    for (int raw = -1420; raw <= 1420; raw++) {
+        CORDICRawState state(4096, 0, static_cast<int16_t>(raw));
+        CORDICIterator::performIterationsFixed(state);
+        int16_t x = 4096, y = 0, z = static_cast<int16_t>(raw);
+        CORDICFormatQ3_12::iterate(x, y, z);
+        same_schedule = same_schedule && x == state.X && y == state.Y && z == state.Z;
+    }
+    std::cout << "Q3.12 idéntico a CORDICIterator::performIterationsFixed: "
+              << (same_schedule ? "✓" : "✗") << std::endl;
+
+    if (!ok || !same_schedule) {
+        throw std::runtime_error("Tablas por formato incorrectas");
+    }
+}
+
+void testFormatAccuracy() {
+    std::cout << "\n========== TEST: PRECISIÓN POR FORMATO ==========" << std::endl;
+
+    ErrorStats q88 = measureError<CORDICFormatQ8_8>(-20.0f, 5.0f, 1e-3f);
+    ErrorStats q312 = measureError<CORDICFormatQ3_12>(-20.0f, 5.0f, 1e-3f);
+    ErrorStats q229 = measureError<CORDICFormatQ2_29>(-20.0f, 5.0f, 1e-3f);
+
+    std::cout << std::scientific << std::setprecision(3);
+    std::cout << "Q8.8:  máx " << q88.max_error << ", medio " << q88.mean_error << std::endl;
+    std::cout << "Q3.12: máx " << q312.max_error << ", medio " << q312.mean_error << std::endl;
+    std::cout << "Q2.29: máx " << q229.max_error << ", medio " << q229.mean_error << std::endl;
+    std::cout << std::fixed;
+
+    // Más bits fraccionales → menos error; Q2.29 queda al nivel de float
+    bool ordered = q229.max_error < q312.max_error && q312.max_error < q88.max_error;
+    bool bounds = q88.max_error < 3e-2 && q312.max_error < 3e-3 && q229.max_error < 2e-7;
+
+    // Extremos: sin saturación a ±15, 0 e inf como en std::exp
+    bool extremes = CORDICFormatQ2_29::exp(-200.0f) == 0.0f &&
+                    std::isinf(CORDICFormatQ2_29::exp(100.0f)) &&
+                    std::isnan(CORDICFormatQ2_29::exp(NAN)) &&
+                    std::abs(CORDICFormatQ2_29::exp(-30.0f) / std::exp(-30.0) - 1.0) < 2e-7;
+
+    std::cout << "Error ordenado por bits fraccionales: " << (ordered ? "✓" : "✗")
+              << ", cotas: " << (bounds ? "✓" : "✗")
+              << ", extremos: " << (extremes ? "✓" : "✗") << std::endl;
+    if (!ordered || !bounds || !extremes) {
+        throw std::runtime_error("Precisión por formato fuera de tolerancia");
+    }
+}
+
+void testFormatLog() {
+    std::cout << "\n========== TEST: LOGARITMO (MODO VECTORING) ==========" << std::endl;
+
+    // ln(v) sobre varias décadas, incluidas subnormales; error relativo a
+    // max(1, |ln v|) porque la salida float ya redondea a ~6e-8 relativo
+    double q312_error = 0.0, q229_error = 0.0;
+    for (float v = 1e-40f; v < 1e30f; v *= 1.37f) {
+        double reference = std::log(static_cast<double>(v));
+        double magnitude = std::max(1.0, std::abs(reference));
+        q312_error = std::max(q312_error,
+                              std::abs(CORDICFormatQ3_12::log(v) - reference) / magnitude);
+        q229_error = std::max(q229_error,
+                              std::abs(CORDICFormatQ2_29::log(v) - reference) / magnitude);
+    }
+    std::cout << std::scientific << std::setprecision(3);
+    std::cout << "Error máx (relativo a max(1, |ln v|)): Q3.12 " << q312_error
+              << ", Q2.29 " << q229_error << std::fixed << std::endl;
+
+    bool special = std::abs(CORDICFormatQ2_29::log(1.0f)) < 1e-7f &&
+                   CORDICFormatQ2_29::log(0.0f) == -INFINITY &&
+                   CORDICFormatQ2_29::log(INFINITY) == INFINITY &&
+                   std::isnan(CORDICFormatQ2_29::log(-1.0f)) &&
+                   std::isnan(CORDICFormatQ2_29::log(NAN));
+    std::cout << "Casos especiales (1, 0, inf, negativos, NaN): " << (special ? "✓" : "✗")
+              << std::endl;
+
+    // Q2.29: error de cuantización de m ± 1 (~2e-9) y de la suma de ángulos
+    if (q312_error > 2e-3 || q229_error > 2e-7 || !special) {
+        throw std::runtime_error("Logaritmo por vectoring fuera de tolerancia");
+    }
+}
+
+//==============================================================================
+// MAIN
+//==============================================================================
+
+int main() {
+    std::cout << "========================================" << std::endl;
+    std::cout << "TEST: formatos de punto fijo" << std::endl;
+    std::cout << "========================================" << std::endl;
+
+    try {
+        testFixedPointTemplate();
+        testFormatTables();
+        testFormatAccuracy();
+        testFormatLog();
+
+        std::cout << "\n========================================" << std::endl;
+        std::cout << "✅ TODOS LOS TESTS COMPLETADOS" << std::endl;
+        std::cout << "========================================" << std::endl;
+
+        return 0;
+
+    } catch (const std::exception& e) {
+        std::cerr << "\n❌ ERROR: " << e.what() << std::endl;
+        return 1;
+    }
+}
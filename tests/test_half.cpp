@@ -0,0 +1,242 @@
+#include "cordic_softmax.h"
+#include "cordic_half.h"
+#include <iostream>
+#include <iomanip>
+#include <cmath>
+#include <cstring>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+//==============================================================================
+// UTILIDADES
+//==============================================================================
+
+/**
+ * Decodificación de referencia fp16 por aritmética (independiente de los bits)
+ */
+double referenceHalf(uint16_t bits) {
+    const int sign = (bits & 0x8000) ? -1 : 1;
+    const int exponent = (bits >> 10) & 0x1F;
+    const int mantissa = bits & 0x3FF;
+    if (exponent == 0) {
+        return sign * std::ldexp(static_cast<double>(mantissa), -24);
+    }
+    return sign * std::ldexp(1024.0 + mantissa, exponent - 25);
+}
+
+/**
+ * h es el redondeo al par más cercano de v entre sus vecinos h ± 1
+ */
+template <typename Half>
+bool isNearestEven(float v, Half h) {
+    const double value = v;
+    const double rounded = CORDICHalf::toFloat(h);
+    for (int delta : {-1, 1}) {
+        Half neighbour{static_cast<uint16_t>(h.bits + delta)};
+        const double other = CORDICHalf::toFloat(neighbour);
+        if (std::isnan(other) || std::isinf(other)) {
+            continue;
+        }
+        const double d_rounded = std::abs(rounded - value);
+        const double d_other = std::abs(other - value);
+        if (d_other < d_rounded || (d_other == d_rounded && (h.bits & 1))) {
+            return false;
+        }
+    }
+    return true;
+}
+
+size_t ulpDistance(uint16_t a, uint16_t b) {
+    return a > b ? a - b : b - a;
+}
+
+//==============================================================================
+// TESTS
+//==============================================================================
+
+void testConversions() {
+    std::cout << "\n========== TEST: CONVERSIONES fp16 / bf16 ==========" << std::endl;
+
+    // Los 65536 patrones de bits
+    bool decode_ok = true, roundtrip_ok = true, bf16_ok = true, block_ok = true;
+    std::vector<CORDICFloat16> all_half(65536);
+    for (uint32_t bits = 0; bits < 65536; bits++) {
+        CORDICFloat16 h{static_cast<uint16_t>(bits)};
+        all_half[bits] = h;
+        const float value = CORDICHalf::toFloat(h);
+        const bool is_nan = ((bits & 0x7C00) == 0x7C00) && (bits & 0x3FF);
+        const bool is_inf = (bits & 0x7FFF) == 0x7C00;
+        if (is_nan) {
+            decode_ok = decode_ok && std::isnan(value);
+            roundtrip_ok = roundtrip_ok && std::isnan(CORDICHalf::toFloat(
+                               CORDICHalf::fromFloat<CORDICFloat16>(value)));
+        } else {
+            decode_ok = decode_ok && (is_inf ? std::isinf(value) : value == referenceHalf(h.bits));
+            roundtrip_ok = roundtrip_ok && CORDICHalf::fromFloat<CORDICFloat16>(value).bits == bits;
+        }
+
+        CORDICBFloat16 b{static_cast<uint16_t>(bits)};
+        const float b_value = CORDICHalf::toFloat(b);
+        bf16_ok = bf16_ok && (std::isnan(b_value) ||
+                              CORDICHalf::fromFloat<CORDICBFloat16>(b_value).bits == bits);
+    }
+    std::vector<float> block(65536);
+    CORDICHalf::toFloat(all_half.data(), block.data(), block.size());
+    std::vector<CORDICFloat16> back(65536);
+    CORDICHalf::fromFloat(block.data(), back.data(), block.size());
+    for (uint32_t bits = 0; bits < 65536; bits++) {
+        const float scalar = CORDICHalf::toFloat(all_half[bits]);
+        block_ok = block_ok && (std::isnan(scalar) ? std::isnan(block[bits]) : (
+                                   std::memcmp(&scalar, &block[bits], sizeof(float)) == 0 &&
+                                   back[bits].bits == bits));
+    }
+
+    // Redondeo de floats arbitrarios (normales, subnormales fp16 y empates)
+    std::mt19937 gen(3);
+    std::uniform_int_distribution<uint32_t> any_bits(0, 0xFFFFFFFF);
+    bool rounding_ok = true;
+    size_t checked = 0;
+    for (int i = 0; i < 200000; i++) {
+        float v;
+        uint32_t raw = any_bits(gen);
+        if (i % 4 == 0) {
+            raw = (raw & 0x80001FFF) | ((103 + raw % 40) << 23);  // Rango fp16, empates incluidos
+            raw &= (i % 8 == 0) ? 0xFFFFF000 : 0xFFFFFFFF;
+            raw |= (i % 8 == 0) ? 0x1000 : 0;
+        }
+        std::memcpy(&v, &raw, sizeof(v));
+        if (std::isnan(v) || std::abs(v) >= 65504.0f) {
+            continue;
+        }
+        rounding_ok = rounding_ok && isNearestEven(v, CORDICHalf::fromFloat<CORDICFloat16>(v));
+        if (std::abs(v) < 3e38f) {
+            rounding_ok = rounding_ok && isNearestEven(v, CORDICHalf::fromFloat<CORDICBFloat16>(v));
+        }
+        checked++;
+    }
+    bool special = CORDICHalf::fromFloat<CORDICFloat16>(1e6f).bits == 0x7C00 &&
+                   CORDICHalf::fromFloat<CORDICFloat16>(-INFINITY).bits == 0xFC00 &&
+                   CORDICHalf::fromFloat<CORDICFloat16>(65519.0f).bits == 0x7BFF &&
+                   CORDICHalf::fromFloat<CORDICFloat16>(65520.0f).bits == 0x7C00 &&
+                   std::isnan(CORDICHalf::toFloat(CORDICHalf::fromFloat<CORDICBFloat16>(NAN)));
+
+    std::cout << "fp16 → float (65536 patrones): " << (decode_ok ? "✓" : "✗")
+              << ", ida y vuelta: " << (roundtrip_ok ? "✓" : "✗")
+              << ", bf16: " << (bf16_ok ? "✓" : "✗")
+              << ", bloques == escalar: " << (block_ok ? "✓" : "✗") << std::endl;
+    std::cout << "Redondeo al par más cercano (" << checked << " floats): "
+              << (rounding_ok ? "✓" : "✗") << ", overflow / inf / NaN: "
+              << (special ? "✓" : "✗") << std::endl;
+    if (!decode_ok || !roundtrip_ok || !bf16_ok || !block_ok || !rounding_ok || !special) {
+        throw std::runtime_error("Conversión fp16 / bf16 incorrecta");
+    }
+}
+
+template <typename Half>
+bool checkSoftmax(const char* name, CORDICSoftmax& cordic, const std::vector<float>& source) {
+    const size_t size = source.size();
+    std::vector<Half> logits(size);
+    CORDICHalf::fromFloat(source.data(), logits.data(), size);
+
+    // Referencia: conversión completa a float y computeSoftmax
+    std::vector<float> converted(size);
+    CORDICHalf::toFloat(logits.data(), converted.data(), size);
+    std::vector<float> expected(size);
+    cordic.computeSoftmax(converted.data(), expected.data(), size);
+
+    std::vector<float> probs(size);
+    cordic.computeSoftmax(logits.data(), probs.data(), size);
+    const bool float_out = probs == expected;
+
+    std::vector<Half> half_probs(size);
+    cordic.computeSoftmax(logits.data(), half_probs.data(), size);
+    size_t worst_ulp = 0;
+    for (size_t i = 0; i < size; i++) {
+        worst_ulp = std::max(worst_ulp, ulpDistance(half_probs[i].bits,
+                                                    CORDICHalf::fromFloat<Half>(expected[i]).bits));
+    }
+
+    // En sitio
+    std::vector<Half> in_place = logits;
+    cordic.computeSoftmax(in_place.data(), in_place.data(), size);
+    const bool in_place_ok = std::memcmp(in_place.data(), half_probs.data(),
+                                         size * sizeof(Half)) == 0;
+
+    // exp por lotes
+    std::vector<float> exps(size), expected_exps(size);
+    cordic.calculateExpBatchFast(logits.data(), exps.data(), size);
+    cordic.calculateExpBatchFast(converted.data(), expected_exps.data(), size);
+    std::vector<Half> half_exps(size);
+    cordic.calculateExpBatchFast(logits.data(), half_exps.data(), size);
+    bool exp_ok = exps == expected_exps;
+    for (size_t i = 0; i < size; i++) {
+        exp_ok = exp_ok && half_exps[i].bits == CORDICHalf::fromFloat<Half>(expected_exps[i]).bits;
+    }
+
+    const bool ok = float_out && worst_ulp <= 1 && in_place_ok && exp_ok;
+    std::cout << name << ": salida float idéntica: " << (float_out ? "✓" : "✗")
+              << ", salida " << name << " ≤ 1 ulp (" << worst_ulp << "): "
+              << (worst_ulp <= 1 ? "✓" : "✗") << ", en sitio: " << (in_place_ok ? "✓" : "✗")
+              << ", exp por lotes: " << (exp_ok ? "✓" : "✗") << std::endl;
+    return ok;
+}
+
+void testHalfSoftmax() {
+    std::cout << "\n========== TEST: SOFTMAX CON LOGITS fp16 / bf16 ==========" << std::endl;
+
+    std::mt19937 gen(7);
+    std::normal_distribution<float> dist(0.0f, 1.5f);
+    std::vector<float> source(32003);
+    for (float& v : source) {
+        v = dist(gen);
+    }
+
+    CORDICSoftmax cordic(false);
+    bool ok = checkSoftmax<CORDICFloat16>("fp16", cordic, source);
+    ok = checkSoftmax<CORDICBFloat16>("bf16", cordic, source) && ok;
+
+    // API C con bits crudos
+    std::vector<uint16_t> raw(source.size());
+    std::vector<CORDICFloat16> typed(source.size());
+    CORDICHalf::fromFloat(source.data(), typed.data(), source.size());
+    std::memcpy(raw.data(), typed.data(), raw.size() * sizeof(uint16_t));
+    std::vector<float> c_probs(source.size()), expected(source.size());
+    llama_cordic_context* ctx = llama_cordic_context_create(1);
+    llama_cordic_ctx_softmax_f16(ctx, raw.data(), c_probs.data(), raw.size());
+    cordic.computeSoftmax(typed.data(), expected.data(), typed.size());
+    std::vector<uint16_t> c_half(source.size());
+    llama_cordic_ctx_softmax_bf16_bf16(ctx, raw.data(), c_half.data(), raw.size());
+    llama_cordic_context_free(ctx);
+    const bool c_api = c_probs == expected;
+    std::cout << "API C (f16 → f32): " << (c_api ? "✓" : "✗") << std::endl;
+
+    if (!ok || !c_api) {
+        throw std::runtime_error("Softmax fp16 / bf16 difiere de la ruta float");
+    }
+}
+
+//==============================================================================
+// MAIN
+//==============================================================================
+
+int main() {
+    std::cout << "========================================" << std::endl;
+    std::cout << "TEST: entrada / salida fp16 y bf16" << std::endl;
+    std::cout << "========================================" << std::endl;
+
+    try {
+        testConversions();
+        testHalfSoftmax();
+
+        std::cout << "\n========================================" << std::endl;
+        std::cout << "✅ TODOS LOS TESTS COMPLETADOS" << std::endl;
+        std::cout << "========================================" << std::endl;
+
+        return 0;
+
+    } catch (const std::exception& e) {
+        std::cerr << "\n❌ ERROR: " << e.what() << std::endl;
+        return 1;
+    }
+}
@@ -0,0 +1,300 @@
+#include "cordic_hls_model.h"
+#include "cordic_softmax.h"
+#include "cordic_preprocessor.h"
+#include "cordic_iterator.h"
+#include <iostream>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+//==============================================================================
+// UTILIDADES
+//==============================================================================
+
+uint32_t floatBits(float value) {
+    uint32_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    return bits;
+}
+
+float bitsFloat(uint32_t bits) {
+    float value;
+    std::memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+/**
+ * @brief Esquinas: fronteras de saturación, de ln2/2 y de cada k × ln2 ± ln2/2
+ */
+std::vector<uint32_t> cornerInputs() {
+    std::vector<uint32_t> bits;
+    const float specials[] = {
+        0.0f, -0.0f, 1.0f, -1.0f, 15.0f, -15.0f, 8.0f, -8.0f, 20.0f, -20.0f,
+        std::numeric_limits<float>::quiet_NaN(), -std::numeric_limits<float>::quiet_NaN(),
+        std::numeric_limits<float>::infinity(), -std::numeric_limits<float>::infinity(),
+        std::numeric_limits<float>::denorm_min(), -std::numeric_limits<float>::denorm_min(),
+        std::numeric_limits<float>::min(), std::numeric_limits<float>::max(),
+        static_cast<float>(CORDICConfig::CONVERGENCE_LIMIT)
+    };
+    for (float value : specials) {
+        for (int delta = -2; delta <= 2; delta++) {
+            const uint32_t base = floatBits(value);
+            if (std::isfinite(value) && value != 0.0f) {
+                bits.push_back(base + static_cast<uint32_t>(delta));
+            }
+        }
+        bits.push_back(floatBits(value));
+    }
+    for (int k = -22; k <= 22; k++) {
+        for (float edge : {static_cast<float>((k + 0.5) * CORDICConfig::LN2),
+                           static_cast<float>((k - 0.5) * CORDICConfig::LN2),
+                           static_cast<float>(k * CORDICConfig::LN2)}) {
+            for (int delta = -3; delta <= 3; delta++) {
+                bits.push_back(floatBits(edge) + static_cast<uint32_t>(delta));
+            }
+        }
+    }
+    return bits;
+}
+
+std::vector<uint32_t> randomInputs(size_t count, unsigned seed) {
+    std::mt19937 gen(seed);
+    std::uniform_real_distribution<float> values(-16.0f, 16.0f);
+    std::uniform_int_distribution<uint32_t> raw;
+    std::vector<uint32_t> bits(count);
+    for (size_t i = 0; i < count; i++) {
+        // Mitad en el rango útil, mitad bits arbitrarios (NaN, inf, subnormales)
+        bits[i] = i % 2 == 0 ? floatBits(values(gen)) : raw(gen);
+    }
+    return bits;
+}
+
+//==============================================================================
+// TESTS
+//==============================================================================
+
+void testPreprocessorExhaustive() {
+    std::cout << "\n========== TEST: PRE = CORDICPreprocessor ==========" << std::endl;
+
+    using Model = CORDICHLSModel<>;
+    size_t checked = 0;
+    size_t mismatches = 0;
+    auto check = [&](uint32_t bits) {
+        const PreprocessResult expected = CORDICPreprocessor::processInput(bitsFloat(bits));
+        const CORDICHLSStage stage = Model::preprocess(bits);
+        checked++;
+        if (stage.z != expected.mapped_input.getRaw() ||
+            stage.reduction != expected.reduction_factor) {
+            if (mismatches++ < 5) {
+                std::cout << "  ✗ x = " << bitsFloat(bits) << ": Z " << stage.z << " / "
+                          << expected.mapped_input.getRaw() << ", n "
+                          << static_cast<int>(stage.reduction) << " / "
+                          << expected.reduction_factor << std::endl;
+            }
+        }
+    };
+
+    // Float con mapeo (ln2/2 < |x| ≤ 15), ambos signos: 1 de cada 17 y los
+    // 4096 primeros de cada binade (el recorrido completo es
+    // cordic_hls_vectors --exhaustive)
+    for (uint32_t sign : {0u, 0x80000000u}) {
+        for (uint32_t bits = Model::DIRECT_MAX_ABS_BITS + 1; bits <= Model::SATURATION_ABS_BITS;
+             bits++) {
+            if (bits % 17 == 0 || (bits & 0x7FFFFFu) < 4096) {
+                check(sign | bits);
+            }
+        }
+    }
+    const size_t mapped = checked;
+
+    // Sin mapeo y saturadas: muestreo con paso primo sobre todos los bits
+    for (uint64_t bits = 0; bits <= 0xFFFFFFFFu; bits += 4099) {
+        check(static_cast<uint32_t>(bits));
+    }
+    for (uint32_t bits : cornerInputs()) {
+        check(bits);
+    }
+
+    std::cout << "Con mapeo: " << mapped << " entradas, total " << checked
+              << ", distintas: " << mismatches << " " << (mismatches == 0 ? "✓" : "✗")
+              << std::endl;
+    if (mismatches != 0) {
+        throw std::runtime_error("PRE distinto de CORDICPreprocessor::processInput");
+    }
+}
+
+template <int LastShift>
+size_t countDatapathMismatches(const std::vector<uint32_t>& inputs) {
+    CORDICSoftmax cordic(false);
+    size_t mismatches = 0;
+    for (uint32_t bits : inputs) {
+        const float x = bitsFloat(bits);
+        const float expected = LastShift == CORDICConfig::FRAC_WIDTH
+            ? cordic.calculateExpFolded(x) : cordic.calculateExpFolded(x, LastShift);
+        const uint32_t golden = CORDICHLSModel<LastShift>::evaluate(bits);
+        if (golden != floatBits(expected)) {
+            if (mismatches++ < 5) {
+                std::cout << "  ✗ N = " << LastShift << ", x = " << x << ": "
+                          << bitsFloat(golden) << " / " << expected << std::endl;
+            }
+        }
+    }
+    return mismatches;
+}
+
+void testDatapathMatchesCPU() {
+    std::cout << "\n========== TEST: DATAPATH = calculateExpFolded ==========" << std::endl;
+
+    std::vector<uint32_t> inputs = randomInputs(1 << 20, 11);
+    const std::vector<uint32_t> corners = cornerInputs();
+    inputs.insert(inputs.end(), corners.begin(), corners.end());
+
+    const size_t full = countDatapathMismatches<12>(inputs);
+    const size_t n8 = countDatapathMismatches<8>(inputs);
+    const size_t n1 = countDatapathMismatches<1>(inputs);
+
+    std::cout << inputs.size() << " entradas (aleatorias + esquinas), distintas N = 12 / 8 / 1: "
+              << full << " / " << n8 << " / " << n1 << " "
+              << (full + n8 + n1 == 0 ? "✓" : "✗") << std::endl;
+    std::cout << "Profundidad de pipeline N = 12: " << CORDICHLSModel<>::PIPELINE_DEPTH
+              << " etapas (PRE + " << CORDICHLSModel<>::LENGTH << " rotaciones + POST)"
+              << std::endl;
+    if (full + n8 + n1 != 0) {
+        throw std::runtime_error("El modelo HLS difiere de la ruta CPU");
+    }
+}
+
+void testTraceMatchesIterator() {
+    std::cout << "\n========== TEST: TRAZA POR ETAPA ==========" << std::endl;
+
+    using Model = CORDICHLSModel<>;
+    bool all_ok = true;
+    for (uint32_t bits : randomInputs(4096, 12)) {
+        const Model::Trace trace = Model::trace(bits);
+        const PreprocessResult prep = CORDICPreprocessor::processInput(bitsFloat(bits));
+
+        CORDICRawState state(CORDICTables::FIXED_SCHEDULE_FOLDED_X0, 0, prep.mapped_input.getRaw());
+        const bool pre_ok = trace.x[0] == state.X && trace.y[0] == 0 && trace.z[0] == state.Z &&
+                            trace.reduction == prep.reduction_factor;
+        CORDICIterator::performIterationsFixed(state);
+        const size_t last = Model::LENGTH;
+        const bool rot_ok = trace.x[last] == state.X && trace.y[last] == state.Y &&
+                            trace.z[last] == state.Z && trace.sum == state.X + state.Y;
+        const bool out_ok = trace.output_bits == Model::evaluate(bits);
+        all_ok = all_ok && pre_ok && rot_ok && out_ok;
+    }
+
+    // Una etapa intermedia a mano: tras la rotación 1 (k = 1, Z₀ ≥ 0)
+    const Model::Trace one = Model::trace(floatBits(0.25f));
+    const int16_t x0 = CORDICTables::FIXED_SCHEDULE_FOLDED_X0;
+    const bool step_ok = one.x[1] == x0 && one.y[1] == (x0 >> 1) &&
+                         one.z[1] == 1024 - CORDICTables::RAW_ANGLES[1];
+
+    std::cout << "PRE = processInput, última etapa = performIterationsFixed: "
+              << (all_ok ? "✓" : "✗") << std::endl;
+    std::cout << "Rotación 1 de x = 0.25: X = " << one.x[1] << ", Y = " << one.y[1]
+              << ", Z = " << one.z[1] << " " << (step_ok ? "✓" : "✗") << std::endl;
+    if (!all_ok || !step_ok) {
+        throw std::runtime_error("Traza por etapa incorrecta");
+    }
+}
+
+void testPackFloat() {
+    std::cout << "\n========== TEST: EMPAQUETADO FLOAT (POST) ==========" << std::endl;
+
+    using Model = CORDICHLSModel<>;
+    std::mt19937 gen(13);
+    std::uniform_int_distribution<int32_t> sums(-70000, 70000);
+    std::uniform_int_distribution<int> exponents(-190, 140);
+    size_t mismatches = 0;
+    for (int i = 0; i < 200000; i++) {
+        const int32_t sum = i < 1000 ? (i % 2 == 0 ? 1 : -3) : sums(gen);
+        const int exponent = i < 1000 ? -150 + (i % 40) : exponents(gen);
+        const float expected = std::ldexp(static_cast<float>(sum), exponent);
+        if (Model::packFloat(sum, exponent) != floatBits(expected)) {
+            mismatches++;
+        }
+    }
+    std::cout << "sum × 2^e = ldexp (normales, subnormales, desbordamiento): "
+              << (mismatches == 0 ? "✓" : "✗") << std::endl;
+    if (mismatches != 0) {
+        throw std::runtime_error("packFloat distinto de ldexp");
+    }
+}
+
+void testCycleAccuratePipeline() {
+    std::cout << "\n========== TEST: PIPELINE CICLO A CICLO ==========" << std::endl;
+
+    using Pipeline = CORDICHLSPipeline<>;
+    Pipeline pipeline;
+    const std::vector<uint32_t> inputs = randomInputs(500, 14);
+
+    // Hueco cada 7 ciclos; al final DEPTH ciclos sin entrada vacían el pipeline
+    std::vector<CORDICHLSStage> issued;
+    size_t next_input = 0;
+    size_t received = 0;
+    bool ok = true;
+    for (size_t cycle = 0; next_input < inputs.size() || cycle < issued.size() + Pipeline::DEPTH;
+         cycle++) {
+        CORDICHLSStage input;
+        if (next_input < inputs.size() && cycle % 7 != 3) {
+            input.valid = true;
+            input.input_bits = inputs[next_input++];
+        }
+        const CORDICHLSStage output = pipeline.clock(input.valid, input.input_bits);
+        issued.push_back(input);
+
+        if (cycle < static_cast<size_t>(Pipeline::DEPTH)) {
+            ok = ok && !output.valid;
+            continue;
+        }
+        const CORDICHLSStage& expected = issued[cycle - Pipeline::DEPTH];
+        ok = ok && output.valid == expected.valid;
+        if (output.valid) {
+            ok = ok && output.input_bits == expected.input_bits &&
+                 output.output_bits == CORDICHLSModel<>::evaluate(expected.input_bits);
+            received++;
+        }
+        if (next_input == inputs.size() && received == inputs.size()) {
+            break;
+        }
+    }
+
+    ok = ok && received == inputs.size();
+    std::cout << "Latencia " << Pipeline::DEPTH << " ciclos, II = 1, " << received
+              << " resultados en orden con huecos: " << (ok ? "✓" : "✗") << std::endl;
+    if (!ok) {
+        throw std::runtime_error("Pipeline ciclo a ciclo incorrecto");
+    }
+}
+
+//==============================================================================
+// MAIN
+//==============================================================================
+
+int main() {
+    std::cout << "========================================" << std::endl;
+    std::cout << "TEST: modelo dorado HLS" << std::endl;
+    std::cout << "========================================" << std::endl;
+
+    try {
+        testPreprocessorExhaustive();
+        testDatapathMatchesCPU();
+        testTraceMatchesIterator();
+        testPackFloat();
+        testCycleAccuratePipeline();
+
+        std::cout << "\n========================================" << std::endl;
+        std::cout << "✅ TODOS LOS TESTS COMPLETADOS" << std::endl;
+        std::cout << "========================================" << std::endl;
+
+        return 0;
+
+    } catch (const std::exception& e) {
+        std::cerr << "\n❌ ERROR: " << e.what() << std::endl;
+        return 1;
+    }
+}
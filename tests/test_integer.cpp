@@ -0,0 +1,218 @@
+#include "cordic_integer.h"
+#include <iostream>
+#include <iomanip>
+#include <cmath>
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+//==============================================================================
+// UTILIDADES
+//==============================================================================
+
+/**
+ * Generador lineal congruente: mismos logits en cualquier librería estándar
+ * (los vectores de oro no dependen de std::normal_distribution)
+ */
+struct Lcg {
+    uint32_t state;
+
+    explicit Lcg(uint32_t seed) : state(seed) {}
+
+    int16_t next(int16_t range) {
+        state = state * 1664525u + 1013904223u;
+        return static_cast<int16_t>(static_cast<int32_t>(state >> 16) % (2 * range + 1) - range);
+    }
+};
+
+std::vector<int16_t> randomLogits(size_t size, int16_t range, uint32_t seed) {
+    Lcg lcg(seed);
+    std::vector<int16_t> logits(size);
+    for (int16_t& v : logits) {
+        v = lcg.next(range);
+    }
+    return logits;
+}
+
+//==============================================================================
+// TESTS
+//==============================================================================
+
+void testExpRaw() {
+    std::cout << "\n========== TEST: e^d ENTERO (TODOS LOS d Q1.14) ==========" << std::endl;
+
+    // Todos los d ≤ 0 con e^d representable en Q2.30
+    const double one = std::ldexp(1.0, CORDICIntegerSoftmax::EXP_FRAC_BITS);
+    double max_relative = 0.0, max_absolute = 0.0;
+    bool monotonic_zero = true;
+    for (int32_t d = 0; d >= -24 * 16384; d--) {
+        const uint32_t e = CORDICIntegerSoftmax::expRaw(d);
+        const double reference = std::exp(d / 16384.0);
+        max_absolute = std::max(max_absolute, std::abs(e / one - reference));
+        if (reference > 1e-4) {
+            max_relative = std::max(max_relative, std::abs(e / one - reference) / reference);
+        }
+        if (d < -23 * 16384) {
+            monotonic_zero = monotonic_zero && e == 0;
+        }
+    }
+    bool far = CORDICIntegerSoftmax::expRaw(-(1 << 28)) == 0 && CORDICIntegerSoftmax::expRaw(INT32_MIN / 8) == 0;
+
+    std::cout << std::scientific << std::setprecision(2);
+    std::cout << "Error relativo máx (e^d > 1e-4): " << max_relative
+              << ", absoluto máx: " << max_absolute << std::endl;
+    std::cout << "d < -23 → 0: " << (monotonic_zero && far ? "✓" : "✗") << std::endl;
+    if (max_relative > 1e-3 || max_absolute > 1e-3 || !monotonic_zero || !far) {
+        throw std::runtime_error("e^d entero fuera de tolerancia");
+    }
+}
+
+void testBlockMatchesScalar() {
+    std::cout << "\n========== TEST: BLOQUES == ESCALAR (BIT A BIT) ==========" << std::endl;
+
+    bool ok = true;
+    for (int frac : {0, 4, 8, 14}) {
+        CORDICIntegerSoftmax softmax(frac);
+        std::vector<int16_t> logits = randomLogits(1000 + frac, 32000, 11u + frac);
+        std::vector<uint32_t> exps(logits.size());
+        softmax.computeExps(logits.data(), exps.data(), logits.size());
+
+        int16_t max_logit = logits[0];
+        for (int16_t v : logits) {
+            max_logit = std::max(max_logit, v);
+        }
+        bool same = true;
+        for (size_t i = 0; i < logits.size(); i++) {
+            const int32_t d = (static_cast<int32_t>(logits[i]) - max_logit) * (1 << (14 - frac));
+            same = same && exps[i] == CORDICIntegerSoftmax::expRaw(d);
+        }
+        std::cout << "F = " << frac << ": " << (same ? "✓" : "✗") << std::endl;
+        ok = ok && same;
+    }
+    if (!ok) {
+        throw std::runtime_error("La ruta por bloques difiere de expRaw");
+    }
+}
+
+void testSoftmax() {
+    std::cout << "\n========== TEST: SOFTMAX ENTERO ==========" << std::endl;
+
+    // Logits Q7.8 en ±8: mismo rango que los tests float
+    CORDICIntegerSoftmax softmax(8);
+    bool ok = true;
+    std::cout << std::fixed << std::setprecision(2);
+    for (size_t size : {1, 7, 256, 1000, 32000}) {
+        std::vector<int16_t> logits = randomLogits(size, 8 * 256, static_cast<uint32_t>(size));
+        std::vector<uint16_t> probs(size);
+        softmax.computeSoftmax(logits.data(), probs.data(), size);
+
+        double max_logit = -1e9, sum = 0.0;
+        for (int16_t v : logits) {
+            max_logit = std::max(max_logit, v / 256.0);
+        }
+        for (int16_t v : logits) {
+            sum += std::exp(v / 256.0 - max_logit);
+        }
+        // Redondeo (½ LSB) más el error relativo de e^d en numerador y Σ
+        double worst_lsb = 0.0;
+        bool within = true;
+        int64_t total = 0;
+        for (size_t i = 0; i < size; i++) {
+            const double reference = std::exp(logits[i] / 256.0 - max_logit) / sum *
+                                     CORDICIntegerSoftmax::PROB_ONE;
+            const double error = std::abs(probs[i] - reference);
+            worst_lsb = std::max(worst_lsb, error);
+            within = within && error <= 0.5 + 2e-3 * reference;
+            total += probs[i];
+        }
+        const bool row_ok = within &&
+                            std::abs(total - CORDICIntegerSoftmax::PROB_ONE) <= static_cast<int64_t>(size);
+        std::cout << "N = " << size << ": error máx " << worst_lsb << " LSB, Σp = " << total
+                  << " (1.0 = " << CORDICIntegerSoftmax::PROB_ONE << ") "
+                  << (row_ok ? "✓" : "✗") << std::endl;
+        ok = ok && row_ok;
+    }
+
+    std::vector<int16_t> single = {-1234};
+    std::vector<uint16_t> single_prob(1);
+    softmax.computeSoftmax(single.data(), single_prob.data(), 1);
+    const bool one = single_prob[0] == CORDICIntegerSoftmax::PROB_ONE;
+    std::cout << "Un elemento → 1.0 exacto: " << (one ? "✓" : "✗") << std::endl;
+
+    if (!ok || !one) {
+        throw std::runtime_error("Softmax entero fuera de tolerancia");
+    }
+}
+
+void testGoldenVector() {
+    std::cout << "\n========== TEST: VECTOR DE ORO ==========" << std::endl;
+
+    // Salida congelada: cualquier cambio de bits rompe la equivalencia con el RTL
+    const std::vector<int16_t> logits = {0, 256, -256, 512, -2048, 1024, 100, -32768, 1023, 7};
+    const std::vector<uint16_t> expected = {266, 724, 98, 1969, 0, 14546, 394, 0, 14496, 274};
+    CORDICIntegerSoftmax softmax(8);
+    std::vector<uint16_t> probs(logits.size());
+    const uint64_t sum = softmax.computeSoftmax(logits.data(), probs.data(), logits.size());
+
+    std::cout << "Σ e^d = " << sum << ", p = {";
+    for (size_t i = 0; i < probs.size(); i++) {
+        std::cout << probs[i] << (i + 1 < probs.size() ? ", " : "}");
+    }
+    std::cout << std::endl;
+    const bool ok = probs == expected && sum == 2418464197ull;
+    std::cout << "Coincide con el vector de oro: " << (ok ? "✓" : "✗") << std::endl;
+    if (!ok) {
+        throw std::runtime_error("El softmax entero ya no coincide con el vector de oro");
+    }
+}
+
+void testInvalidArguments() {
+    std::cout << "\n========== TEST: ARGUMENTOS INVÁLIDOS ==========" << std::endl;
+
+    int thrown = 0;
+    for (int frac : {-1, 15}) {
+        try {
+            CORDICIntegerSoftmax softmax(frac);
+        } catch (const std::invalid_argument&) {
+            thrown++;
+        }
+    }
+    try {
+        CORDICIntegerSoftmax softmax;
+        softmax.computeSoftmax(nullptr, nullptr, 0);
+    } catch (const std::invalid_argument&) {
+        thrown++;
+    }
+    std::cout << "Excepciones: " << thrown << "/3 " << (thrown == 3 ? "✓" : "✗") << std::endl;
+    if (thrown != 3) {
+        throw std::runtime_error("Argumentos inválidos aceptados");
+    }
+}
+
+//==============================================================================
+// MAIN
+//==============================================================================
+
+int main() {
+    std::cout << "========================================" << std::endl;
+    std::cout << "TEST: softmax solo con enteros" << std::endl;
+    std::cout << "========================================" << std::endl;
+
+    try {
+        testExpRaw();
+        testBlockMatchesScalar();
+        testSoftmax();
+        testGoldenVector();
+        testInvalidArguments();
+
+        std::cout << "\n========================================" << std::endl;
+        std::cout << "✅ TODOS LOS TESTS COMPLETADOS" << std::endl;
+        std::cout << "========================================" << std::endl;
+
+        return 0;
+
+    } catch (const std::exception& e) {
+        std::cerr << "\n❌ ERROR: " << e.what() << std::endl;
+        return 1;
+    }
+}
@@ -1,9 +1,13 @@
 #include "cordic_types.h"
 #include "cordic_preprocessor.h"
 #include "cordic_iterator.h"
+#include "cordic_tables.h"
 #include <iostream>
 #include <iomanip>
 #include <cmath>
+#include <algorithm>
+#include <stdexcept>
+#include <vector>
 
 void testAngleTable() {
     std::cout << "\n========== TEST: TABLA DE ÁNGULOS ==========" << std::endl;
@@ -103,6 +107,256 @@ void testIterationDetail() {
     std::cout << "\n✓ Iteración detallada completada" << std::endl;
 }
 
+void testConstexprTables() {
+    std::cout << "\n========== TEST: TABLAS constexpr ==========" << std::endl;
+    
+    // La tabla de compilación debe coincidir con FixedPoint16(std::atanh(2^-k))
+    bool table_ok = true;
+    for (int k = 1; k <= CORDICTables::TABLE_SIZE; k++) {
+        AngleTableEntry entry(k);
+        if (entry.fixed_angle.getRaw() != CORDICTables::RAW_ANGLES[k]) {
+            std::cout << "  α_" << k << ": " << CORDICTables::RAW_ANGLES[k] 
+                      << " ≠ " << entry.fixed_angle.getRaw() << std::endl;
+            table_ok = false;
+        }
+    }
+    std::cout << "RAW_ANGLES == FixedPoint16(atanh(2^-k)) para k = 1.." 
+              << CORDICTables::TABLE_SIZE << ": " << (table_ok ? "✓" : "✗") << std::endl;
+    
+    std::cout << "Secuencia fija (" << CORDICTables::FIXED_SCHEDULE_LENGTH << " pasos): [";
+    for (size_t i = 0; i < CORDICTables::FIXED_SCHEDULE.size(); i++) {
+        std::cout << CORDICTables::FIXED_SCHEDULE[i] 
+                  << (i + 1 < CORDICTables::FIXED_SCHEDULE.size() ? ", " : "");
+    }
+    std::cout << "]" << std::endl;
+    std::cout << "Ganancia K = " << std::setprecision(10) << CORDICTables::FIXED_SCHEDULE_GAIN 
+              << std::endl;
+    
+    if (!table_ok) {
+        throw std::runtime_error("Tabla constexpr distinta de la tabla en tiempo de ejecución");
+    }
+}
+
+void testFixedSchedule() {
+    std::cout << "\n========== TEST: SECUENCIA FIJA DESENROLLADA ==========" << std::endl;
+    
+    // Todo el rango reducido |x'| ≤ ln(2)/2 en Q3.12
+    const int limit = static_cast<int>(CORDICConfig::CONVERGENCE_LIMIT * 4096.0) + 1;
+    double max_error_gain = 0.0;
+    double max_error_k = 0.0;
+    int max_residual = 0;
+    for (int raw = -limit; raw <= limit; raw++) {
+        CORDICRawState state(FixedPoint16(1.0f).getRaw(), 0, static_cast<int16_t>(raw));
+        CORDICIterator::performIterationsFixed(state);
+        
+        double z = raw / 4096.0;
+        double x = state.X / 4096.0;
+        double y = state.Y / 4096.0;
+        // Ganancia constante de la secuencia vs K = √(X² - Y²) por elemento
+        double exp_gain = (x + y) / CORDICTables::FIXED_SCHEDULE_GAIN;
+        double exp_k = (x + y) / std::sqrt(std::abs(x * x - y * y));
+        max_error_gain = std::max(max_error_gain, std::abs(exp_gain - std::exp(z)) / std::exp(z));
+        max_error_k = std::max(max_error_k, std::abs(exp_k - std::exp(z)) / std::exp(z));
+        max_residual = std::max(max_residual, std::abs(static_cast<int>(state.Z)));
+    }
+    
+    std::cout << "Entradas Q3.12 en [-" << limit << ", " << limit << "]" << std::endl;
+    std::cout << "  |Z| residual máximo: " << max_residual << " LSB" << std::endl;
+    std::cout << "  Error relativo máx (ganancia constante): " << std::scientific 
+              << std::setprecision(3) << max_error_gain << std::endl;
+    std::cout << "  Error relativo máx (K por elemento): " << max_error_k << std::fixed << std::endl;
+    
+    bool ok = max_residual <= 2 && max_error_gain < 5e-3 && max_error_k < 5e-3;
+    std::cout << "  " << (ok ? "✓" : "✗") << std::endl;
+    if (!ok) {
+        throw std::runtime_error("Secuencia fija fuera de tolerancia");
+    }
+}
+
+void testShortFixedSchedule() {
+    std::cout << "\n========== TEST: SECUENCIA FIJA DE N PASOS ==========" << std::endl;
+    
+    const int limit = static_cast<int>(CORDICConfig::CONVERGENCE_LIMIT * 4096.0) + 1;
+    const size_t count = static_cast<size_t>(2 * limit + 1);
+    std::vector<int16_t> xs(count), ys(count), zs(count);
+    
+    std::cout << "   N  pasos   X₀   |Z| res.   error máx e^z" << std::endl;
+    int mismatches = 0;
+    bool errors_ok = true;
+    for (int n = 1; n <= CORDICIterator::MAX_FIXED_LAST_SHIFT; n++) {
+        const int16_t x0 = CORDICIterator::fixedFoldedInitialX(n);
+        for (size_t i = 0; i < count; i++) {
+            xs[i] = x0;
+            ys[i] = 0;
+            zs[i] = static_cast<int16_t>(static_cast<int>(i) - limit);
+        }
+        CORDICIterator::performIterationsFixedBlock(xs.data(), ys.data(), zs.data(), count, n);
+        
+        double max_error = 0.0;
+        int max_residual = 0;
+        for (size_t i = 0; i < count; i++) {
+            const int raw = static_cast<int>(i) - limit;
+            CORDICRawState state(x0, 0, static_cast<int16_t>(raw));
+            CORDICIterator::performIterationsFixed(state, n);
+            if (state.X != xs[i] || state.Y != ys[i] || state.Z != zs[i] ||
+                state.iteration_count != CORDICIterator::fixedScheduleLength(n)) {
+                mismatches++;
+            }
+            const double reference = std::exp(raw / 4096.0);
+            max_error = std::max(max_error, std::abs((xs[i] + ys[i]) / 4096.0 - reference) / reference);
+            max_residual = std::max(max_residual, std::abs(static_cast<int>(zs[i])));
+        }
+        
+        // Ángulo residual ≲ α_N ≈ 2^-N, más el truncado Q3.12 acumulado
+        errors_ok = errors_ok && max_error < 1.5 * std::ldexp(1.0, -n) + 3e-3;
+        std::cout << std::setw(4) << n << std::setw(7) << CORDICIterator::fixedScheduleLength(n)
+                  << std::setw(6) << x0 << std::setw(10) << max_residual
+                  << std::setw(16) << std::scientific << std::setprecision(3) << max_error
+                  << std::fixed << std::endl;
+    }
+    
+    // N = FRAC_WIDTH es la secuencia completa de performIterationsFixed
+    int full_mismatches = 0;
+    const int full = CORDICIterator::MAX_FIXED_LAST_SHIFT;
+    for (int raw = -limit; raw <= limit; raw++) {
+        CORDICRawState reference(FixedPoint16(1.0f).getRaw(), 0, static_cast<int16_t>(raw));
+        CORDICRawState shortened = reference;
+        CORDICIterator::performIterationsFixed(reference);
+        CORDICIterator::performIterationsFixed(shortened, full);
+        if (reference.X != shortened.X || reference.Y != shortened.Y ||
+            reference.Z != shortened.Z) {
+            full_mismatches++;
+        }
+    }
+    
+    bool rejected = true;
+    for (int n : {0, CORDICIterator::MAX_FIXED_LAST_SHIFT + 1}) {
+        try {
+            CORDICIterator::fixedFoldedInitialX(n);
+            rejected = false;
+        } catch (const std::invalid_argument&) {
+        }
+    }
+    
+    std::cout << "Bloque SoA distinto del escalar: " << mismatches << std::endl;
+    std::cout << "N = " << full << " distinto de la secuencia completa: " << full_mismatches << std::endl;
+    std::cout << "N fuera de [1, " << full << "] rechazado: " << (rejected ? "sí" : "no") << std::endl;
+    
+    bool ok = mismatches == 0 && full_mismatches == 0 && errors_ok && rejected &&
+              CORDICIterator::fixedFoldedInitialX(full) == CORDICTables::FIXED_SCHEDULE_FOLDED_X0 &&
+              CORDICIterator::fixedScheduleLength(full) == CORDICTables::FIXED_SCHEDULE_LENGTH;
+    std::cout << "  " << (ok ? "✓" : "✗") << std::endl;
+    if (!ok) {
+        throw std::runtime_error("Secuencia fija de N pasos incorrecta");
+    }
+}
+
+void testTileIterations() {
+    std::cout << "\n========== TEST: ITERACIONES POR TILE SoA ==========" << std::endl;
+    
+    // Todos los Z₀ int16 en tiles completos y un último tile parcial, con
+    // X₀ = 1 y con X₀, Y₀ arbitrarios (mismo desbordamiento int16)
+    CORDICIterator iterator;
+    CORDICTileState tile;
+    int mismatches = 0;
+    int compared = 0;
+    int max_iterations = 0;
+    const int32_t total = 65536 + 37;
+    for (int variant = 0; variant < 2; variant++) {
+        for (int32_t start = 0; start < total; start += static_cast<int32_t>(CORDICTileState::SIZE)) {
+            tile.count = static_cast<size_t>(std::min<int32_t>(CORDICTileState::SIZE, total - start));
+            for (size_t i = 0; i < tile.count; i++) {
+                const int32_t n = start + static_cast<int32_t>(i);
+                tile.X[i] = variant == 0 ? FixedPoint16(1.0f).getRaw() : static_cast<int16_t>(n * 7919);
+                tile.Y[i] = variant == 0 ? 0 : static_cast<int16_t>(n * 104729);
+                tile.Z[i] = static_cast<int16_t>(n + INT16_MIN);
+            }
+            
+            CORDICRawState reference[CORDICTileState::SIZE];
+            for (size_t i = 0; i < tile.count; i++) {
+                reference[i] = CORDICRawState(tile.X[i], tile.Y[i], tile.Z[i]);
+                iterator.performIterationsFast(reference[i]);
+            }
+            iterator.performIterationsTile(tile);
+            
+            for (size_t i = 0; i < tile.count; i++) {
+                const CORDICRawState& r = reference[i];
+                if (r.X != tile.X[i] || r.Y != tile.Y[i] || r.Z != tile.Z[i] ||
+                    r.iteration_count != tile.iteration_count[i] ||
+                    r.converged != (tile.converged[i] != 0)) {
+                    mismatches++;
+                }
+                max_iterations = std::max(max_iterations, r.iteration_count);
+                compared++;
+            }
+        }
+    }
+    
+    std::cout << "Elementos comparados: " << compared << " (tiles de " << CORDICTileState::SIZE
+              << ")" << std::endl;
+    std::cout << "Iteraciones máximas por elemento: " << max_iterations << std::endl;
+    std::cout << "Distintos de performIterationsFast: " << mismatches << std::endl;
+    
+    bool ok = mismatches == 0;
+    std::cout << "  " << (ok ? "✓" : "✗") << std::endl;
+    if (!ok) {
+        throw std::runtime_error("performIterationsTile difiere de performIterationsFast");
+    }
+}
+
+void testLeadingZeroSelection() {
+    std::cout << "\n========== TEST: SELECCIÓN GREEDY POR LONGITUD EN BITS ==========" << std::endl;
+    
+    // Todos los |Z| crudos posibles (1..32768) frente al recorrido lineal
+    const AngleTable& table = AngleTable::shared();
+    int selection_mismatches = 0;
+    for (int32_t abs_z = 1; abs_z <= 32768; abs_z++) {
+        if (table.selectGreedyIndex(abs_z) != table.selectGreedyIndexScan(abs_z)) {
+            selection_mismatches++;
+        }
+    }
+    
+    // Umbrales enteros: |Z| = α_k crudo selecciona α_k y deja Z = 0
+    int exact_mismatches = 0;
+    for (int k = 1; k <= CORDICConfig::FRAC_WIDTH; k++) {
+        const int32_t raw_angle = table.getRawAngle(k);
+        if (table.getGreedyThreshold(k) != raw_angle ||
+            table.selectGreedyIndex(raw_angle) != k ||
+            (raw_angle > 1 && table.selectGreedyIndex(raw_angle - 1) <= k)) {
+            exact_mismatches++;
+        }
+    }
+    
+    // Todos los Z iniciales: mismas rotaciones con ambas selecciones
+    CORDICIterator iterator;
+    int state_mismatches = 0;
+    for (int32_t raw = INT16_MIN; raw <= INT16_MAX; raw++) {
+        CORDICRawState fast(FixedPoint16(1.0f).getRaw(), 0, static_cast<int16_t>(raw));
+        CORDICRawState scan = fast;
+        iterator.performIterationsFast(fast, CORDICGreedySelection::LEADING_ZEROS);
+        iterator.performIterationsFast(scan, CORDICGreedySelection::LINEAR_SCAN);
+        if (fast.X != scan.X || fast.Y != scan.Y || fast.Z != scan.Z ||
+            fast.iteration_count != scan.iteration_count || fast.converged != scan.converged) {
+            state_mismatches++;
+        }
+    }
+    
+    std::cout << "Candidatos por longitud en bits (b: k / umbral):" << std::endl << " ";
+    for (int b = 1; b <= AngleTable::MAX_BIT_LENGTH; b++) {
+        std::cout << " " << b << ":" << table.getGreedyCandidate(b) << "/" << table.getGreedySplit(b);
+    }
+    std::cout << std::endl;
+    std::cout << "|Z| ∈ [1, 32768] distintos del recorrido: " << selection_mismatches << std::endl;
+    std::cout << "Z₀ ∈ int16 con estado final distinto: " << state_mismatches << std::endl;
+    std::cout << "Umbrales distintos de α_k crudo: " << exact_mismatches << std::endl;
+    
+    bool ok = selection_mismatches == 0 && state_mismatches == 0 && exact_mismatches == 0;
+    std::cout << "  " << (ok ? "✓" : "✗") << std::endl;
+    if (!ok) {
+        throw std::runtime_error("La selección por longitud en bits difiere del recorrido lineal");
+    }
+}
+
 int main() {
     std::cout << "========================================" << std::endl;
     std::cout << "TEST: cordic_iterator" << std::endl;
@@ -124,6 +378,17 @@ int main() {
         // Test 3: Iteración detallada
         testIterationDetail();
         
+        // Test 4: Tablas de compilación y secuencia fija
+        testConstexprTables();
+        testFixedSchedule();
+        testShortFixedSchedule();
+        
+        // Test 5: Selección greedy sin bucle
+        testLeadingZeroSelection();
+        
+        // Test 6: Estado SoA por tiles
+        testTileIterations();
+        
         std::cout << "\n========================================" << std::endl;
         std::cout << "✅ TODOS LOS TESTS COMPLETADOS" << std::endl;
         std::cout << "========================================" << std::endl;
@@ -0,0 +1,45 @@
+/**
+ * @file test_logits.h
+ * @brief Generador de logits aleatorios y softmax de referencia compartidos por los tests
+ *
+ * Mismo generador (mt19937 + normal(0, σ)) en todos los tests: una semilla
+ * da el mismo vector en cualquiera de ellos.
+ */
+
+#ifndef CORDIC_TEST_LOGITS_H
+#define CORDIC_TEST_LOGITS_H
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <random>
+#include <vector>
+
+/**
+ * @brief size logits ~ N(0, stddev²) con semilla fija
+ */
+inline std::vector<float> randomLogits(size_t size, unsigned seed, float stddev = 3.0f) {
+    std::mt19937 gen(seed);
+    std::normal_distribution<float> dist(0.0f, stddev);
+    std::vector<float> logits(size);
+    for (float& v : logits) {
+        v = dist(gen);
+    }
+    return logits;
+}
+
+/**
+ * @brief Softmax de referencia en double (resta del máximo)
+ */
+inline void computeReferenceSoftmax(const float* logits, float* probs, size_t size) {
+    float max_logit = *std::max_element(logits, logits + size);
+    double sum = 0.0;
+    for (size_t i = 0; i < size; i++) {
+        sum += std::exp(static_cast<double>(logits[i] - max_logit));
+    }
+    for (size_t i = 0; i < size; i++) {
+        probs[i] = static_cast<float>(std::exp(static_cast<double>(logits[i] - max_logit)) / sum);
+    }
+}
+
+#endif // CORDIC_TEST_LOGITS_H
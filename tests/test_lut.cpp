@@ -0,0 +1,190 @@
+#include "cordic_lut.h"
+#include "cordic_softmax.h"
+#include <iostream>
+#include <iomanip>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+//==============================================================================
+// UTILIDADES
+//==============================================================================
+
+struct ErrorStats {
+    double max_error;
+    double mean_error;
+};
+
+/**
+ * Error relativo frente a std::exp en double sobre [-14, 5]
+ */
+template <typename ExpFunc>
+ErrorStats measureError(ExpFunc&& exp_func) {
+    ErrorStats stats{0.0, 0.0};
+    size_t count = 0;
+    for (float x = -14.0f; x <= 5.0f; x += 1e-3f) {
+        double reference = std::exp(static_cast<double>(x));
+        double error = std::abs(exp_func(x) - reference) / reference;
+        stats.max_error = std::max(stats.max_error, error);
+        stats.mean_error += error;
+        count++;
+    }
+    stats.mean_error /= count;
+    return stats;
+}
+
+//==============================================================================
+// TESTS
+//==============================================================================
+
+void testTableSizes() {
+    std::cout << "\n========== TEST: TAMAÑO DE TABLA Y COLA ==========" << std::endl;
+
+    bool ok = true;
+    std::cout << "r\tEntradas\tBytes\tIteraciones" << std::endl;
+    for (int r = 0; r <= CORDICLutExp::MAX_RESIDUAL_BITS; r++) {
+        CORDICLutExp lut(r);
+        std::cout << r << "\t" << lut.getTableEntries() << "\t\t" << lut.getTableBytes() << "\t"
+                  << lut.getTailIterations() << std::endl;
+        // Cada bit de residuo divide la tabla por 2 y añade como mucho 2 pasos
+        const size_t max_entries = static_cast<size_t>((2 * CORDICLutExp::MAX_MAPPED_RAW >> r) + 2);
+        ok = ok && lut.getTableEntries() <= max_entries && lut.getTailIterations() <= 2 * r;
+    }
+
+    bool full = CORDICLutExp(0).getTableEntries() == 2 * CORDICLutExp::MAX_MAPPED_RAW + 1 &&
+                CORDICLutExp(0).getTailIterations() == 0;
+    bool budget = CORDICLutExp::residualBitsForBudget(1 << 20) == 0 &&
+                  CORDICLutExp(CORDICLutExp::residualBitsForBudget(1024)).getTableBytes() <= 1024 &&
+                  CORDICLutExp::residualBitsForBudget(0) == CORDICLutExp::MAX_RESIDUAL_BITS;
+
+    bool throws = false;
+    try {
+        CORDICLutExp invalid(CORDICLutExp::MAX_RESIDUAL_BITS + 1);
+    } catch (const std::invalid_argument&) {
+        throws = true;
+    }
+
+    std::cout << "Tamaños: " << (ok ? "✓" : "✗") << ", tabla completa sin cola: "
+              << (full ? "✓" : "✗") << ", presupuesto: " << (budget ? "✓" : "✗")
+              << ", r inválido lanza: " << (throws ? "✓" : "✗") << std::endl;
+    if (!ok || !full || !budget || !throws) {
+        throw std::runtime_error("Configuración de tabla incorrecta");
+    }
+}
+
+void testMappedRange() {
+    std::cout << "\n========== TEST: TODOS LOS CÓDIGOS x' ==========" << std::endl;
+
+    // Cada código Q3.12 reducido, para todos los r, frente a e^x' exacto
+    double worst = 0.0;
+    for (int r = 0; r <= CORDICLutExp::MAX_RESIDUAL_BITS; r++) {
+        CORDICLutExp lut(r);
+        for (int raw = -CORDICLutExp::MAX_MAPPED_RAW; raw <= CORDICLutExp::MAX_MAPPED_RAW; raw++) {
+            double reference = std::exp(raw / 4096.0);
+            double error = std::abs(lut.expMapped(static_cast<int16_t>(raw)) - reference) / reference;
+            worst = std::max(worst, error);
+        }
+    }
+    std::cout << "Error relativo máx sobre x' exacto: " << std::scientific << std::setprecision(3)
+              << worst << std::fixed << std::endl;
+    if (worst > 1e-6) {
+        throw std::runtime_error("e^x' de tabla + cola fuera de tolerancia");
+    }
+}
+
+void testAccuracy() {
+    std::cout << "\n========== TEST: PRECISIÓN e^x ==========" << std::endl;
+
+    CORDICSoftmax cordic(false);
+    ErrorStats greedy = measureError([&](float x) { return cordic.calculateExpFast(x); });
+    std::cout << std::scientific << std::setprecision(3);
+    std::cout << "calculateExpFast:  máx " << greedy.max_error << ", medio " << greedy.mean_error
+              << std::endl;
+
+    bool ok = true;
+    for (int r : {0, 2, 4, 6, 8, 12}) {
+        CORDICLutExp lut(r);
+        ErrorStats stats = measureError([&](float x) { return lut.calculateExp(x); });
+        std::cout << "LUT r = " << std::setw(2) << r << ":       máx " << stats.max_error
+                  << ", medio " << stats.mean_error << std::endl;
+        // Solo la cuantización Q3.12 de x' (≤ 2^-12) limita el error
+        ok = ok && stats.max_error < 2.6e-4 && stats.max_error < greedy.max_error;
+    }
+
+    CORDICLutExp lut(4);
+    std::vector<float> inputs;
+    for (float x = -14.0f; x <= 5.0f; x += 0.37f) {
+        inputs.push_back(x);
+    }
+    std::vector<float> outputs(inputs.size());
+    lut.calculateExpBatch(inputs.data(), outputs.data(), inputs.size());
+    bool batch_ok = true;
+    for (size_t i = 0; i < inputs.size(); i++) {
+        batch_ok = batch_ok && outputs[i] == lut.calculateExp(inputs[i]);
+    }
+    std::cout << std::fixed << "Precisión: " << (ok ? "✓" : "✗")
+              << ", batch == escalar: " << (batch_ok ? "✓" : "✗") << std::endl;
+    if (!ok || !batch_ok) {
+        throw std::runtime_error("Precisión de la exp con tabla fuera de tolerancia");
+    }
+}
+
+void testOutOfRange() {
+    std::cout << "\n========== TEST: ENTRADAS FUERA DE [-15, 15] ==========" << std::endl;
+
+    // El preprocesador satura aquí: la LUT debe reducir antes, no saturar
+    bool finite_ok = true;
+    double worst = 0.0;
+    for (int r : {0, 4, 12}) {
+        CORDICLutExp lut(r);
+        for (float x : {-15.5f, -20.0f, -40.0f, -80.0f, 15.01f, 16.0f, 30.0f, 60.0f, 88.0f}) {
+            const double reference = std::exp(static_cast<double>(x));
+            const double error = std::abs(lut.calculateExp(x) - reference) / reference;
+            worst = std::max(worst, error);
+            finite_ok = finite_ok && error < 2.6e-4;
+        }
+    }
+
+    const float inf = std::numeric_limits<float>::infinity();
+    CORDICLutExp lut(4);
+    const bool specials_ok = lut.calculateExp(-inf) == 0.0f && lut.calculateExp(inf) == inf &&
+                             std::isnan(lut.calculateExp(std::numeric_limits<float>::quiet_NaN())) &&
+                             lut.calculateExp(-120.0f) == 0.0f && lut.calculateExp(95.0f) == inf &&
+                             lut.calculateExp(-1e30f) == 0.0f && lut.calculateExp(1e30f) == inf;
+
+    std::cout << "|x| > 15 frente a std::exp: máx " << std::scientific << std::setprecision(3)
+              << worst << std::fixed << " " << (finite_ok ? "✓" : "✗") << std::endl;
+    std::cout << "-inf → 0, +inf → inf, NaN → NaN, underflow / overflow: "
+              << (specials_ok ? "✓" : "✗") << std::endl;
+    if (!finite_ok || !specials_ok) {
+        throw std::runtime_error("e^x con tabla incorrecta fuera del rango del preprocesador");
+    }
+}
+
+//==============================================================================
+// MAIN
+//==============================================================================
+
+int main() {
+    std::cout << "========================================" << std::endl;
+    std::cout << "TEST: e^x híbrido tabla + CORDIC" << std::endl;
+    std::cout << "========================================" << std::endl;
+
+    try {
+        testTableSizes();
+        testMappedRange();
+        testAccuracy();
+        testOutOfRange();
+
+        std::cout << "\n========================================" << std::endl;
+        std::cout << "✅ TODOS LOS TESTS COMPLETADOS" << std::endl;
+        std::cout << "========================================" << std::endl;
+
+        return 0;
+
+    } catch (const std::exception& e) {
+        std::cerr << "\n❌ ERROR: " << e.what() << std::endl;
+        return 1;
+    }
+}
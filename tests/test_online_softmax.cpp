@@ -0,0 +1,234 @@
+#include "cordic_online_softmax.h"
+#include "test_logits.h"
+#include <iostream>
+#include <iomanip>
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <vector>
+
+//==============================================================================
+// UTILIDADES
+//==============================================================================
+
+struct Comparison {
+    double sum;
+    double mse;
+    double max_rel;
+};
+
+/**
+ * Compara contra otra salida. El error relativo solo se mide donde ambas
+ * referencias (máximo y k × ln2) dejan x - R dentro del rango práctico del
+ * preprocesador [-15, 15]: fuera de él la exponencial CORDIC satura.
+ */
+Comparison compare(const std::vector<float>& probs, const std::vector<float>& expected,
+                   const std::vector<float>& logits) {
+    const float max_logit = *std::max_element(logits.begin(), logits.end());
+    Comparison c{0.0, 0.0, 0.0};
+    for (size_t i = 0; i < probs.size(); i++) {
+        c.sum += probs[i];
+        double diff = probs[i] - expected[i];
+        c.mse += diff * diff;
+        if (logits[i] - max_logit > -14.0f && expected[i] > 1e-6f) {
+            c.max_rel = std::max(c.max_rel, std::abs(diff) / expected[i]);
+        }
+    }
+    c.mse /= probs.size();
+    return c;
+}
+
+//==============================================================================
+// TESTS
+//==============================================================================
+
+void testAgainstTwoPass() {
+    std::cout << "\n========== TEST: ONLINE vs DOS PASADAS ==========" << std::endl;
+
+    CORDICSoftmax cordic(false);
+
+    for (size_t vocab_size : {size_t(1), size_t(7), size_t(1000), size_t(12345), size_t(150000)}) {
+        // σ = 1.5: la fila completa cabe en el rango práctico del preprocesador
+        std::vector<float> logits = randomLogits(vocab_size, static_cast<unsigned>(vocab_size),
+                                                 1.5f);
+        std::vector<float> online(vocab_size);
+        std::vector<float> two_pass(vocab_size);
+        std::vector<float> reference(vocab_size);
+
+        cordic.computeSoftmaxOnline(logits.data(), online.data(), vocab_size);
+        cordic.computeSoftmax(logits.data(), two_pass.data(), vocab_size);
+        computeReferenceSoftmax(logits.data(), reference.data(), vocab_size);
+
+        Comparison vs_ref = compare(online, reference, logits);
+        Comparison vs_two_pass = compare(online, two_pass, logits);
+
+        // Referencia distinta (k × ln2 vs máximo): error CORDIC del mismo orden
+        bool ok = std::abs(vs_ref.sum - 1.0) < 1e-4 && vs_ref.mse < 1e-5 &&
+                  vs_two_pass.max_rel < 2e-2;
+        std::cout << "Vocabulario " << std::setw(6) << vocab_size
+                  << ": suma " << std::fixed << std::setprecision(6) << vs_ref.sum
+                  << ", MSE " << std::scientific << std::setprecision(3) << vs_ref.mse
+                  << ", error relativo vs computeSoftmax " << vs_two_pass.max_rel << " "
+                  << (ok ? "✓" : "✗") << std::endl;
+        if (!ok) {
+            throw std::runtime_error("computeSoftmaxOnline fuera de tolerancia");
+        }
+    }
+}
+
+void testChunkedInput() {
+    std::cout << "\n========== TEST: ENTRADA POR CHUNKS ==========" << std::endl;
+
+    CORDICSoftmax cordic(false);
+    const size_t vocab_size = 32000;
+    std::vector<float> logits = randomLogits(vocab_size, 7, 1.5f);
+    std::vector<float> whole(vocab_size);
+    cordic.computeSoftmaxOnline(logits.data(), whole.data(), vocab_size);
+
+    // Chunks alineados con el bloque interno: mismo resultado bit a bit
+    std::vector<float> probs(vocab_size);
+    CORDICOnlineSoftmax online(cordic, probs.data(), vocab_size);
+    for (size_t start = 0; start < vocab_size; start += 1024) {
+        online.consume(logits.data() + start, std::min<size_t>(1024, vocab_size - start));
+    }
+    online.finalize();
+    bool identical = std::equal(whole.begin(), whole.end(), probs.begin());
+    std::cout << "Chunks de 1024 idénticos a una sola llamada: "
+              << (identical ? "✓" : "✗") << std::endl;
+    if (!identical) {
+        throw std::runtime_error("La entrada por chunks cambia el resultado");
+    }
+
+    // Chunks irregulares (1, 7, 333...): misma precisión
+    std::vector<float> reference(vocab_size);
+    computeReferenceSoftmax(logits.data(), reference.data(), vocab_size);
+    const size_t pattern[] = {1, 7, 333, 4096, 2};
+    online.reset(probs.data(), vocab_size);
+    for (size_t start = 0, step = 0; start < vocab_size; step++) {
+        size_t n = std::min(pattern[step % 5], vocab_size - start);
+        online.consume(logits.data() + start, n);
+        start += n;
+    }
+    online.finalize();
+    Comparison c = compare(probs, reference, logits);
+    bool ok = std::abs(c.sum - 1.0) < 1e-4 && c.mse < 1e-5;
+    std::cout << "Chunks irregulares: suma " << std::fixed << std::setprecision(6) << c.sum
+              << ", MSE " << std::scientific << std::setprecision(3) << c.mse << " "
+              << (ok ? "✓" : "✗") << std::endl;
+    if (!ok) {
+        throw std::runtime_error("Entrada por chunks irregulares fuera de tolerancia");
+    }
+}
+
+void testGrowingMaximum() {
+    std::cout << "\n========== TEST: MÁXIMO CRECIENTE (REESCALADO) ==========" << std::endl;
+
+    CORDICSoftmax cordic(false);
+
+    // Logits crecientes: cada bloque mueve la referencia y reescala la suma
+    const size_t vocab_size = 5000;
+    std::vector<float> logits(vocab_size);
+    for (size_t i = 0; i < vocab_size; i++) {
+        logits[i] = -40.0f + 60.0f * static_cast<float>(i) / vocab_size;
+    }
+    std::vector<float> probs(vocab_size);
+    std::vector<float> reference(vocab_size);
+
+    CORDICOnlineSoftmax online(cordic, probs.data(), vocab_size);
+    int previous_exponent = 0;
+    bool monotonic = true;
+    for (size_t start = 0; start < vocab_size; start += 100) {
+        online.consume(logits.data() + start, 100);
+        monotonic = monotonic && (start == 0 || online.getReferenceExponent() >= previous_exponent);
+        previous_exponent = online.getReferenceExponent();
+    }
+    online.finalize();
+    computeReferenceSoftmax(logits.data(), reference.data(), vocab_size);
+
+    // Referencia final: k = ⌈max / ln2⌉
+    int expected_exponent = static_cast<int>(std::ceil(logits.back() * CORDICConfig::INV_LN2));
+    Comparison c = compare(probs, reference, logits);
+    bool ok = monotonic && online.getReferenceExponent() == expected_exponent &&
+              std::abs(c.sum - 1.0) < 1e-4 && c.mse < 1e-5;
+    std::cout << "Exponente final " << online.getReferenceExponent()
+              << " (esperado " << expected_exponent << "), suma "
+              << std::fixed << std::setprecision(6) << c.sum
+              << ", MSE " << std::scientific << std::setprecision(3) << c.mse << " "
+              << (ok ? "✓" : "✗") << std::endl;
+    if (!ok) {
+        throw std::runtime_error("Reescalado por máximo creciente incorrecto");
+    }
+
+    // Logits grandes: la referencia k × ln2 no desborda el cálculo
+    std::vector<float> extreme = {490.0f, 500.0f, 499.0f, 495.5f};
+    std::vector<float> extreme_probs(extreme.size());
+    std::vector<float> extreme_ref(extreme.size());
+    cordic.computeSoftmaxOnline(extreme.data(), extreme_probs.data(), extreme.size());
+    computeReferenceSoftmax(extreme.data(), extreme_ref.data(), extreme.size());
+    Comparison e = compare(extreme_probs, extreme_ref, extreme);
+    bool extreme_ok = std::abs(e.sum - 1.0) < 1e-4 && e.mse < 1e-5 && e.max_rel < 2e-2;
+    std::cout << "Logits grandes (~500): " << (extreme_ok ? "✓" : "✗") << std::endl;
+    if (!extreme_ok) {
+        throw std::runtime_error("Softmax online incorrecto con logits extremos");
+    }
+}
+
+void testErrors() {
+    std::cout << "\n========== TEST: ERRORES DE USO ==========" << std::endl;
+
+    CORDICSoftmax cordic(false);
+    std::vector<float> logits = randomLogits(16, 3);
+    std::vector<float> probs(8);
+
+    CORDICOnlineSoftmax online(cordic, probs.data(), probs.size());
+    bool capacity_caught = false;
+    try {
+        online.consume(logits.data(), 16);
+    } catch (const std::out_of_range&) {
+        capacity_caught = true;
+    }
+    std::cout << "Capacidad superada → std::out_of_range: "
+              << (capacity_caught ? "✓" : "✗") << std::endl;
+
+    online.consume(logits.data(), 8);
+    online.finalize();
+    bool finalize_caught = false;
+    try {
+        online.consume(logits.data(), 1);
+    } catch (const std::logic_error&) {
+        finalize_caught = true;
+    }
+    std::cout << "consume() tras finalize() → std::logic_error: "
+              << (finalize_caught ? "✓" : "✗") << std::endl;
+
+    if (!capacity_caught || !finalize_caught) {
+        throw std::runtime_error("CORDICOnlineSoftmax no valida su uso");
+    }
+}
+
+//==============================================================================
+// MAIN
+//==============================================================================
+
+int main() {
+    std::cout << "========================================" << std::endl;
+    std::cout << "TEST: softmax online" << std::endl;
+    std::cout << "========================================" << std::endl;
+
+    try {
+        testAgainstTwoPass();
+        testChunkedInput();
+        testGrowingMaximum();
+        testErrors();
+
+        std::cout << "\n========================================" << std::endl;
+        std::cout << "✅ TODOS LOS TESTS COMPLETADOS" << std::endl;
+        std::cout << "========================================" << std::endl;
+
+        return 0;
+
+    } catch (const std::exception& e) {
+        std::cerr << "\n❌ ERROR: " << e.what() << std::endl;
+        return 1;
+    }
+}
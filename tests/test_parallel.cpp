@@ -0,0 +1,151 @@
+#include "cordic_softmax.h"
+#include "cordic_thread_pool.h"
+#include "test_logits.h"
+#include <iostream>
+#include <iomanip>
+#include <atomic>
+#include <cmath>
+#include <cstring>
+#include <stdexcept>
+#include <vector>
+
+//==============================================================================
+// TESTS
+//==============================================================================
+
+void testThreadPool() {
+    std::cout << "\n========== TEST: POOL DE HILOS ==========" << std::endl;
+
+    for (size_t threads : {size_t(1), size_t(2), size_t(4)}) {
+        CORDICThreadPool pool(threads);
+        const size_t num_tasks = 1000;
+        std::vector<std::atomic<int>> hits(num_tasks);
+        for (auto& h : hits) {
+            h.store(0);
+        }
+
+        // Varias rondas sobre el mismo pool persistente
+        for (int round = 0; round < 5; round++) {
+            pool.parallelFor(num_tasks, [&](size_t i) { hits[i].fetch_add(1); });
+        }
+
+        bool ok = true;
+        for (auto& h : hits) {
+            ok = ok && h.load() == 5;
+        }
+        std::cout << "Hilos: " << pool.size() << " → cada tarea ejecutada 5 veces: "
+                  << (ok ? "✓" : "✗") << std::endl;
+        if (!ok) {
+            throw std::runtime_error("parallelFor no ejecutó cada tarea exactamente una vez");
+        }
+    }
+
+    // Las excepciones de una tarea se relanzan en el llamador
+    CORDICThreadPool pool(3);
+    bool caught = false;
+    try {
+        pool.parallelFor(64, [](size_t i) {
+            if (i == 17) throw std::runtime_error("fallo en tarea");
+        });
+    } catch (const std::runtime_error&) {
+        caught = true;
+    }
+    std::cout << "Excepción relanzada al llamador: " << (caught ? "✓" : "✗") << std::endl;
+    if (!caught) {
+        throw std::runtime_error("parallelFor perdió la excepción de una tarea");
+    }
+}
+
+void testDeterminism() {
+    std::cout << "\n========== TEST: DETERMINISMO vs NÚMERO DE HILOS ==========" << std::endl;
+
+    const size_t vocab_size = 150000;
+    std::vector<float> logits = randomLogits(vocab_size, 99);
+    std::vector<float> baseline(vocab_size);
+
+    CORDICSoftmax cordic(false);
+    cordic.setParallelConfig(CORDICParallelConfig(1, 4096));
+    cordic.computeSoftmaxParallel(logits.data(), baseline.data(), vocab_size);
+
+    for (size_t threads : {size_t(2), size_t(3), size_t(8)}) {
+        std::vector<float> probs(vocab_size);
+        cordic.setParallelConfig(CORDICParallelConfig(threads, 4096));
+        cordic.computeSoftmaxParallel(logits.data(), probs.data(), vocab_size);
+
+        bool identical = std::memcmp(baseline.data(), probs.data(),
+                                     vocab_size * sizeof(float)) == 0;
+        std::cout << "Hilos " << threads << " idéntico a 1 hilo: "
+                  << (identical ? "✓" : "✗") << std::endl;
+        if (!identical) {
+            throw std::runtime_error("computeSoftmaxParallel depende del número de hilos");
+        }
+    }
+}
+
+void testAccuracy() {
+    std::cout << "\n========== TEST: PRECISIÓN MODO PARALELO ==========" << std::endl;
+
+    CORDICSoftmax cordic(false);
+    cordic.setParallelConfig(CORDICParallelConfig(4, 1000));
+
+    // Tamaños límite: menor que un chunk, múltiplo exacto y resto
+    for (size_t vocab_size : {size_t(1), size_t(7), size_t(1000), size_t(12345), size_t(150000)}) {
+        std::vector<float> logits = randomLogits(vocab_size, static_cast<unsigned>(vocab_size));
+        std::vector<float> probs(vocab_size);
+        std::vector<float> serial(vocab_size);
+        std::vector<float> reference(vocab_size);
+
+        cordic.computeSoftmaxParallel(logits.data(), probs.data(), vocab_size);
+        cordic.computeSoftmax(logits.data(), serial.data(), vocab_size);
+        computeReferenceSoftmax(logits.data(), reference.data(), vocab_size);
+
+        double sum = 0.0;
+        double mse = 0.0;
+        double max_rel_serial = 0.0;
+        for (size_t i = 0; i < vocab_size; i++) {
+            sum += probs[i];
+            double diff = probs[i] - reference[i];
+            mse += diff * diff;
+            // Solo cambia el orden de la suma float: diferencia relativa pequeña
+            double rel = std::abs(probs[i] - serial[i]) / std::max(serial[i], 1e-30f);
+            max_rel_serial = std::max(max_rel_serial, rel);
+        }
+        mse /= vocab_size;
+
+        bool ok = std::abs(sum - 1.0) < 1e-4 && mse < 1e-5 && max_rel_serial < 1e-3;
+        std::cout << "Vocabulario " << std::setw(6) << vocab_size
+                  << ": suma " << std::fixed << std::setprecision(6) << sum
+                  << ", MSE " << std::scientific << std::setprecision(3) << mse
+                  << ", error relativo vs serie " << max_rel_serial << " "
+                  << (ok ? "✓" : "✗") << std::endl;
+        if (!ok) {
+            throw std::runtime_error("computeSoftmaxParallel fuera de tolerancia");
+        }
+    }
+}
+
+//==============================================================================
+// MAIN
+//==============================================================================
+
+int main() {
+    std::cout << "========================================" << std::endl;
+    std::cout << "TEST: softmax paralelo" << std::endl;
+    std::cout << "========================================" << std::endl;
+
+    try {
+        testThreadPool();
+        testDeterminism();
+        testAccuracy();
+
+        std::cout << "\n========================================" << std::endl;
+        std::cout << "✅ TODOS LOS TESTS COMPLETADOS" << std::endl;
+        std::cout << "========================================" << std::endl;
+
+        return 0;
+
+    } catch (const std::exception& e) {
+        std::cerr << "\n❌ ERROR: " << e.what() << std::endl;
+        return 1;
+    }
+}
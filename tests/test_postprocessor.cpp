@@ -2,9 +2,14 @@
 #include "cordic_preprocessor.h"
 #include "cordic_iterator.h"
 #include "cordic_postprocessor.h"
+#include "cordic_softmax.h"
+#include "cordic_format.h"
 #include <iostream>
 #include <iomanip>
 #include <cmath>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
 
 void testCompleteFlow(float input, const char* description) {
     std::cout << "\n========== Test: " << description << " ==========" << std::endl;
@@ -132,6 +137,70 @@ void testErrorAnalysis() {
     }
 }
 
+void testScaleByPowerOf2() {
+    std::cout << "\n========== TEST: 2^n POR EXPONENTE ==========" << std::endl;
+    
+    // Idéntico a ldexp en todo el rango, incluidos subnormales, 0, inf y NaN
+    const float values[] = {1.0f, 0.70710677f, 1.4142135f, 1.2345678f, -0.9f, 3.0e-39f,
+                            0.0f, std::numeric_limits<float>::infinity(),
+                            std::numeric_limits<float>::quiet_NaN()};
+    size_t mismatches = 0;
+    size_t checked = 0;
+    for (float value : values) {
+        for (int n = -160; n <= 160; n++) {
+            float expected = std::ldexp(value, n);
+            float result = CORDICPostprocessor::scaleByPowerOf2(value, n);
+            checked++;
+            if (std::memcmp(&expected, &result, sizeof(float)) != 0) {
+                mismatches++;
+            }
+        }
+    }
+    std::cout << "scaleByPowerOf2 == ldexp en " << checked << " casos: "
+              << (mismatches == 0 ? "✓" : "✗") << std::endl;
+    if (mismatches != 0) {
+        throw std::runtime_error("scaleByPowerOf2 difiere de ldexp");
+    }
+}
+
+void testFoldedGain() {
+    std::cout << "\n========== TEST: GANANCIA PLEGADA (SIN SQRT/DIV/POW) ==========" << std::endl;
+    
+    CORDICSoftmax cordic(false);
+    double max_folded = 0.0;
+    double max_fast = 0.0;
+    double mean_folded = 0.0;
+    size_t count = 0;
+    for (float x = -15.0f; x <= 15.0f; x += 1e-3f) {
+        double reference = std::exp(static_cast<double>(x));
+        double folded = std::abs(cordic.calculateExpFolded(x) - reference) / reference;
+        double fast = std::abs(cordic.calculateExpFast(x) - reference) / reference;
+        max_folded = std::max(max_folded, folded);
+        max_fast = std::max(max_fast, fast);
+        mean_folded += folded;
+        count++;
+    }
+    mean_folded /= count;
+    
+    double max_q229 = 0.0;
+    for (float x = -30.0f; x <= 30.0f; x += 1e-3f) {
+        double reference = std::exp(static_cast<double>(x));
+        max_q229 = std::max(max_q229, std::abs(CORDICFormatQ2_29::expFolded(x) - reference) / reference);
+    }
+    
+    std::cout << "X₀ = 1/K en Q3.12: " << CORDICTables::FIXED_SCHEDULE_FOLDED_X0 << std::endl;
+    std::cout << std::scientific << std::setprecision(3);
+    std::cout << "Q3.12 plegada: error máx " << max_folded << ", medio " << mean_folded 
+              << " (greedy + K: máx " << max_fast << ")" << std::endl;
+    std::cout << "Q2.29 plegada: error máx " << max_q229 << std::fixed << std::endl;
+    
+    bool ok = max_folded < 5e-3 && max_q229 < 2e-7;
+    std::cout << (ok ? "✓" : "✗") << std::endl;
+    if (!ok) {
+        throw std::runtime_error("Postprocesado con ganancia plegada fuera de tolerancia");
+    }
+}
+
 int main() {
     std::cout << "========================================" << std::endl;
     std::cout << "TEST: cordic_postprocessor" << std::endl;
@@ -151,6 +220,10 @@ int main() {
         // Análisis de error extensivo
         testErrorAnalysis();
         
+        // Postprocesado sin sqrt, divisiones ni pow
+        testScaleByPowerOf2();
+        testFoldedGain();
+        
         std::cout << "\n========================================" << std::endl;
         std::cout << "✅ TODOS LOS TESTS COMPLETADOS" << std::endl;
         std::cout << "========================================" << std::endl;
@@ -0,0 +1,278 @@
+#include "cordic_sampling.h"
+#include "test_logits.h"
+#include <iostream>
+#include <iomanip>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+//==============================================================================
+// UTILIDADES
+//==============================================================================
+
+/**
+ * Mayor error relativo entre probabilidades de dos conjuntos con mismos índices
+ */
+double maxRelativeDifference(const CORDICCandidates& a, const CORDICCandidates& b) {
+    double worst = 0.0;
+    for (size_t i = 0; i < a.size(); i++) {
+        worst = std::max(worst, std::abs(static_cast<double>(a.probabilities[i]) -
+                                         b.probabilities[i]) / b.probabilities[i]);
+    }
+    return worst;
+}
+
+/**
+ * Orden descendente de probabilidad, empates por logit y luego índice
+ */
+bool isProbabilityOrdered(const CORDICCandidates& c, const std::vector<float>& logits) {
+    for (size_t i = 1; i < c.size(); i++) {
+        const float p0 = c.probabilities[i - 1];
+        const float p1 = c.probabilities[i];
+        const float l0 = logits[c.indices[i - 1]];
+        const float l1 = logits[c.indices[i]];
+        if (p0 < p1 || (p0 == p1 && (l0 < l1 || (l0 == l1 && c.indices[i - 1] > c.indices[i])))) {
+            return false;
+        }
+    }
+    return true;
+}
+
+//==============================================================================
+// TESTS
+//==============================================================================
+
+void testFusedMatchesExact() {
+    std::cout << "\n========== TEST: FUSIONADO == SOFTMAX COMPLETO + FILTRO ==========" << std::endl;
+
+    CORDICSoftmax cordic(false);
+    CORDICTopKSampler sampler(cordic);
+    CORDICCandidates fused;
+    CORDICCandidates exact;
+
+    const size_t vocab_sizes[] = {1000, 32000, 128000};
+    const CORDICSamplingParams configs[] = {
+        CORDICSamplingParams(40, 1.0f),
+        CORDICSamplingParams(40, 0.9f),
+        CORDICSamplingParams(1, 1.0f),
+        CORDICSamplingParams(200, 0.5f, 3),
+    };
+
+    bool all_ok = true;
+    unsigned seed = 1;
+    for (size_t vocab : vocab_sizes) {
+        for (const CORDICSamplingParams& params : configs) {
+            // σ = 1.5: el rango de la fila queda dentro del de la exp CORDIC
+            std::vector<float> logits = randomLogits(vocab, seed++, 1.5f);
+            size_t n_fused = sampler.select(logits.data(), vocab, params, fused);
+            size_t n_exact = sampler.select(logits.data(), vocab, params, exact,
+                                            CORDICSamplingMode::EXACT);
+
+            bool same_set = n_fused == n_exact && fused.indices == exact.indices;
+            double diff = same_set ? maxRelativeDifference(fused, exact) : 1.0;
+            float sum = 0.0f;
+            for (float p : fused.probabilities) {
+                sum += p;
+            }
+            bool bound_ok = fused.tail_mass >= exact.tail_mass * (1.0f - 1e-4f);
+            bool ok = same_set && diff < 1e-5 && std::abs(sum - 1.0f) < 1e-5f && bound_ok &&
+                      n_fused >= params.min_keep;
+            all_ok = all_ok && ok;
+
+            std::cout << "V = " << std::setw(6) << vocab << ", k = " << std::setw(3) << params.top_k
+                      << ", p = " << std::fixed << std::setprecision(2) << params.top_p
+                      << ": " << std::setw(3) << n_fused << " candidatos, Δp "
+                      << std::scientific << std::setprecision(2) << diff
+                      << ", masa fuera " << exact.tail_mass << " ≤ cota " << fused.tail_mass
+                      << std::fixed << " " << (ok ? "✓" : "✗") << std::endl;
+        }
+    }
+    if (!all_ok) {
+        throw std::runtime_error("El modo fusionado difiere de softmax completo + filtro");
+    }
+}
+
+void testWideRows() {
+    std::cout << "\n========== TEST: FILAS ANCHAS (INVERSIONES DE LA EXP) ==========" << std::endl;
+
+    // σ = 1.75 / 2: muchos candidatos a pocos códigos Q3.12 entre sí, donde la
+    // exp CORDIC invierte el orden de los logits
+    CORDICSoftmax cordic(false);
+    CORDICTopKSampler sampler(cordic);
+    CORDICCandidates fused;
+    CORDICCandidates exact;
+    const size_t vocab = 5000;
+    const CORDICSamplingParams params(40, 0.9f);
+
+    size_t rows = 0;
+    size_t inverted = 0;
+    size_t mismatches = 0;
+    bool ordered = true;
+    // Las filas de σ = 2 suelen superar un rango de 15 (cola reducida por 2^n)
+    for (unsigned seed = 100; seed < 500; seed++) {
+        std::vector<float> logits = randomLogits(vocab, seed, seed % 2 == 0 ? 1.75f : 2.0f);
+        rows++;
+        sampler.select(logits.data(), vocab, params, fused);
+        sampler.select(logits.data(), vocab, params, exact, CORDICSamplingMode::EXACT);
+
+        ordered = ordered && isProbabilityOrdered(fused, logits) &&
+                  isProbabilityOrdered(exact, logits);
+        for (size_t i = 1; i < fused.size(); i++) {
+            if (logits[fused.indices[i - 1]] < logits[fused.indices[i]]) {
+                inverted++;
+                break;
+            }
+        }
+        if (fused.indices != exact.indices || maxRelativeDifference(fused, exact) >= 1e-5) {
+            mismatches++;
+        }
+    }
+
+    std::cout << rows << " filas, " << inverted << " con orden por logit ≠ orden por probabilidad"
+              << std::endl;
+    std::cout << "Orden por probabilidad (empates por logit e índice): " << (ordered ? "✓" : "✗")
+              << ", fusionado = exacto: " << rows - mismatches << " / " << rows << " "
+              << (mismatches == 0 ? "✓" : "✗") << std::endl;
+    if (!ordered || mismatches != 0 || inverted == 0) {
+        throw std::runtime_error("Orden de candidatos incorrecto en filas anchas");
+    }
+}
+
+void testMaskedLogits() {
+    std::cout << "\n========== TEST: LOGITS ENMASCARADOS Y LEJANOS ==========" << std::endl;
+
+    CORDICSoftmax cordic(false);
+    CORDICTopKSampler sampler(cordic);
+    CORDICCandidates fused;
+    CORDICCandidates exact;
+    const float neg_inf = -std::numeric_limits<float>::infinity();
+
+    // 3 logits finitos (uno a 25 del máximo) y 97 enmascarados, k = 40 > 3
+    std::vector<float> logits(100, neg_inf);
+    logits[0] = 5.0f;
+    logits[1] = 4.0f;
+    logits[2] = -20.0f;
+    const CORDICSamplingParams params(40, 1.0f);
+    const size_t n_fused = sampler.select(logits.data(), logits.size(), params, fused);
+    const size_t n_exact = sampler.select(logits.data(), logits.size(), params, exact,
+                                          CORDICSamplingMode::EXACT);
+
+    // Referencia en double: e^(x - 5) normalizado sobre los 3 finitos
+    const double e1 = std::exp(-1.0);
+    const double e2 = std::exp(-25.0);
+    const double total = 1.0 + e1 + e2;
+    const bool masked_ok = n_fused == 3 && n_exact == 3 &&
+                           fused.indices == std::vector<int32_t>{0, 1, 2} &&
+                           exact.indices == fused.indices &&
+                           fused.tail_mass == 0.0f && exact.tail_mass == 0.0f;
+    const double far_error = std::abs(fused.probabilities[2] - e2 / total) / (e2 / total);
+    const bool far_ok = far_error < 1e-3 &&
+                        std::abs(fused.probabilities[1] - e1 / total) < 1e-3 &&
+                        maxRelativeDifference(fused, exact) < 1e-5;
+
+    // Con más finitos que k: los -inf no cuentan en la cota de la cola
+    logits.assign(100, neg_inf);
+    for (size_t i = 0; i < 60; i++) {
+        logits[i] = -0.1f * static_cast<float>(i);
+    }
+    sampler.select(logits.data(), logits.size(), params, fused);
+    sampler.select(logits.data(), logits.size(), params, exact, CORDICSamplingMode::EXACT);
+    const bool tail_ok = fused.size() == 40 && exact.indices == fused.indices &&
+                         fused.tail_mass >= exact.tail_mass * (1.0f - 1e-4f) &&
+                         fused.tail_mass <= 20.0f / 60.0f;
+
+    std::cout << "-inf fuera de los candidatos (k = 40 > 3 finitos), cola 0: "
+              << (masked_ok ? "✓" : "✗") << std::endl;
+    std::cout << "x - max = -25 sin saturar (error relativo " << std::scientific
+              << std::setprecision(2) << far_error << std::fixed << "), fusionado = exacto: "
+              << (far_ok ? "✓" : "✗") << std::endl;
+    std::cout << "Cota de la cola sin los -inf: " << (tail_ok ? "✓" : "✗") << std::endl;
+    if (!masked_ok || !far_ok || !tail_ok) {
+        throw std::runtime_error("Logits enmascarados o lejanos con probabilidad incorrecta");
+    }
+}
+
+void testEdgeCases() {
+    std::cout << "\n========== TEST: CASOS LÍMITE ==========" << std::endl;
+
+    CORDICSoftmax cordic(false);
+    CORDICTopKSampler sampler(cordic);
+    CORDICCandidates out;
+
+    // top_k = 0 y top_k > N: vocabulario completo, igual a computeSoftmax en orden
+    std::vector<float> logits = {0.5f, 2.0f, -1.0f, 2.0f, 1.0f};
+    std::vector<float> probs(logits.size());
+    cordic.computeSoftmax(logits.data(), probs.data(), logits.size());
+    size_t n = sampler.select(logits.data(), logits.size(), CORDICSamplingParams(0, 1.0f), out);
+    bool full = n == 5 && out.indices == std::vector<int32_t>{1, 3, 4, 0, 2} &&
+                std::abs(out.probabilities[0] - probs[1]) < 1e-6f && out.tail_mass == 0.0f;
+    n = sampler.select(logits.data(), logits.size(), CORDICSamplingParams(100, 1.0f), out);
+    full = full && n == 5;
+
+    // Empates: índice menor primero; NaN como -inf
+    std::vector<float> with_nan = {NAN, 1.0f, 1.0f, -3.0f};
+    n = sampler.select(with_nan.data(), with_nan.size(), CORDICSamplingParams(2, 1.0f), out);
+    bool ties = n == 2 && out.indices == std::vector<int32_t>{1, 2} &&
+                out.probabilities[0] == out.probabilities[1];
+
+    // top-p muy bajo: solo el más probable, salvo min_keep
+    n = sampler.select(logits.data(), logits.size(), CORDICSamplingParams(0, 0.01f), out);
+    bool nucleus = n == 1 && out.indices[0] == 1 && out.probabilities[0] == 1.0f;
+    n = sampler.select(logits.data(), logits.size(), CORDICSamplingParams(0, 0.01f, 3), out);
+    nucleus = nucleus && n == 3;
+
+    bool throws = false;
+    try {
+        sampler.select(logits.data(), 0, CORDICSamplingParams(), out);
+    } catch (const std::invalid_argument&) {
+        throws = true;
+    }
+
+    // API C con contexto
+    llama_cordic_context* ctx = llama_cordic_context_create(1);
+    int32_t ids[3];
+    float p[3];
+    size_t n_c = llama_cordic_ctx_top_k_top_p(ctx, logits.data(), logits.size(), 3, 1.0f, ids, p);
+    bool c_api = n_c == 3 && ids[0] == 1 && ids[1] == 3 && ids[2] == 4 &&
+                 std::abs(p[0] + p[1] + p[2] - 1.0f) < 1e-6f &&
+                 llama_cordic_ctx_top_k_top_p(ctx, logits.data(), 0, 3, 1.0f, ids, p) == 0;
+    llama_cordic_context_free(ctx);
+
+    std::cout << "Vocabulario completo: " << (full ? "✓" : "✗")
+              << ", empates y NaN: " << (ties ? "✓" : "✗")
+              << ", top-p / min_keep: " << (nucleus ? "✓" : "✗")
+              << ", vacío lanza: " << (throws ? "✓" : "✗")
+              << ", API C: " << (c_api ? "✓" : "✗") << std::endl;
+    if (!full || !ties || !nucleus || !throws || !c_api) {
+        throw std::runtime_error("Casos límite del muestreo incorrectos");
+    }
+}
+
+//==============================================================================
+// MAIN
+//==============================================================================
+
+int main() {
+    std::cout << "========================================" << std::endl;
+    std::cout << "TEST: softmax fusionado con top-k / top-p" << std::endl;
+    std::cout << "========================================" << std::endl;
+
+    try {
+        testFusedMatchesExact();
+        testWideRows();
+        testMaskedLogits();
+        testEdgeCases();
+
+        std::cout << "\n========================================" << std::endl;
+        std::cout << "✅ TODOS LOS TESTS COMPLETADOS" << std::endl;
+        std::cout << "========================================" << std::endl;
+
+        return 0;
+
+    } catch (const std::exception& e) {
+        std::cerr << "\n❌ ERROR: " << e.what() << std::endl;
+        return 1;
+    }
+}
@@ -0,0 +1,261 @@
+#include "cordic_softmax.h"
+#include "cordic_simd.h"
+#include <iostream>
+#include <iomanip>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+//==============================================================================
+// UTILIDADES
+//==============================================================================
+
+std::vector<float> buildInputs() {
+    std::vector<float> inputs;
+
+    // Barrido denso de [-20, 20]: saturación, mapeo y rango directo
+    for (int i = -200000; i <= 200000; i++) {
+        inputs.push_back(i * 1e-4f);
+    }
+
+    // Logits estabilizados aleatorios
+    std::mt19937 gen(1234);
+    std::normal_distribution<float> dist(0.0f, 4.0f);
+    for (int i = 0; i < 50000; i++) {
+        inputs.push_back(dist(gen));
+    }
+
+    // Valores especiales y fronteras
+    const float specials[] = {
+        std::numeric_limits<float>::infinity(), -std::numeric_limits<float>::infinity(),
+        std::numeric_limits<float>::quiet_NaN(), 15.0f, -15.0f, 15.0001f, -15.0001f,
+        8.0f, -8.0f, 0.34657359f, -0.34657359f, 0.3465736f, -0.3465736f, 0.0f, -0.0f,
+        std::numeric_limits<float>::denorm_min(), 1e-30f, -1e-30f
+    };
+    for (float v : specials) {
+        inputs.push_back(v);
+    }
+
+    return inputs;
+}
+
+//==============================================================================
+// TESTS
+//==============================================================================
+
+void testKernelDetection() {
+    std::cout << "\n========== TEST: DETECCIÓN DE KERNEL ==========" << std::endl;
+
+    const CORDICKernel kernels[] = {CORDICKernel::SCALAR, CORDICKernel::SSE41, CORDICKernel::AVX2,
+                                    CORDICKernel::AVX512, CORDICKernel::NEON};
+    std::cout << "Kernel activo: " << CORDICSIMD::kernelName(CORDICSIMD::activeKernel())
+              << (CORDICSIMD::isKernelForced() ? " (CORDIC_BACKEND)" : "") << std::endl;
+    for (CORDICKernel kernel : kernels) {
+        std::cout << "  " << std::left << std::setw(8) << CORDICSIMD::kernelName(kernel)
+                  << (CORDICSIMD::isKernelSupported(kernel) ? "soportado" : "no disponible")
+                  << std::endl;
+    }
+
+    if (!CORDICSIMD::isKernelSupported(CORDICSIMD::activeKernel())) {
+        throw std::runtime_error("El kernel activo no está soportado");
+    }
+    std::cout << "✓ Detección consistente" << std::endl;
+}
+
+void testBackendSelection() {
+    std::cout << "\n========== TEST: SELECCIÓN DE BACKEND (CORDIC_BACKEND) ==========" << std::endl;
+
+    // Vacío / nullptr = automático (mejor kernel soportado)
+    const CORDICKernel automatic = CORDICSIMD::selectKernel(nullptr);
+    bool ok = CORDICSIMD::selectKernel("") == automatic &&
+              CORDICSIMD::selectKernel("scalar") == CORDICKernel::SCALAR;
+    for (CORDICKernel kernel : {CORDICKernel::SSE41, CORDICKernel::AVX2, CORDICKernel::AVX512,
+                                CORDICKernel::NEON}) {
+        if (CORDICSIMD::isKernelSupported(kernel)) {
+            ok = ok && CORDICSIMD::selectKernel(CORDICSIMD::kernelName(kernel)) == kernel &&
+                 static_cast<int>(kernel) <= static_cast<int>(automatic);
+        } else {
+            bool rejected = false;
+            try {
+                CORDICSIMD::selectKernel(CORDICSIMD::kernelName(kernel));
+            } catch (const std::invalid_argument&) {
+                rejected = true;
+            }
+            ok = ok && rejected;
+        }
+    }
+    bool unknown_rejected = false;
+    try {
+        CORDICSIMD::selectKernel("avx1024");
+    } catch (const std::invalid_argument&) {
+        unknown_rejected = true;
+    }
+
+    std::cout << "Automático: " << CORDICSIMD::kernelName(automatic) << std::endl;
+    std::cout << "Backends soportados seleccionables, no soportados rechazados: "
+              << (ok ? "✓" : "✗") << std::endl;
+    std::cout << "Nombre desconocido → std::invalid_argument: " << (unknown_rejected ? "✓" : "✗")
+              << std::endl;
+    if (!ok || !unknown_rejected) {
+        throw std::runtime_error("CORDICSIMD::selectKernel incorrecto");
+    }
+}
+
+void testKernelBitExact(CORDICKernel kernel) {
+    std::cout << "\n========== TEST: KERNEL " << CORDICSIMD::kernelName(kernel)
+              << " vs calculateExpFast ==========" << std::endl;
+
+    if (!CORDICSIMD::isKernelSupported(kernel)) {
+        std::cout << "Kernel no disponible en esta CPU, omitido" << std::endl;
+        return;
+    }
+
+    CORDICSoftmax cordic(false);
+    CORDICIterator iterator;
+    CORDICKernelTables tables(iterator.getAngleTable());
+
+    std::vector<float> inputs = buildInputs();
+    std::vector<float> outputs(inputs.size());
+
+    if (!CORDICSIMD::runKernel(kernel, tables, inputs.data(), outputs.data(), inputs.size())) {
+        throw std::runtime_error("runKernel rechazó un kernel soportado");
+    }
+
+    size_t mismatches = 0;
+    for (size_t i = 0; i < inputs.size(); i++) {
+        float expected = cordic.calculateExpFast(inputs[i]);
+        if (std::memcmp(&expected, &outputs[i], sizeof(float)) != 0) {
+            if (mismatches < 5) {
+                std::cout << "  ✗ x = " << inputs[i] << ": escalar " << expected
+                          << ", SIMD " << outputs[i] << std::endl;
+            }
+            mismatches++;
+        }
+    }
+
+    std::cout << "Entradas comparadas: " << inputs.size() << std::endl;
+    std::cout << "Diferencias bit a bit: " << mismatches << std::endl;
+    if (mismatches != 0) {
+        throw std::runtime_error("El kernel SIMD difiere de la ruta escalar");
+    }
+
+    // Colas de tamaño no múltiplo de 8 / 16 y salida en el sitio
+    for (size_t size : {size_t(1), size_t(15), size_t(17), size_t(33)}) {
+        std::vector<float> in_place(inputs.begin() + 1000, inputs.begin() + 1000 + size);
+        CORDICSIMD::runKernel(kernel, tables, in_place.data(), in_place.data(), size);
+        for (size_t i = 0; i < size; i++) {
+            float expected = cordic.calculateExpFast(inputs[1000 + i]);
+            if (std::memcmp(&expected, &in_place[i], sizeof(float)) != 0) {
+                throw std::runtime_error("Cola / en el sitio incorrecta en kernel SIMD");
+            }
+        }
+    }
+    std::cout << "✓ Colas (1, 15, 17, 33) y ejecución en el sitio correctas" << std::endl;
+    std::cout << "✅ KERNEL " << CORDICSIMD::kernelName(kernel) << " IDÉNTICO BIT A BIT" << std::endl;
+}
+
+void testScalarKernelRejected() {
+    std::cout << "\n========== TEST: KERNEL ESCALAR ==========" << std::endl;
+
+    CORDICIterator iterator;
+    CORDICKernelTables tables(iterator.getAngleTable());
+    float in = 1.0f;
+    float out = -1.0f;
+
+    bool ran = CORDICSIMD::runKernel(CORDICKernel::SCALAR, tables, &in, &out, 1);
+    std::cout << "runKernel(SCALAR) devuelve false y no escribe: "
+              << (!ran && out == -1.0f ? "✓" : "✗") << std::endl;
+    if (ran || out != -1.0f) {
+        throw std::runtime_error("runKernel(SCALAR) no debe ejecutar nada");
+    }
+}
+
+void testBatchAPI() {
+    std::cout << "\n========== TEST: calculateExpBatch / computeSoftmax ==========" << std::endl;
+
+    CORDICSoftmax cordic(false);
+    std::vector<float> inputs = buildInputs();
+    std::vector<float> outputs(inputs.size());
+
+    cordic.calculateExpBatch(inputs.data(), outputs.data(), inputs.size());
+
+    size_t mismatches = 0;
+    for (size_t i = 0; i < inputs.size(); i++) {
+        float expected = cordic.calculateExpFast(inputs[i]);
+        if (std::memcmp(&expected, &outputs[i], sizeof(float)) != 0) {
+            mismatches++;
+        }
+    }
+    std::cout << "calculateExpBatch (" << CORDICSIMD::kernelName(CORDICSoftmax::getActiveKernel())
+              << "): " << mismatches << " diferencias" << std::endl;
+    if (mismatches != 0) {
+        throw std::runtime_error("calculateExpBatch difiere de calculateExpFast");
+    }
+
+    // computeSoftmax por bloques debe coincidir con el bucle escalar original
+    std::mt19937 gen(7);
+    std::normal_distribution<float> dist(0.0f, 3.0f);
+    std::vector<float> logits(1000);
+    for (float& v : logits) {
+        v = dist(gen);
+    }
+    std::vector<float> probs(logits.size());
+    cordic.computeSoftmax(logits.data(), probs.data(), logits.size());
+
+    float max_logit = *std::max_element(logits.begin(), logits.end());
+    std::vector<float> expected(logits.size());
+    float sum = 0.0f;
+    for (size_t i = 0; i < logits.size(); i++) {
+        // Bajo -15 (σ = 3: cola de la fila) se reduce por 2^n en vez de saturar
+        float x = logits[i] - max_logit;
+        int n = 0;
+        if (x < -15.0f) {
+            n = static_cast<int>(std::ceil(x * CORDICConfig::INV_LN2));
+            x = static_cast<float>(x - n * CORDICConfig::LN2);
+        }
+        expected[i] = std::ldexp(cordic.calculateExpFast(x), n);
+        sum += expected[i];
+    }
+    float inv_sum = 1.0f / sum;
+    for (size_t i = 0; i < logits.size(); i++) {
+        expected[i] *= inv_sum;
+    }
+    if (std::memcmp(expected.data(), probs.data(), probs.size() * sizeof(float)) != 0) {
+        throw std::runtime_error("computeSoftmax por bloques difiere del bucle escalar");
+    }
+    std::cout << "✓ computeSoftmax idéntico al bucle escalar" << std::endl;
+}
+
+//==============================================================================
+// MAIN
+//==============================================================================
+
+int main() {
+    std::cout << "========================================" << std::endl;
+    std::cout << "TEST: cordic_simd" << std::endl;
+    std::cout << "========================================" << std::endl;
+
+    try {
+        testKernelDetection();
+        testBackendSelection();
+        testScalarKernelRejected();
+        testKernelBitExact(CORDICKernel::SSE41);
+        testKernelBitExact(CORDICKernel::AVX2);
+        testKernelBitExact(CORDICKernel::AVX512);
+        testKernelBitExact(CORDICKernel::NEON);
+        testBatchAPI();
+
+        std::cout << "\n========================================" << std::endl;
+        std::cout << "✅ TODOS LOS TESTS COMPLETADOS" << std::endl;
+        std::cout << "========================================" << std::endl;
+
+        return 0;
+
+    } catch (const std::exception& e) {
+        std::cerr << "\n❌ ERROR: " << e.what() << std::endl;
+        return 1;
+    }
+}
@@ -3,7 +3,12 @@
 #include <iomanip>
 #include <cmath>
 #include <vector>
+#include <algorithm>
 #include <random>
+#include <chrono>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
 
 //==============================================================================
 // UTILIDADES
@@ -86,6 +91,164 @@ void testCORDICExp() {
     }
 }
 
+void testFastPathBitExact() {
+    std::cout << "\n========== TEST: RUTA RÁPIDA vs PIPELINE COMPLETO ==========" << std::endl;
+    
+    CORDICSoftmax cordic(false);
+    CORDICIterator iterator;
+    
+    // Barrido denso de [-20, 20] (incluye saturación) y valores especiales
+    std::vector<float> inputs;
+    for (int i = -200000; i <= 200000; i++) {
+        inputs.push_back(i * 1e-4f);
+    }
+    inputs.push_back(std::numeric_limits<float>::infinity());
+    inputs.push_back(-std::numeric_limits<float>::infinity());
+    inputs.push_back(std::numeric_limits<float>::quiet_NaN());
+    
+    size_t mismatches = 0;
+    for (float x : inputs) {
+        PreprocessResult prep = CORDICPreprocessor::processInput(x, false);
+        CORDICState initial = CORDICPreprocessor::initializeCORDICState(prep);
+        IterationResult iter_result = iterator.performIterations(initial, false);
+        PostprocessResult post = CORDICPostprocessor::processResults(iter_result, prep, false);
+        
+        float fast = cordic.calculateExpFast(x);
+        if (std::memcmp(&fast, &post.exponential_value, sizeof(float)) != 0) {
+            if (mismatches < 5) {
+                std::cout << "  ✗ x = " << x << ": pipeline " << post.exponential_value 
+                          << ", rápida " << fast << std::endl;
+            }
+            mismatches++;
+        }
+    }
+    
+    // Ruta portable por tiles SoA (en sitio) frente a la ruta rápida escalar
+    std::vector<float> tiled(inputs);
+    cordic.calculateExpBatchTiled(tiled.data(), tiled.data(), tiled.size());
+    size_t tile_mismatches = 0;
+    for (size_t i = 0; i < inputs.size(); i++) {
+        float fast = cordic.calculateExpFast(inputs[i]);
+        if (std::memcmp(&fast, &tiled[i], sizeof(float)) != 0) {
+            tile_mismatches++;
+        }
+    }
+    
+    std::cout << "Entradas comparadas: " << inputs.size() << std::endl;
+    std::cout << "Diferencias bit a bit: " << mismatches << std::endl;
+    std::cout << "Diferencias tiles SoA vs rápida: " << tile_mismatches << std::endl;
+    
+    if (mismatches != 0) {
+        throw std::runtime_error("calculateExpFast difiere del pipeline completo");
+    }
+    if (tile_mismatches != 0) {
+        throw std::runtime_error("calculateExpBatchTiled difiere de calculateExpFast");
+    }
+    std::cout << "✅ TEST RUTA RÁPIDA PASÓ" << std::endl;
+}
+
+void testFixedScheduleMode() {
+    std::cout << "\n========== TEST: MODO SECUENCIA FIJA vs GREEDY ==========" << std::endl;
+    
+    // Exponentes estabilizados de softmax: x - max ∈ [-15, 0]
+    std::vector<float> inputs;
+    for (int i = -150000; i <= 0; i++) {
+        inputs.push_back(i * 1e-4f);
+    }
+    std::vector<float> outputs(inputs.size());
+    
+    CORDICSoftmax greedy(false);
+    double greedy_max = 0.0;
+    double greedy_mean = 0.0;
+    for (float x : inputs) {
+        const double reference = std::exp(static_cast<double>(x));
+        const double error = std::abs(greedy.calculateExpFast(x) - reference) / reference;
+        greedy_max = std::max(greedy_max, error);
+        greedy_mean += error;
+    }
+    greedy_mean /= inputs.size();
+    
+    std::cout << "Greedy: error máx " << std::scientific << std::setprecision(3) << greedy_max
+              << ", medio " << greedy_mean << std::fixed << std::endl;
+    std::cout << "   N  pasos   error máx   error medio   ≠ calculateExpFolded(x, N)" << std::endl;
+    
+    CORDICSoftmax fixed(false);
+    size_t mismatches = 0;
+    double full_max = 0.0;
+    for (int n = 1; n <= CORDICIterator::MAX_FIXED_LAST_SHIFT; n++) {
+        fixed.setRotationConfig(CORDICRotationConfig(CORDICRotationMode::FIXED_SCHEDULE, n));
+        fixed.calculateExpBatchFast(inputs.data(), outputs.data(), inputs.size());
+        
+        double max_error = 0.0;
+        double mean_error = 0.0;
+        size_t n_mismatches = 0;
+        for (size_t i = 0; i < inputs.size(); i++) {
+            const float scalar = fixed.calculateExpFolded(inputs[i], n);
+            if (std::memcmp(&scalar, &outputs[i], sizeof(float)) != 0) {
+                n_mismatches++;
+            }
+            const double reference = std::exp(static_cast<double>(inputs[i]));
+            const double error = std::abs(outputs[i] - reference) / reference;
+            max_error = std::max(max_error, error);
+            mean_error += error;
+        }
+        mean_error /= inputs.size();
+        mismatches += n_mismatches;
+        full_max = max_error;
+        
+        std::cout << std::setw(4) << n << std::setw(7) << CORDICIterator::fixedScheduleLength(n)
+                  << std::scientific << std::setprecision(3) << std::setw(12) << max_error
+                  << std::setw(14) << mean_error << std::fixed << std::setw(8) << n_mismatches
+                  << std::endl;
+    }
+    
+    // N completo: mismos bits que la ruta plegada y softmax dentro de tolerancia
+    const int full = CORDICIterator::MAX_FIXED_LAST_SHIFT;
+    size_t folded_mismatches = 0;
+    for (size_t i = 0; i < inputs.size(); i += 97) {
+        const float a = fixed.calculateExpFolded(inputs[i]);
+        const float b = fixed.calculateExp(inputs[i]);
+        if (std::memcmp(&a, &b, sizeof(float)) != 0) {
+            folded_mismatches++;
+        }
+    }
+    
+    std::mt19937 gen(7);
+    std::normal_distribution<float> dist(0.0f, 1.5f);
+    std::vector<float> logits(4096);
+    for (float& v : logits) {
+        v = dist(gen);
+    }
+    std::vector<float> probs(logits.size());
+    std::vector<float> reference(logits.size());
+    fixed.computeSoftmax(logits.data(), probs.data(), logits.size());
+    computeReferenceSoftmax(logits.data(), reference.data(), logits.size());
+    double softmax_error = 0.0;
+    for (size_t i = 0; i < logits.size(); i++) {
+        softmax_error = std::max(softmax_error,
+                                 static_cast<double>(std::abs(probs[i] - reference[i]) / reference[i]));
+    }
+    
+    bool rejected = false;
+    try {
+        fixed.setRotationConfig(CORDICRotationConfig(CORDICRotationMode::FIXED_SCHEDULE, 0));
+    } catch (const std::invalid_argument&) {
+        rejected = fixed.getRotationConfig().fixed_last_shift == full;
+    }
+    
+    std::cout << "calculateExp (N = " << full << ") ≠ calculateExpFolded: " << folded_mismatches << std::endl;
+    std::cout << "Softmax N = " << full << ", 4096 logits: error relativo máx "
+              << std::scientific << std::setprecision(3) << softmax_error << std::fixed << std::endl;
+    std::cout << "N = 0 rechazado sin cambiar la configuración: " << (rejected ? "sí" : "no") << std::endl;
+    
+    bool ok = mismatches == 0 && folded_mismatches == 0 && rejected &&
+              full_max < 5e-3 && softmax_error < 1e-2;
+    std::cout << "  " << (ok ? "✓" : "✗") << std::endl;
+    if (!ok) {
+        throw std::runtime_error("Modo de secuencia fija incorrecto");
+    }
+}
+
 void testBasicSoftmax() {
     std::cout << "\n========== TEST: SOFTMAX BÁSICO ==========" << std::endl;
     
@@ -209,6 +372,302 @@ void testLargeVocabSoftmax() {
     }
 }
 
+void testRowsSoftmax() {
+    std::cout << "\n========== TEST: SOFTMAX POR FILAS (ATENCIÓN) ==========" << std::endl;
+    
+    // [n_head × n_q, n_kv] con padding entre filas y máscara causal [n_q, n_kv]
+    const size_t n_head = 8, n_q = 8, n_kv = 100, stride = 112;
+    const size_t rows = n_head * n_q;
+    const float scale = 0.125f;
+    const float NEG_INF = -std::numeric_limits<float>::infinity();
+    const float PADDING = 123.0f;
+    
+    std::mt19937 gen(5);
+    std::uniform_real_distribution<float> dist(-20.0f, 20.0f);
+    std::vector<float> kq(rows * stride, PADDING);
+    for (size_t r = 0; r < rows; r++) {
+        for (size_t c = 0; c < n_kv; c++) {
+            kq[r * stride + c] = dist(gen);
+        }
+    }
+    std::vector<float> mask(n_q * n_kv);
+    for (size_t q = 0; q < n_q; q++) {
+        for (size_t c = 0; c < n_kv; c++) {
+            mask[q * n_kv + c] = (c > q + n_kv - n_q) ? NEG_INF : -0.05f * (n_kv - c);
+        }
+    }
+    
+    CORDICSoftmax cordic(false);
+    cordic.setParallelConfig(CORDICParallelConfig(3, 256));
+    std::vector<float> probs(rows * stride, PADDING);
+    cordic.computeSoftmaxRows(kq.data(), probs.data(), rows, n_kv, stride, scale,
+                              mask.data(), n_kv, n_q);
+    
+    double max_mse = 0.0;
+    bool masked_zero = true, padding_intact = true, sums_ok = true;
+    std::vector<float> fused(n_kv), reference(n_kv);
+    for (size_t r = 0; r < rows; r++) {
+        const float* row_mask = &mask[(r % n_q) * n_kv];
+        const float* row = &probs[r * stride];
+        for (size_t c = 0; c < n_kv; c++) {
+            fused[c] = kq[r * stride + c] * scale + row_mask[c];
+        }
+        computeReferenceSoftmax(fused.data(), reference.data(), n_kv);
+        max_mse = std::max(max_mse, calculateMSE(row, reference.data(), n_kv));
+        
+        float sum = 0.0f;
+        for (size_t c = 0; c < n_kv; c++) {
+            sum += row[c];
+            masked_zero = masked_zero && (row_mask[c] != NEG_INF || row[c] == 0.0f);
+        }
+        sums_ok = sums_ok && std::abs(sum - 1.0f) < 1e-4f;
+        for (size_t c = n_kv; c < stride; c++) {
+            padding_intact = padding_intact && row[c] == PADDING;
+        }
+    }
+    std::cout << "Filas " << rows << " × " << n_kv << " (stride " << stride << ", escala "
+              << scale << ", máscara causal): MSE máx " << std::scientific 
+              << std::setprecision(3) << max_mse << std::fixed << std::endl;
+    std::cout << "  Enmascarados = 0 exacto: " << (masked_zero ? "✓" : "✗") 
+              << ", sumas = 1: " << (sums_ok ? "✓" : "✗")
+              << ", padding intacto: " << (padding_intact ? "✓" : "✗") << std::endl;
+    if (max_mse > 1e-6 || !masked_zero || !sums_ok || !padding_intact) {
+        throw std::runtime_error("computeSoftmaxRows fuera de tolerancia");
+    }
+    
+    // Sin escala ni máscara: cada fila idéntica a computeSoftmax; en sitio también
+    std::vector<float> in_place = kq;
+    cordic.computeSoftmaxRows(in_place.data(), in_place.data(), rows, n_kv, stride);
+    bool identical = true;
+    std::vector<float> single(n_kv);
+    for (size_t r = 0; r < rows; r++) {
+        cordic.computeSoftmax(&kq[r * stride], single.data(), n_kv);
+        identical = identical && 
+                    std::memcmp(single.data(), &in_place[r * stride], n_kv * sizeof(float)) == 0;
+    }
+    std::cout << "  Sin escala/máscara (en sitio) idéntico a computeSoftmax: " 
+              << (identical ? "✓" : "✗") << std::endl;
+    if (!identical) {
+        throw std::runtime_error("computeSoftmaxRows difiere de computeSoftmax");
+    }
+    
+    // Fila completamente enmascarada → ceros
+    std::vector<float> full_mask(n_kv, NEG_INF);
+    std::vector<float> masked_row(n_kv, PADDING);
+    cordic.computeSoftmaxRows(kq.data(), masked_row.data(), 1, n_kv, n_kv, 1.0f,
+                              full_mask.data(), n_kv, 1);
+    bool all_zero = std::all_of(masked_row.begin(), masked_row.end(),
+                                [](float p) { return p == 0.0f; });
+    
+    bool caught = false;
+    try {
+        cordic.computeSoftmaxRows(kq.data(), probs.data(), rows, n_kv, n_kv - 1);
+    } catch (const std::invalid_argument&) {
+        caught = true;
+    }
+    std::cout << "  Fila enmascarada → ceros: " << (all_zero ? "✓" : "✗")
+              << ", stride inválido → std::invalid_argument: " << (caught ? "✓" : "✗") 
+              << std::endl;
+    if (!all_zero || !caught) {
+        throw std::runtime_error("computeSoftmaxRows: casos límite incorrectos");
+    }
+}
+
+void testCausalRowsSoftmax() {
+    std::cout << "\n========== TEST: SOFTMAX POR FILAS CON MÁSCARA CAUSAL IMPLÍCITA ==========" << std::endl;
+    
+    // Caché KV: n_past = 44 posiciones previas + n_q = 6 consultas nuevas
+    const size_t n_head = 4, n_q = 6, n_past = 44, n_kv = n_past + n_q, stride = 56;
+    const size_t rows = n_head * n_q;
+    const float scale = 0.125f;
+    const float NEG_INF = -std::numeric_limits<float>::infinity();
+    const float PADDING = 123.0f;
+    
+    std::mt19937 gen(11);
+    std::uniform_real_distribution<float> dist(-20.0f, 20.0f);
+    std::vector<float> alibi(n_q * n_kv);
+    for (size_t q = 0; q < n_q; q++) {
+        for (size_t c = 0; c < n_kv; c++) {
+            alibi[q * n_kv + c] = -0.05f * static_cast<float>(n_kv - c);
+        }
+    }
+    
+    CORDICSoftmax cordic(false);
+    cordic.setParallelConfig(CORDICParallelConfig(3, 128));
+    
+    bool identical = true, masked_zero = true, padding_intact = true, in_place_ok = true;
+    size_t live = 0;
+    for (size_t window : {size_t(0), size_t(16)}) {
+        const float* masks[] = {nullptr, alibi.data()};
+        for (const float* mask : masks) {
+            std::vector<float> kq(rows * stride, PADDING);
+            std::vector<float> explicit_mask(n_q * n_kv);
+            for (size_t r = 0; r < rows; r++) {
+                const size_t q = n_past + r % n_q;
+                for (size_t c = 0; c < n_kv; c++) {
+                    const bool visible = c <= q && (window == 0 || c + window > q);
+                    // Lo enmascarado no se lee: un NaN ahí contaminaría la fila
+                    kq[r * stride + c] = visible ? dist(gen) : std::numeric_limits<float>::quiet_NaN();
+                    explicit_mask[(r % n_q) * n_kv + c] =
+                        visible ? (mask ? mask[(r % n_q) * n_kv + c] : 0.0f) : NEG_INF;
+                }
+            }
+            
+            // Referencia: máscara aditiva explícita sobre logits sin NaN
+            std::vector<float> clean = kq;
+            for (float& v : clean) {
+                if (std::isnan(v)) {
+                    v = 0.0f;
+                }
+            }
+            std::vector<float> expected(rows * stride, PADDING);
+            cordic.computeSoftmaxRows(clean.data(), expected.data(), rows, n_kv, stride, scale,
+                                      explicit_mask.data(), n_kv, n_q);
+            
+            const CORDICCausalMask causal(n_past, n_q, window);
+            std::vector<float> probs(rows * stride, PADDING);
+            cordic.computeSoftmaxRowsCausal(kq.data(), probs.data(), rows, n_kv, stride, causal,
+                                            scale, mask, n_kv, n_q);
+            identical = identical &&
+                        std::memcmp(probs.data(), expected.data(), probs.size() * sizeof(float)) == 0;
+            
+            for (size_t r = 0; r < rows; r++) {
+                for (size_t c = 0; c < n_kv; c++) {
+                    const bool visible = explicit_mask[(r % n_q) * n_kv + c] != NEG_INF;
+                    masked_zero = masked_zero && (visible || probs[r * stride + c] == 0.0f);
+                    live += visible ? 1 : 0;
+                }
+                for (size_t c = n_kv; c < stride; c++) {
+                    padding_intact = padding_intact && probs[r * stride + c] == PADDING;
+                }
+            }
+            
+            std::vector<float> in_place = kq;
+            cordic.computeSoftmaxRowsCausal(in_place.data(), in_place.data(), rows, n_kv, stride,
+                                            causal, scale, mask, n_kv, n_q);
+            in_place_ok = in_place_ok &&
+                          std::memcmp(in_place.data(), probs.data(), probs.size() * sizeof(float)) == 0;
+        }
+    }
+    
+    // positions == 0 → excepción; API C: 0 si correcto, -1 si inválido
+    bool caught = false;
+    std::vector<float> kq(rows * n_kv, 0.5f), probs(rows * n_kv);
+    try {
+        cordic.computeSoftmaxRowsCausal(kq.data(), probs.data(), rows, n_kv, n_kv,
+                                        CORDICCausalMask(n_past, 0));
+    } catch (const std::invalid_argument&) {
+        caught = true;
+    }
+    llama_cordic_context* ctx = llama_cordic_context_create(1);
+    std::vector<float> c_probs(rows * n_kv);
+    const int status_ok = llama_cordic_ctx_softmax_rows_causal(ctx, kq.data(), c_probs.data(), rows,
+                                                               n_kv, n_kv, 1.0f, n_past, n_q, 0);
+    const int status_bad = llama_cordic_ctx_softmax_rows_causal(ctx, kq.data(), c_probs.data(), rows,
+                                                                n_kv, n_kv - 1, 1.0f, n_past, n_q, 0);
+    llama_cordic_context_free(ctx);
+    // Logits constantes: la fila r reparte 1 / (q + 1) uniformemente
+    bool uniform = status_ok == 0 && status_bad == -1;
+    for (size_t r = 0; r < rows && uniform; r++) {
+        const size_t q = n_past + r % n_q;
+        uniform = std::abs(c_probs[r * n_kv] - 1.0f / static_cast<float>(q + 1)) < 1e-6f &&
+                  (q + 1 >= n_kv || c_probs[r * n_kv + q + 1] == 0.0f);
+    }
+    
+    std::cout << "Filas " << rows << " × " << n_kv << " (n_past " << n_past << ", ventanas 0 / 16, "
+              << "con y sin ALiBi): " << live << " elementos visibles de "
+              << 4 * rows * n_kv << std::endl;
+    std::cout << "  Idéntico a máscara -inf explícita: " << (identical ? "✓" : "✗")
+              << ", enmascarados = 0 exacto sin leerlos: " << (masked_zero ? "✓" : "✗")
+              << ", padding intacto: " << (padding_intact ? "✓" : "✗")
+              << ", en sitio: " << (in_place_ok ? "✓" : "✗") << std::endl;
+    std::cout << "  positions = 0 → std::invalid_argument: " << (caught ? "✓" : "✗")
+              << ", API C: " << (uniform ? "✓" : "✗") << std::endl;
+    if (!identical || !masked_zero || !padding_intact || !in_place_ok || !caught || !uniform) {
+        throw std::runtime_error("computeSoftmaxRowsCausal incorrecto");
+    }
+}
+
+void testLogSoftmax() {
+    std::cout << "\n========== TEST: LOG-SOFTMAX Y LOG-SUM-EXP ==========" << std::endl;
+    
+    CORDICSoftmax cordic(false);
+    const float NEG_INF = -std::numeric_limits<float>::infinity();
+    
+    // σ = 1.5: el rango de la fila queda dentro del de la exp CORDIC
+    std::mt19937 gen(11);
+    std::normal_distribution<float> dist(0.0f, 1.5f);
+    const size_t vocab_size = 32000;
+    std::vector<float> logits(vocab_size);
+    for (float& v : logits) {
+        v = dist(gen);
+    }
+    
+    // Referencia en double
+    double max_logit = *std::max_element(logits.begin(), logits.end());
+    double sum = 0.0;
+    for (float v : logits) {
+        sum += std::exp(v - max_logit);
+    }
+    const double reference_lse = max_logit + std::log(sum);
+    
+    float lse = cordic.computeLogSumExp(logits.data(), vocab_size);
+    std::vector<float> log_probs(vocab_size);
+    cordic.computeLogSoftmax(logits.data(), log_probs.data(), vocab_size);
+    
+    double max_abs_error = 0.0;
+    for (size_t i = 0; i < vocab_size; i++) {
+        max_abs_error = std::max(max_abs_error, std::abs(log_probs[i] - (logits[i] - reference_lse)));
+    }
+    
+    // Ruta anterior: softmax y log por elemento (arrastra el error de cada exp)
+    std::vector<float> probs(vocab_size);
+    cordic.computeSoftmax(logits.data(), probs.data(), vocab_size);
+    double log_of_probs_error = 0.0;
+    for (size_t i = 0; i < vocab_size; i++) {
+        double log_prob = std::log(static_cast<double>(probs[i]));
+        log_of_probs_error = std::max(log_of_probs_error,
+                                      std::abs(log_prob - (logits[i] - reference_lse)));
+    }
+    
+    std::cout << "log-sum-exp: " << lse << " (referencia " << reference_lse << ")" << std::endl;
+    std::cout << "Error absoluto máx de log_softmax: " << std::scientific << std::setprecision(3)
+              << max_abs_error << " (log(softmax) por elemento: " << log_of_probs_error << ")"
+              << std::fixed << std::endl;
+    
+    // Probabilidades diminutas: log_softmax no se satura aunque softmax dé 0
+    std::vector<float> extreme = {0.0f, -120.0f, -5.0f};
+    std::vector<float> extreme_log(3);
+    cordic.computeLogSoftmax(extreme.data(), extreme_log.data(), 3);
+    const double extreme_lse = std::log(1.0 + std::exp(-120.0) + std::exp(-5.0));
+    bool tiny_ok = std::abs(extreme_log[1] - (-120.0 - extreme_lse)) < 1e-4;
+    
+    // -inf enmascarados, fila vacía y en sitio
+    std::vector<float> masked = {1.0f, NEG_INF, 2.0f};
+    std::vector<float> masked_log(3);
+    cordic.computeLogSoftmax(masked.data(), masked_log.data(), 3);
+    const double masked_lse = 2.0 + std::log(1.0 + std::exp(-1.0));
+    bool masked_ok = masked_log[1] == NEG_INF &&
+                     std::abs(cordic.computeLogSumExp(masked.data(), 3) - masked_lse) < 2e-3;
+    std::vector<float> all_masked = {NEG_INF, NEG_INF};
+    bool empty_ok = cordic.computeLogSumExp(all_masked.data(), 2) == NEG_INF &&
+                    cordic.computeLogSumExp(nullptr, 0) == NEG_INF;
+    std::vector<float> in_place = logits;
+    llama_cordic_log_softmax(in_place.data(), in_place.data(), vocab_size);
+    bool in_place_ok = in_place == log_probs;
+    
+    std::cout << "Prob ~e^-120: " << (tiny_ok ? "✓" : "✗")
+              << ", -inf enmascarados: " << (masked_ok ? "✓" : "✗")
+              << ", filas vacías → -inf: " << (empty_ok ? "✓" : "✗")
+              << ", API C en sitio: " << (in_place_ok ? "✓" : "✗") << std::endl;
+    
+    // Solo la suma CORDIC aporta error, promediado sobre el vocabulario
+    if (max_abs_error > 1e-4 || max_abs_error > log_of_probs_error || !tiny_ok || !masked_ok ||
+        !empty_ok || !in_place_ok) {
+        throw std::runtime_error("log_softmax fuera de tolerancia");
+    }
+}
+
 void testCInterfaceAPI() {
     std::cout << "\n========== TEST: INTERFAZ C (llama.cpp) ==========" << std::endl;
     
@@ -242,7 +701,16 @@ void testCInterfaceAPI() {
     std::cout << "]" << std::endl;
     std::cout << "  Suma: " << std::setprecision(6) << sum << std::endl;
     
-    if (std::abs(sum - 1.0f) < 1e-5f) {
+    std::cout << "\nProbando llama_cordic_softmax_rows()..." << std::endl;
+    float rows_logits[] = {1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f};
+    float rows_mask[] = {0.0f, -INFINITY, -INFINITY};
+    float rows_probs[6];
+    llama_cordic_softmax_rows(rows_logits, rows_probs, 2, 3, 3, 0.5f, rows_mask, 3, 1);
+    std::cout << "  Filas: [" << std::setprecision(4) << rows_probs[0] << ", " << rows_probs[1]
+              << ", " << rows_probs[2] << "] [" << rows_probs[3] << ", " << rows_probs[4]
+              << ", " << rows_probs[5] << "]" << std::endl;
+    
+    if (std::abs(sum - 1.0f) < 1e-5f && rows_probs[0] == 1.0f && rows_probs[3] == 1.0f) {
         std::cout << "✅ INTERFAZ C FUNCIONANDO" << std::endl;
     }
 }
@@ -264,8 +732,13 @@ int main() {
     try {
         testConfiguration();
         testCORDICExp();
+        testFastPathBitExact();
+        testFixedScheduleMode();
         testBasicSoftmax();
         testLargeVocabSoftmax();
+        testRowsSoftmax();
+        testCausalRowsSoftmax();
+        testLogSoftmax();
         testCInterfaceAPI();
         
         std::cout << "\n========================================" << std::endl;
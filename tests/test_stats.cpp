@@ -0,0 +1,278 @@
+#include "cordic_stats.h"
+#include "cordic_softmax.h"
+#include "cordic_simd.h"
+#include <iostream>
+#include <iomanip>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <random>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+//==============================================================================
+// UTILIDADES
+//==============================================================================
+
+std::vector<float> buildInputs(size_t size, unsigned seed) {
+    std::mt19937 gen(seed);
+    std::normal_distribution<float> dist(0.0f, 6.0f);
+    std::vector<float> inputs(size);
+    for (float& v : inputs) {
+        v = dist(gen);
+    }
+    // Saturadas (fuera de ±15, NaN, inf) y fronteras
+    const float specials[] = {
+        20.0f, -20.0f, 15.0f, -15.0f, 15.0001f, -15.0001f, 0.0f, -0.0f,
+        std::numeric_limits<float>::quiet_NaN(), std::numeric_limits<float>::infinity(),
+        -std::numeric_limits<float>::infinity()
+    };
+    for (size_t i = 0; i < sizeof(specials) / sizeof(specials[0]); i++) {
+        inputs[i * 7] = specials[i];
+    }
+    return inputs;
+}
+
+llama_cordic_stats snapshot() {
+    llama_cordic_stats stats;
+    llama_cordic_stats_snapshot(&stats);
+    return stats;
+}
+
+uint64_t total(const uint64_t* histogram, size_t buckets) {
+    uint64_t sum = 0;
+    for (size_t i = 0; i < buckets; i++) {
+        sum += histogram[i];
+    }
+    return sum;
+}
+
+/**
+ * @brief Campos por elemento idénticos (sin los de latencia de softmax)
+ */
+bool sameElementCounters(const llama_cordic_stats& a, const llama_cordic_stats& b) {
+    return a.elements == b.elements && a.saturated == b.saturated &&
+           a.not_converged == b.not_converged &&
+           std::memcmp(a.reduction_histogram, b.reduction_histogram,
+                       sizeof(a.reduction_histogram)) == 0 &&
+           std::memcmp(a.iteration_histogram, b.iteration_histogram,
+                       sizeof(a.iteration_histogram)) == 0;
+}
+
+bool allZero(const llama_cordic_stats& stats) {
+    const llama_cordic_stats zero = {};
+    return std::memcmp(&stats, &zero, sizeof(stats)) == 0;
+}
+
+//==============================================================================
+// TESTS
+//==============================================================================
+
+void testScalarCounters() {
+    std::cout << "\n========== TEST: CONTADORES RUTA ESCALAR ==========" << std::endl;
+
+    CORDICSoftmax cordic(false);
+    const float inputs[] = {0.0f, 1.0f, 20.0f, -20.0f, std::numeric_limits<float>::quiet_NaN(),
+                            std::numeric_limits<float>::infinity()};
+
+    llama_cordic_stats_reset();
+    for (float x : inputs) {
+        cordic.calculateExpFast(x);
+    }
+    const llama_cordic_stats stats = snapshot();
+
+    const size_t n_zero = static_cast<size_t>(0 - LLAMA_CORDIC_STATS_REDUCTION_MIN);
+    const bool ok = stats.elements == 6 && stats.saturated == 4 &&
+                    stats.reduction_histogram[n_zero] == 1 &&
+                    stats.reduction_histogram[n_zero + 1] == 1 &&
+                    total(stats.reduction_histogram, LLAMA_CORDIC_STATS_REDUCTION_BUCKETS) == 2 &&
+                    total(stats.iteration_histogram, LLAMA_CORDIC_STATS_ITERATION_BUCKETS) == 6 &&
+                    stats.iteration_histogram[0] >= 1 && stats.softmax_calls == 0;
+
+    std::cout << "Elementos: " << stats.elements << ", saturados: " << stats.saturated
+              << ", no convergidos: " << stats.not_converged << std::endl;
+    std::cout << "n = 0 (x = 0) y n = 1 (x = 1), 6 elementos rotados: " << (ok ? "✓" : "✗")
+              << std::endl;
+    if (!ok) {
+        throw std::runtime_error("Contadores de la ruta escalar incorrectos");
+    }
+}
+
+void testBatchPathsMatchScalar() {
+    std::cout << "\n========== TEST: LOTES / SIMD = ESCALAR ==========" << std::endl;
+
+    CORDICSoftmax cordic(false);
+    std::vector<float> inputs = buildInputs(100003, 17);
+    std::vector<float> outputs(inputs.size());
+
+    llama_cordic_stats_reset();
+    for (float x : inputs) {
+        cordic.calculateExpFast(x);
+    }
+    const llama_cordic_stats scalar = snapshot();
+
+    std::cout << "Iteraciones (escalar, " << scalar.elements << " elementos):" << std::endl;
+    for (int i = 0; i < LLAMA_CORDIC_STATS_ITERATION_BUCKETS; i++) {
+        if (scalar.iteration_histogram[i] != 0) {
+            std::cout << "  " << std::setw(2) << i << ": " << scalar.iteration_histogram[i]
+                      << std::endl;
+        }
+    }
+
+    bool all_ok = true;
+
+    llama_cordic_stats_reset();
+    cordic.calculateExpBatchTiled(inputs.data(), outputs.data(), inputs.size());
+    const bool tiled_ok = sameElementCounters(snapshot(), scalar);
+    std::cout << "tiles SoA: " << (tiled_ok ? "✓" : "✗") << std::endl;
+    all_ok = all_ok && tiled_ok;
+
+    for (CORDICKernel kernel : {CORDICKernel::SSE41, CORDICKernel::AVX2, CORDICKernel::AVX512,
+                                CORDICKernel::NEON}) {
+        if (!CORDICSIMD::isKernelSupported(kernel)) {
+            continue;
+        }
+        // En el sitio: el registro del bloque lee las entradas antes de escribir
+        std::vector<float> in_place = inputs;
+        llama_cordic_stats_reset();
+        CORDICSIMD::runKernel(kernel, CORDICKernelTables::shared(), in_place.data(),
+                              in_place.data(), in_place.size());
+        const bool kernel_ok = sameElementCounters(snapshot(), scalar);
+        std::cout << CORDICSIMD::kernelName(kernel) << " (en el sitio, cola de "
+                  << inputs.size() % 16 << "): " << (kernel_ok ? "✓" : "✗") << std::endl;
+        all_ok = all_ok && kernel_ok;
+    }
+
+    if (!all_ok) {
+        throw std::runtime_error("Los contadores de lotes / SIMD difieren de la ruta escalar");
+    }
+}
+
+void testThreads() {
+    std::cout << "\n========== TEST: CONTADORES POR HILO ==========" << std::endl;
+
+    CORDICSoftmax cordic(false);
+    const size_t per_thread = 10000;
+    llama_cordic_stats_reset();
+
+    // Hilos terminados: sus contadores pasan al total global
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 3; t++) {
+        threads.emplace_back([&cordic, t] {
+            std::vector<float> inputs = buildInputs(per_thread, 100 + t);
+            for (float x : inputs) {
+                cordic.calculateExpFast(x);
+            }
+        });
+    }
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+    const uint64_t after_join = snapshot().elements;
+
+    // Hilo vivo: visible en el snapshot sin terminar
+    for (size_t i = 0; i < per_thread; i++) {
+        cordic.calculateExpFast(0.5f);
+    }
+    const uint64_t with_live = snapshot().elements;
+
+    const bool ok = after_join == 3 * per_thread && with_live == 4 * per_thread;
+    std::cout << "3 hilos terminados: " << after_join << ", + hilo vivo: " << with_live << " "
+              << (ok ? "✓" : "✗") << std::endl;
+    if (!ok) {
+        throw std::runtime_error("Contadores por hilo no agregados");
+    }
+}
+
+void testSoftmaxLatency() {
+    std::cout << "\n========== TEST: LATENCIA DE SOFTMAX ==========" << std::endl;
+
+    CORDICSoftmax cordic(false);
+    std::vector<float> logits = buildInputs(4096, 3);
+    for (float& v : logits) {
+        if (!std::isfinite(v)) {
+            v = 0.0f;
+        }
+    }
+    std::vector<float> probs(logits.size());
+
+    llama_cordic_stats_reset();
+    for (int i = 0; i < 5; i++) {
+        cordic.computeSoftmax(logits.data(), probs.data(), logits.size());
+    }
+    cordic.computeSoftmaxOnline(logits.data(), probs.data(), logits.size());
+    cordic.computeLogSoftmax(logits.data(), probs.data(), logits.size());
+    cordic.computeSoftmaxRows(logits.data(), probs.data(), 4, 1024, 1024);
+    const llama_cordic_stats stats = snapshot();
+
+    const uint64_t histogram_calls =
+        total(stats.softmax_latency_histogram, LLAMA_CORDIC_STATS_LATENCY_BUCKETS);
+    const bool ok = stats.softmax_calls == 8 && histogram_calls == 8 && stats.softmax_ns > 0 &&
+                    stats.elements >= 5 * logits.size();
+    std::cout << "Llamadas: " << stats.softmax_calls << ", media: "
+              << (stats.softmax_calls ? stats.softmax_ns / stats.softmax_calls : 0) << " ns"
+              << std::endl;
+    std::cout << "computeSoftmax ×5 + online + log_softmax + filas = 8 llamadas: "
+              << (ok ? "✓" : "✗") << std::endl;
+    if (!ok) {
+        throw std::runtime_error("Latencia de softmax mal contabilizada");
+    }
+}
+
+void testResetAndCAPI() {
+    std::cout << "\n========== TEST: RESET Y API C ==========" << std::endl;
+
+    CORDICSoftmax cordic(false);
+    cordic.calculateExpFast(2.0f);
+    llama_cordic_stats_reset();
+    const bool zero_after_reset = allZero(snapshot());
+    cordic.calculateExpFast(2.0f);
+    const bool counts_again = snapshot().elements == 1;
+    llama_cordic_stats_snapshot(nullptr);
+
+    std::cout << "Snapshot a cero tras reset y vuelve a contar: "
+              << (zero_after_reset && counts_again ? "✓" : "✗") << std::endl;
+    if (!zero_after_reset || !counts_again) {
+        throw std::runtime_error("llama_cordic_stats_reset incorrecto");
+    }
+}
+
+//==============================================================================
+// MAIN
+//==============================================================================
+
+int main() {
+    std::cout << "========================================" << std::endl;
+    std::cout << "TEST: contadores de instrumentación" << std::endl;
+    std::cout << "========================================" << std::endl;
+
+    try {
+        if (!llama_cordic_stats_enabled()) {
+            // Sin CORDIC_ENABLE_STATS: la API existe y devuelve ceros
+            CORDICSoftmax cordic(false);
+            cordic.calculateExpFast(1.0f);
+            if (!allZero(snapshot())) {
+                throw std::runtime_error("Snapshot no nulo sin CORDIC_ENABLE_STATS");
+            }
+            std::cout << "Librería sin CORDIC_ENABLE_STATS: snapshot a cero ✓" << std::endl;
+            return 0;
+        }
+
+        testScalarCounters();
+        testBatchPathsMatchScalar();
+        testThreads();
+        testSoftmaxLatency();
+        testResetAndCAPI();
+
+        std::cout << "\n========================================" << std::endl;
+        std::cout << "✅ TODOS LOS TESTS COMPLETADOS" << std::endl;
+        std::cout << "========================================" << std::endl;
+
+        return 0;
+
+    } catch (const std::exception& e) {
+        std::cerr << "\n❌ ERROR: " << e.what() << std::endl;
+        return 1;
+    }
+}
@@ -0,0 +1,306 @@
+#include "cordic_stream.h"
+#include "test_logits.h"
+#include <iostream>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <unistd.h>
+
+//==============================================================================
+// UTILIDADES
+//==============================================================================
+
+std::vector<float> buildLogits(size_t rows, size_t vocab, unsigned seed) {
+    return randomLogits(rows * vocab, seed, 4.0f);
+}
+
+std::vector<int32_t> buildTargets(size_t rows, size_t vocab, unsigned seed) {
+    std::mt19937 gen(seed);
+    std::uniform_int_distribution<int32_t> dist(0, static_cast<int32_t>(vocab) - 1);
+    std::vector<int32_t> targets(rows);
+    for (int32_t& t : targets) {
+        t = dist(gen);
+    }
+    return targets;
+}
+
+std::string tempPath(const std::string& name) {
+    return "/tmp/cordic_stream_" + std::to_string(getpid()) + "_" + name;
+}
+
+template <typename T>
+void writeFile(const std::string& path, const std::vector<T>& data) {
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    file.write(reinterpret_cast<const char*>(data.data()), data.size() * sizeof(T));
+    if (!file) {
+        throw std::runtime_error("No se pudo escribir " + path);
+    }
+}
+
+std::vector<float> readFloats(const std::string& path) {
+    std::ifstream file(path, std::ios::binary | std::ios::ate);
+    std::vector<float> data(static_cast<size_t>(file.tellg()) / sizeof(float));
+    file.seekg(0);
+    file.read(reinterpret_cast<char*>(data.data()), data.size() * sizeof(float));
+    return data;
+}
+
+bool sameBits(const std::vector<float>& a, const std::vector<float>& b) {
+    return a.size() == b.size() && std::memcmp(a.data(), b.data(), a.size() * sizeof(float)) == 0;
+}
+
+/**
+ * @brief Referencia: computeSoftmax fila a fila con una sola instancia
+ */
+std::vector<float> referenceProbabilities(const std::vector<float>& logits, size_t vocab) {
+    CORDICSoftmax cordic(false);
+    std::vector<float> probs(logits.size());
+    for (size_t r = 0; r < logits.size() / vocab; r++) {
+        cordic.computeSoftmax(logits.data() + r * vocab, probs.data() + r * vocab, vocab);
+    }
+    return probs;
+}
+
+template <typename Exception, typename Function>
+bool throwsException(Function function) {
+    try {
+        function();
+    } catch (const Exception&) {
+        return true;
+    }
+    return false;
+}
+
+//==============================================================================
+// TESTS
+//==============================================================================
+
+void testProbabilitiesInMemory() {
+    std::cout << "\n========== TEST: PROBABILIDADES EN MEMORIA ==========" << std::endl;
+
+    const size_t rows = 37;
+    const size_t vocab = 1000;
+    const std::vector<float> logits = buildLogits(rows, vocab, 1);
+    const std::vector<float> expected = referenceProbabilities(logits, vocab);
+
+    bool all_ok = true;
+    for (size_t threads : {1, 3, 8}) {
+        CORDICLogitStream stream(CORDICStreamConfig(vocab, threads, 4));
+        std::vector<float> probs(logits.size());
+        const CORDICStreamReport report =
+            stream.computeProbabilities(logits.data(), probs.data(), rows);
+        const bool ok = sameBits(probs, expected) && report.rows == rows &&
+                        report.bytes_read == rows * vocab * sizeof(float) &&
+                        report.bytes_written == report.bytes_read;
+        std::cout << threads << " hilos, lotes de 4 filas = computeSoftmax por fila: "
+                  << (ok ? "✓" : "✗") << std::endl;
+        all_ok = all_ok && ok;
+    }
+
+    // En el sitio
+    CORDICLogitStream stream(CORDICStreamConfig(vocab, 2));
+    std::vector<float> in_place = logits;
+    stream.computeProbabilities(in_place.data(), in_place.data(), rows);
+    const bool in_place_ok = sameBits(in_place, expected);
+    std::cout << "En el sitio: " << (in_place_ok ? "✓" : "✗") << std::endl;
+
+    if (!all_ok || !in_place_ok) {
+        throw std::runtime_error("Probabilidades distintas de computeSoftmax");
+    }
+}
+
+void testTargetLogProbsInMemory() {
+    std::cout << "\n========== TEST: LOG p(OBJETIVO) EN MEMORIA ==========" << std::endl;
+
+    const size_t rows = 29;
+    const size_t vocab = 777;
+    const float neg_inf = -std::numeric_limits<float>::infinity();
+    std::vector<float> logits = buildLogits(rows, vocab, 2);
+    std::vector<int32_t> targets = buildTargets(rows, vocab, 3);
+    // Fila 5: objetivo enmascarado; fila 6: toda -inf
+    logits[5 * vocab + targets[5]] = neg_inf;
+    std::fill(logits.begin() + 6 * vocab, logits.begin() + 7 * vocab, neg_inf);
+
+    CORDICLogitStream stream(CORDICStreamConfig(vocab, 4, 3));
+    std::vector<float> log_probs(rows);
+    const CORDICStreamReport report =
+        stream.computeTargetLogProbs(logits.data(), targets.data(), log_probs.data(), rows);
+
+    CORDICSoftmax cordic(false);
+    std::vector<float> row_log_softmax(vocab);
+    bool exact_ok = true;
+    double max_diff = 0.0;
+    for (size_t r = 0; r < rows; r++) {
+        const float* row = logits.data() + r * vocab;
+        const float lse = cordic.computeLogSumExp(row, vocab);
+        const float expected = lse == neg_inf ? neg_inf : row[targets[r]] - lse;
+        exact_ok = exact_ok && std::memcmp(&expected, &log_probs[r], sizeof(float)) == 0;
+
+        cordic.computeLogSoftmax(row, row_log_softmax.data(), vocab);
+        if (std::isfinite(log_probs[r])) {
+            max_diff = std::max(max_diff, std::fabs(static_cast<double>(log_probs[r]) -
+                                                    row_log_softmax[targets[r]]));
+        } else {
+            exact_ok = exact_ok && row_log_softmax[targets[r]] == neg_inf;
+        }
+    }
+    const bool specials_ok = log_probs[5] == neg_inf && log_probs[6] == neg_inf &&
+                             std::isinf(report.nll_sum);
+
+    std::cout << "x_t - computeLogSumExp bit a bit, -inf como computeLogSoftmax: "
+              << (exact_ok ? "✓" : "✗") << std::endl;
+    std::cout << "Máx |Δ| frente a computeLogSoftmax[t]: " << max_diff << " "
+              << (max_diff < 1e-5 ? "✓" : "✗") << std::endl;
+    std::cout << "Objetivo enmascarado y fila -inf → -inf, NLL total inf: "
+              << (specials_ok ? "✓" : "✗") << std::endl;
+
+    // NLL total en orden de fila, sin filas especiales
+    logits = buildLogits(rows, vocab, 4);
+    stream.computeTargetLogProbs(logits.data(), targets.data(), log_probs.data(), rows);
+    double expected_nll = 0.0;
+    for (float lp : log_probs) {
+        expected_nll -= lp;
+    }
+    CORDICLogitStream single(CORDICStreamConfig(vocab, 1));
+    const double nll_one_thread =
+        single.computeTargetLogProbs(logits.data(), targets.data(), log_probs.data(), rows).nll_sum;
+    const double nll_four_threads =
+        stream.computeTargetLogProbs(logits.data(), targets.data(), log_probs.data(), rows).nll_sum;
+    const bool nll_ok = nll_one_thread == expected_nll && nll_four_threads == expected_nll;
+    std::cout << "NLL total = Σ -log p en orden de fila (1 y 4 hilos): " << expected_nll << " "
+              << (nll_ok ? "✓" : "✗") << std::endl;
+
+    if (!exact_ok || max_diff >= 1e-5 || !specials_ok || !nll_ok) {
+        throw std::runtime_error("log p(objetivo) incorrecta");
+    }
+}
+
+void testFiles() {
+    std::cout << "\n========== TEST: FICHEROS MAPEADOS ==========" << std::endl;
+
+    // ~5 MB: varios lotes con prefetch y páginas soltadas
+    const size_t rows = 300;
+    const size_t vocab = 4096 + 3;
+    const std::vector<float> logits = buildLogits(rows, vocab, 5);
+    const std::vector<int32_t> targets = buildTargets(rows, vocab, 6);
+    const std::string logits_path = tempPath("logits.bin");
+    const std::string targets_path = tempPath("targets.bin");
+    const std::string probs_path = tempPath("probs.bin");
+    const std::string nll_path = tempPath("logprob.bin");
+    writeFile(logits_path, logits);
+    writeFile(targets_path, targets);
+
+    CORDICLogitStream stream(CORDICStreamConfig(vocab, 4, 16, 2));
+    const CORDICStreamReport probs_report =
+        stream.processFile(logits_path, probs_path, CORDICStreamOutput::PROBABILITIES);
+    const bool probs_ok = sameBits(readFloats(probs_path), referenceProbabilities(logits, vocab)) &&
+                          probs_report.rows == rows && probs_report.gigabytesPerSecond() > 0.0;
+    std::cout << "Probabilidades (" << rows << " × " << vocab << ", "
+              << probs_report.gigabytesPerSecond() << " GB/s) = computeSoftmax: "
+              << (probs_ok ? "✓" : "✗") << std::endl;
+
+    const CORDICStreamReport nll_report = stream.processFile(
+        logits_path, nll_path, CORDICStreamOutput::TARGET_LOG_PROB, targets_path);
+    std::vector<float> expected(rows);
+    const CORDICStreamReport memory_report =
+        stream.computeTargetLogProbs(logits.data(), targets.data(), expected.data(), rows);
+    const bool nll_ok = sameBits(readFloats(nll_path), expected) &&
+                        nll_report.nll_sum == memory_report.nll_sum &&
+                        nll_report.bytes_written == rows * sizeof(float);
+    std::cout << "log p(objetivo) en fichero = en memoria, NLL media "
+              << nll_report.nll_sum / rows << ": " << (nll_ok ? "✓" : "✗") << std::endl;
+
+    // Volcado vacío: salida vacía
+    const std::string empty_path = tempPath("empty.bin");
+    writeFile(empty_path, std::vector<float>());
+    const bool empty_ok =
+        stream.processFile(empty_path, probs_path, CORDICStreamOutput::PROBABILITIES).rows == 0 &&
+        readFloats(probs_path).empty();
+    std::cout << "Fichero vacío → 0 filas: " << (empty_ok ? "✓" : "✗") << std::endl;
+
+    for (const std::string& path : {logits_path, targets_path, probs_path, nll_path, empty_path}) {
+        std::remove(path.c_str());
+    }
+    if (!probs_ok || !nll_ok || !empty_ok) {
+        throw std::runtime_error("Salida en fichero distinta de la versión en memoria");
+    }
+}
+
+void testErrors() {
+    std::cout << "\n========== TEST: ERRORES ==========" << std::endl;
+
+    const size_t vocab = 64;
+    const std::string logits_path = tempPath("bad_logits.bin");
+    const std::string targets_path = tempPath("bad_targets.bin");
+    const std::string output_path = tempPath("bad_out.bin");
+    writeFile(logits_path, buildLogits(3, vocab, 7));
+    writeFile(targets_path, std::vector<int32_t>{1, 2});   // 2 objetivos para 3 filas
+
+    CORDICLogitStream stream(CORDICStreamConfig(vocab, 2));
+    CORDICLogitStream wrong_vocab(CORDICStreamConfig(vocab + 1, 2));
+    std::vector<float> logits = buildLogits(2, vocab, 8);
+    std::vector<int32_t> bad_targets = {0, static_cast<int32_t>(vocab)};
+    std::vector<float> out(2);
+
+    const bool ok =
+        throwsException<std::invalid_argument>([] { CORDICLogitStream s(CORDICStreamConfig(0)); }) &&
+        throwsException<std::invalid_argument>([&] {
+            wrong_vocab.processFile(logits_path, output_path, CORDICStreamOutput::PROBABILITIES);
+        }) &&
+        throwsException<std::invalid_argument>([&] {
+            stream.computeTargetLogProbs(logits.data(), bad_targets.data(), out.data(), 2);
+        }) &&
+        throwsException<std::invalid_argument>([&] {
+            stream.processFile(logits_path, output_path, CORDICStreamOutput::TARGET_LOG_PROB,
+                               targets_path);
+        }) &&
+        throwsException<std::invalid_argument>([&] {
+            stream.processFile(logits_path, output_path, CORDICStreamOutput::TARGET_LOG_PROB);
+        }) &&
+        throwsException<std::runtime_error>([&] {
+            stream.processFile(tempPath("missing.bin"), output_path,
+                               CORDICStreamOutput::PROBABILITIES);
+        });
+
+    for (const std::string& path : {logits_path, targets_path, output_path}) {
+        std::remove(path.c_str());
+    }
+    std::cout << "vocab 0, tamaño no múltiplo, objetivo fuera de rango, objetivos incompletos, "
+              << "fichero inexistente: " << (ok ? "✓" : "✗") << std::endl;
+    if (!ok) {
+        throw std::runtime_error("Errores de CORDICLogitStream no detectados");
+    }
+}
+
+//==============================================================================
+// MAIN
+//==============================================================================
+
+int main() {
+    std::cout << "========================================" << std::endl;
+    std::cout << "TEST: softmax sobre volcados mapeados" << std::endl;
+    std::cout << "========================================" << std::endl;
+
+    try {
+        testProbabilitiesInMemory();
+        testTargetLogProbsInMemory();
+        testFiles();
+        testErrors();
+
+        std::cout << "\n========================================" << std::endl;
+        std::cout << "✅ TODOS LOS TESTS COMPLETADOS" << std::endl;
+        std::cout << "========================================" << std::endl;
+
+        return 0;
+
+    } catch (const std::exception& e) {
+        std::cerr << "\n❌ ERROR: " << e.what() << std::endl;
+        return 1;
+    }
+}
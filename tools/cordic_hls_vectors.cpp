@@ -0,0 +1,259 @@
+/**
+ * @file cordic_hls_vectors.cpp
+ * @brief Generador de vectores de test para co-simulación RTL del datapath e^x
+ *
+ * USO:
+ *   cordic_hls_vectors [--out=PREFIJO] [--count=N] [--seed=S] [--last-shift=N]
+ *                      [--exhaustive]
+ *
+ * Evalúa el modelo dorado (cordic_hls_model.h) sobre esquinas (saturación,
+ * ln2/2, fronteras k × ln2 ± ln2/2, NaN, inf, subnormales) y --count entradas
+ * aleatorias, comprueba cada resultado contra la ruta CPU
+ * (calculateExpFolded) y escribe ficheros binarios planos en el orden de
+ * bytes del host:
+ *
+ *   PREFIJO_input.bin      uint32   bits float32 de x
+ *   PREFIJO_reduction.bin  int8     n (e^x = 2^n × e^x')
+ *   PREFIJO_stages.bin     int16    (LENGTH + 1) × {X, Y, Z}: PRE y cada rotación
+ *   PREFIJO_sum.bin        int32    X + Y final (Q3.12)
+ *   PREFIJO_output.bin     uint32   bits float32 de e^x
+ *   PREFIJO.txt            descripción: secuencia, ángulos, X₀ y profundidad
+ *
+ * --exhaustive además compara el datapath completo con la CPU en todos los
+ * float con mapeo (ln2/2 < |x| ≤ 15).
+ */
+
+#include "cordic_hls_model.h"
+#include "cordic_softmax.h"
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <string>
+#include <vector>
+
+struct VectorOptions {
+    std::string prefix = "cordic_vectors";
+    size_t count = 65536;
+    unsigned seed = 1;
+    int last_shift = CORDICConfig::FRAC_WIDTH;
+    bool exhaustive = false;
+};
+
+static uint32_t floatBits(float value) {
+    uint32_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    return bits;
+}
+
+static float bitsFloat(uint32_t bits) {
+    float value;
+    std::memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+static std::vector<uint32_t> buildInputs(const VectorOptions& options) {
+    std::vector<uint32_t> inputs;
+    const float specials[] = {
+        0.0f, 1.0f, 8.0f, 15.0f, 20.0f, static_cast<float>(CORDICConfig::CONVERGENCE_LIMIT),
+        std::numeric_limits<float>::denorm_min(), std::numeric_limits<float>::min(),
+        std::numeric_limits<float>::max()
+    };
+    for (float value : specials) {
+        for (uint32_t sign : {0u, 0x80000000u}) {
+            for (int delta = value == 0.0f ? 0 : -2; delta <= 2; delta++) {
+                inputs.push_back(sign | (floatBits(value) + static_cast<uint32_t>(delta)));
+            }
+        }
+    }
+    for (float value : {std::numeric_limits<float>::infinity(),
+                        std::numeric_limits<float>::quiet_NaN()}) {
+        inputs.push_back(floatBits(value));
+        inputs.push_back(floatBits(value) | 0x80000000u);
+    }
+    // Fronteras de n: x' = ±ln2/2 y x' = 0
+    for (int k = -22; k <= 22; k++) {
+        for (double offset : {-0.5, 0.0, 0.5}) {
+            const uint32_t edge = floatBits(static_cast<float>((k + offset) * CORDICConfig::LN2));
+            for (int delta = -2; delta <= 2; delta++) {
+                inputs.push_back(edge + static_cast<uint32_t>(delta));
+            }
+        }
+    }
+
+    std::mt19937 gen(options.seed);
+    std::uniform_real_distribution<float> values(-16.0f, 16.0f);
+    std::uniform_int_distribution<uint32_t> raw;
+    for (size_t i = 0; i < options.count; i++) {
+        inputs.push_back(i % 4 == 3 ? raw(gen) : floatBits(values(gen)));
+    }
+    return inputs;
+}
+
+template <typename T>
+static void writeBinary(const std::string& path, const std::vector<T>& data) {
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    file.write(reinterpret_cast<const char*>(data.data()),
+               static_cast<std::streamsize>(data.size() * sizeof(T)));
+    if (!file) {
+        throw std::runtime_error("No se pudo escribir " + path);
+    }
+}
+
+template <int LastShift>
+static uint32_t cpuExponential(CORDICSoftmax& cordic, uint32_t bits) {
+    const float x = bitsFloat(bits);
+    return floatBits(LastShift == CORDICConfig::FRAC_WIDTH ? cordic.calculateExpFolded(x)
+                                                           : cordic.calculateExpFolded(x, LastShift));
+}
+
+template <int LastShift>
+static size_t verifyExhaustive() {
+    using Model = CORDICHLSModel<LastShift>;
+    CORDICSoftmax cordic(false);
+    size_t mismatches = 0;
+    for (uint32_t sign : {0u, 0x80000000u}) {
+        for (uint32_t bits = Model::DIRECT_MAX_ABS_BITS + 1; bits <= Model::SATURATION_ABS_BITS;
+             bits++) {
+            if (Model::evaluate(sign | bits) != cpuExponential<LastShift>(cordic, sign | bits)) {
+                mismatches++;
+            }
+        }
+    }
+    return mismatches;
+}
+
+template <int LastShift>
+static int generate(const VectorOptions& options) {
+    using Model = CORDICHLSModel<LastShift>;
+    constexpr size_t STAGES = Model::LENGTH + 1;
+
+    if (options.exhaustive) {
+        std::cout << "Comparando todos los float con mapeo..." << std::endl;
+        const size_t mismatches = verifyExhaustive<LastShift>();
+        std::cout << "Distintos de calculateExpFolded: " << mismatches << std::endl;
+        if (mismatches != 0) {
+            return 1;
+        }
+    }
+
+    const std::vector<uint32_t> inputs = buildInputs(options);
+    std::vector<int8_t> reductions;
+    std::vector<int16_t> stages;
+    std::vector<int32_t> sums;
+    std::vector<uint32_t> outputs;
+    reductions.reserve(inputs.size());
+    stages.reserve(inputs.size() * STAGES * 3);
+    sums.reserve(inputs.size());
+    outputs.reserve(inputs.size());
+
+    CORDICSoftmax cordic(false);
+    size_t mismatches = 0;
+    for (uint32_t bits : inputs) {
+        const typename Model::Trace trace = Model::trace(bits);
+        if (trace.output_bits != cpuExponential<LastShift>(cordic, bits)) {
+            mismatches++;
+        }
+        reductions.push_back(trace.reduction);
+        for (size_t s = 0; s < STAGES; s++) {
+            stages.push_back(trace.x[s]);
+            stages.push_back(trace.y[s]);
+            stages.push_back(trace.z[s]);
+        }
+        sums.push_back(trace.sum);
+        outputs.push_back(trace.output_bits);
+    }
+    if (mismatches != 0) {
+        std::cerr << "❌ ERROR: " << mismatches << " vectores distintos de la ruta CPU" << std::endl;
+        return 1;
+    }
+
+    writeBinary(options.prefix + "_input.bin", inputs);
+    writeBinary(options.prefix + "_reduction.bin", reductions);
+    writeBinary(options.prefix + "_stages.bin", stages);
+    writeBinary(options.prefix + "_sum.bin", sums);
+    writeBinary(options.prefix + "_output.bin", outputs);
+
+    std::ofstream manifest(options.prefix + ".txt", std::ios::trunc);
+    manifest << "vectors " << inputs.size() << "\n"
+             << "format Q3.12 (int16), entrada / salida float32\n"
+             << "last_shift " << LastShift << "\n"
+             << "rotations " << Model::LENGTH << "\n"
+             << "pipeline_depth " << Model::PIPELINE_DEPTH << " (PRE + rotaciones + POST, II = 1)\n"
+             << "folded_x0 " << Model::FOLDED_X0 << "\n"
+             << "schedule";
+    for (int k : Model::Rotator::SCHEDULE) {
+        manifest << " " << k;
+    }
+    manifest << "\nangles";
+    for (int k : Model::Rotator::SCHEDULE) {
+        manifest << " " << Model::Rotator::ANGLES[k];
+    }
+    manifest << "\nstages_layout vector × " << STAGES << " etapas × {X, Y, Z} int16\n";
+    if (!manifest) {
+        throw std::runtime_error("No se pudo escribir " + options.prefix + ".txt");
+    }
+
+    std::cout << "Vectores: " << inputs.size() << " (N = " << LastShift << ", "
+              << Model::LENGTH << " rotaciones, profundidad " << Model::PIPELINE_DEPTH
+              << "), todos iguales a calculateExpFolded" << std::endl;
+    std::cout << "Escritos: " << options.prefix << "_{input,reduction,stages,sum,output}.bin, "
+              << options.prefix << ".txt" << std::endl;
+    return 0;
+}
+
+template <size_t... I>
+static int dispatch(const VectorOptions& options, std::index_sequence<I...>) {
+    using Generator = int (*)(const VectorOptions&);
+    static constexpr Generator generators[] = {&generate<static_cast<int>(I) + 1>...};
+    return generators[options.last_shift - 1](options);
+}
+
+static bool parseOptions(int argc, char** argv, VectorOptions& options) {
+    for (int i = 1; i < argc; i++) {
+        const std::string arg = argv[i];
+        auto value = [&](const char* prefix) -> const char* {
+            const size_t length = std::strlen(prefix);
+            return arg.compare(0, length, prefix) == 0 ? argv[i] + length : nullptr;
+        };
+        if (const char* v = value("--out=")) {
+            options.prefix = v;
+        } else if (const char* v = value("--count=")) {
+            options.count = std::strtoul(v, nullptr, 10);
+        } else if (const char* v = value("--seed=")) {
+            options.seed = static_cast<unsigned>(std::strtoul(v, nullptr, 10));
+        } else if (const char* v = value("--last-shift=")) {
+            options.last_shift = std::atoi(v);
+        } else if (arg == "--exhaustive") {
+            options.exhaustive = true;
+        } else {
+            std::cerr << "Opción desconocida: " << arg << std::endl;
+            return false;
+        }
+    }
+    if (options.last_shift < 1 || options.last_shift > CORDICConfig::FRAC_WIDTH) {
+        std::cerr << "--last-shift fuera de [1, " << CORDICConfig::FRAC_WIDTH << "]" << std::endl;
+        return false;
+    }
+    return true;
+}
+
+int main(int argc, char** argv) {
+    VectorOptions options;
+    if (!parseOptions(argc, argv, options)) {
+        std::cerr << "Uso: " << argv[0]
+                  << " [--out=PREFIJO] [--count=N] [--seed=S] [--last-shift=N] [--exhaustive]"
+                  << std::endl;
+        return 1;
+    }
+
+    try {
+        return dispatch(options, std::make_index_sequence<CORDICConfig::FRAC_WIDTH>{});
+    } catch (const std::exception& e) {
+        std::cerr << "❌ ERROR: " << e.what() << std::endl;
+        return 1;
+    }
+}